@@ -0,0 +1,23 @@
+/// Apache License 2.0
+
+#include <cstddef>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace benchmarks
+{
+namespace global
+{
+
+/// @brief                      Get the number of heap allocations made by the benchmark process so far
+///
+/// @return                     Number of calls to malloc, calloc and realloc, from any thread
+
+std::size_t getAllocationCount();
+
+}  // namespace global
+}  // namespace benchmarks
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,67 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+#include <Global.benchmark.hpp>
+
+// Heap allocations are counted by interposing the glibc allocator, which also serves operator new and the Eigen
+// aligned allocator
+
+extern "C"
+{
+    void* __libc_malloc(std::size_t aSize);
+    void* __libc_calloc(std::size_t aCount, std::size_t aSize);
+    void* __libc_realloc(void* aPointer, std::size_t aSize);
+}
+
+namespace
+{
+
+std::atomic<std::size_t> allocationCount = {0};
+
+}  // namespace
+
+extern "C"
+{
+    void* malloc(std::size_t aSize) noexcept
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        return __libc_malloc(aSize);
+    }
+
+    void* calloc(std::size_t aCount, std::size_t aSize) noexcept
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        return __libc_calloc(aCount, aSize);
+    }
+
+    void* realloc(void* aPointer, std::size_t aSize) noexcept
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        return __libc_realloc(aPointer, aSize);
+    }
+}
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace benchmarks
+{
+namespace global
+{
+
+std::size_t getAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+}  // namespace global
+}  // namespace benchmarks
+}  // namespace mathematics
+}  // namespace ostk
+
+BENCHMARK_MAIN();
@@ -0,0 +1,324 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <streambuf>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
+
+#include <Global.benchmark.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+using ostk::mathematics::solver::NumericalSolver;
+
+namespace
+{
+
+// Canonical problems, integrated with every stepper type and log type. Combinations a stepper type does not support
+// (e.g. implicit steppers on ensembles) are reported as skipped with the raised error.
+
+const double earthGravitationalParameter = 398600.4418e9;  // [m^3/s^2]
+const double earthEquatorialRadius = 6378137.0;            // [m]
+const double earthJ2 = 1.08262668e-3;
+const double vanDerPolDamping = 100.0;
+
+struct Problem
+{
+    String name;
+    Real timeStep;   ///< Fixed time step, or initial time step guess [s]
+    Real tolerance;  ///< Relative and absolute tolerance
+    std::function<void(NumericalSolver&)> integrate;
+    NumericalSolver::JacobianWrapper jacobian;
+};
+
+void HarmonicOscillator(const VectorXd& x, VectorXd& dxdt, const double)
+{
+    dxdt[0] = x[1];
+    dxdt[1] = -x[0];
+}
+
+void TwoBody(const VectorXd& x, VectorXd& dxdt, const double)
+{
+    const double radius = x.head<3>().norm();
+
+    dxdt.head<3>() = x.tail<3>();
+    dxdt.tail<3>() = -earthGravitationalParameter / (radius * radius * radius) * x.head<3>();
+}
+
+void J2Orbit(const VectorXd& x, VectorXd& dxdt, const double)
+{
+    const double radiusSquared = x.head<3>().squaredNorm();
+    const double radius = std::sqrt(radiusSquared);
+
+    const double factor = -earthGravitationalParameter / (radiusSquared * radius);
+    const double j2Factor = 1.5 * earthJ2 * earthEquatorialRadius * earthEquatorialRadius / radiusSquared;
+    const double zRatioSquared = x[2] * x[2] / radiusSquared;
+
+    dxdt.head<3>() = x.tail<3>();
+    dxdt[3] = factor * x[0] * (1.0 + j2Factor * (1.0 - 5.0 * zRatioSquared));
+    dxdt[4] = factor * x[1] * (1.0 + j2Factor * (1.0 - 5.0 * zRatioSquared));
+    dxdt[5] = factor * x[2] * (1.0 + j2Factor * (3.0 - 5.0 * zRatioSquared));
+}
+
+void VanDerPol(const VectorXd& x, VectorXd& dxdt, const double)
+{
+    dxdt[0] = x[1];
+    dxdt[1] = vanDerPolDamping * (1.0 - x[0] * x[0]) * x[1] - x[0];
+}
+
+void VanDerPolJacobian(const VectorXd& x, MatrixXd& dfdx, VectorXd& dfdt, const double)
+{
+    dfdx(0, 0) = 0.0;
+    dfdx(0, 1) = 1.0;
+    dfdx(1, 0) = -2.0 * vanDerPolDamping * x[0] * x[1] - 1.0;
+    dfdx(1, 1) = vanDerPolDamping * (1.0 - x[0] * x[0]);
+
+    dfdt.setZero();
+}
+
+void TwoBodyEnsemble(const MatrixXd& x, MatrixXd& dxdt, const double)
+{
+    const Eigen::RowVectorXd radii = x.topRows<3>().colwise().norm();
+
+    dxdt.topRows<3>() = x.bottomRows<3>();
+    dxdt.bottomRows<3>() =
+        (x.topRows<3>().array().rowwise() * (-earthGravitationalParameter / radii.array().cube())).matrix();
+}
+
+VectorXd CircularOrbitState(const double aRadius, const double anInclination)
+{
+    const double velocity = std::sqrt(earthGravitationalParameter / aRadius);
+
+    VectorXd state(6);
+    state << aRadius, 0.0, 0.0, 0.0, velocity * std::cos(anInclination), velocity * std::sin(anInclination);
+
+    return state;
+}
+
+Array<Problem> Problems()
+{
+    const double orbitRadius = 7000.0e3;  // [m]
+    const double orbitPeriod =
+        2.0 * M_PI * std::sqrt(orbitRadius * orbitRadius * orbitRadius / earthGravitationalParameter);  // [s]
+
+    MatrixXd ensembleState(6, 100);
+
+    for (Eigen::Index memberIndex = 0; memberIndex < ensembleState.cols(); ++memberIndex)
+    {
+        ensembleState.col(memberIndex) = CircularOrbitState(orbitRadius + 10.0 * double(memberIndex), 0.9);
+    }
+
+    return {
+        {
+            "HarmonicOscillator",
+            1e-2,
+            1e-12,
+            [](NumericalSolver& aNumericalSolver) -> void
+            {
+                benchmark::DoNotOptimize(aNumericalSolver.integrateDuration(
+                    (VectorXd(2) << 0.0, 1.0).finished(), 100.0, &HarmonicOscillator
+                ));
+            },
+            nullptr,
+        },
+        {
+            "TwoBody",
+            5.0,
+            1e-12,
+            [orbitRadius, orbitPeriod](NumericalSolver& aNumericalSolver) -> void
+            {
+                benchmark::DoNotOptimize(
+                    aNumericalSolver.integrateDuration(CircularOrbitState(orbitRadius, 0.9), orbitPeriod, &TwoBody)
+                );
+            },
+            nullptr,
+        },
+        {
+            "J2Orbit",
+            5.0,
+            1e-12,
+            [orbitRadius](NumericalSolver& aNumericalSolver) -> void
+            {
+                benchmark::DoNotOptimize(
+                    aNumericalSolver.integrateDuration(CircularOrbitState(orbitRadius, 0.9), 86400.0, &J2Orbit)
+                );
+            },
+            nullptr,
+        },
+        {
+            "VanDerPol",
+            1e-3,
+            1e-8,
+            [](NumericalSolver& aNumericalSolver) -> void
+            {
+                benchmark::DoNotOptimize(
+                    aNumericalSolver.integrateDuration((VectorXd(2) << 2.0, 0.0).finished(), 200.0, &VanDerPol)
+                );
+            },
+            &VanDerPolJacobian,
+        },
+        {
+            "Ensemble",
+            5.0,
+            1e-12,
+            [ensembleState, orbitPeriod](NumericalSolver& aNumericalSolver) -> void
+            {
+                benchmark::DoNotOptimize(
+                    aNumericalSolver.integrateEnsembleDuration(ensembleState, orbitPeriod, &TwoBodyEnsemble)
+                );
+            },
+            nullptr,
+        },
+    };
+}
+
+// Logged states are formatted as usual, but discarded instead of being written to the terminal
+
+class OutputDiscarder
+{
+   public:
+    OutputDiscarder()
+        : outputBuffer_(std::cout.rdbuf(&nullBuffer_))
+    {
+    }
+
+    ~OutputDiscarder()
+    {
+        std::cout.rdbuf(outputBuffer_);
+    }
+
+   private:
+    class NullBuffer : public std::streambuf
+    {
+       protected:
+        int overflow(int aCharacter) override
+        {
+            return aCharacter;
+        }
+    };
+
+    NullBuffer nullBuffer_;
+    std::streambuf* outputBuffer_;
+};
+
+void BenchmarkIntegration(
+    benchmark::State& aState,
+    const Problem& aProblem,
+    const NumericalSolver::StepperType& aStepperType,
+    const NumericalSolver::LogType& aLogType
+)
+{
+    using ostk::mathematics::benchmarks::global::getAllocationCount;
+
+    NumericalSolver numericalSolver = {
+        aLogType, aStepperType, aProblem.timeStep, aProblem.tolerance, aProblem.tolerance
+    };
+
+    if (aProblem.jacobian)
+    {
+        numericalSolver.setJacobian(aProblem.jacobian);
+    }
+
+    double stepCount = 0.0;
+    double systemOfEquationsCallCount = 0.0;
+    double allocationCount = 0.0;
+    double integrationTime = 0.0;  // [s]
+
+    {
+        const OutputDiscarder outputDiscarder;
+
+        for (auto _ : aState)
+        {
+            const std::size_t initialAllocationCount = getAllocationCount();
+
+            try
+            {
+                aProblem.integrate(numericalSolver);
+            }
+            catch (const std::exception& anException)
+            {
+                aState.SkipWithError(anException.what());
+                break;
+            }
+
+            allocationCount += double(getAllocationCount() - initialAllocationCount);
+
+            const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+            stepCount += double(statistics.acceptedStepCount);
+            systemOfEquationsCallCount += double(statistics.systemOfEquationsCallCount);
+            integrationTime += statistics.wallTime.isDefined() ? double(statistics.wallTime) : 0.0;
+        }
+    }
+
+    if (stepCount > 0.0)
+    {
+        aState.counters["ns/step"] = 1e9 * integrationTime / stepCount;
+    }
+
+    aState.counters["steps"] = benchmark::Counter(stepCount, benchmark::Counter::kAvgIterations);
+    aState.counters["rhsEvals"] = benchmark::Counter(systemOfEquationsCallCount, benchmark::Counter::kAvgIterations);
+    aState.counters["allocations"] = benchmark::Counter(allocationCount, benchmark::Counter::kAvgIterations);
+}
+
+const bool areBenchmarksRegistered = []() -> bool
+{
+    const Array<NumericalSolver::StepperType> stepperTypes = {
+        NumericalSolver::StepperType::RungeKutta4,
+        NumericalSolver::StepperType::RungeKuttaCashKarp54,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        NumericalSolver::StepperType::Rosenbrock4,
+        NumericalSolver::StepperType::BackwardDifferentiationFormula,
+        NumericalSolver::StepperType::VelocityVerlet,
+        NumericalSolver::StepperType::Yoshida4,
+        NumericalSolver::StepperType::AdamsBashforthMoulton8,
+    };
+
+    const Array<NumericalSolver::LogType> logTypes = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::LogType::LogConstant,
+        NumericalSolver::LogType::LogAdaptive,
+    };
+
+    for (const Problem& problem : Problems())
+    {
+        for (const NumericalSolver::StepperType& stepperType : stepperTypes)
+        {
+            for (const NumericalSolver::LogType& logType : logTypes)
+            {
+                const String name = "NumericalSolver/" + problem.name + "/" +
+                                    NumericalSolver::StringFromStepperType(stepperType) + "/" +
+                                    NumericalSolver::StringFromLogType(logType);
+
+                benchmark::RegisterBenchmark(
+                    name.c_str(),
+                    [problem, stepperType, logType](benchmark::State& aState) -> void
+                    {
+                        BenchmarkIntegration(aState, problem, stepperType, logType);
+                    }
+                )
+                    ->Unit(benchmark::kMillisecond);
+            }
+        }
+    }
+
+    return true;
+}();
+
+}  // namespace
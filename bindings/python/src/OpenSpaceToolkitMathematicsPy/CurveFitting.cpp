@@ -1,6 +1,8 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkitMathematicsPy/CurveFitting/ChebyshevSeries.cpp>
 #include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator.cpp>
+#include <OpenSpaceToolkitMathematicsPy/CurveFitting/VectorInterpolator.cpp>
 
 inline void OpenSpaceToolkitMathematicsPy_CurveFitting(pybind11::module& aModule)
 {
@@ -8,5 +10,7 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting(pybind11::module& aModule
     auto curve_fitting = aModule.def_submodule("curve_fitting");
 
     // Add object to python "interpolators" submodules
+    OpenSpaceToolkitMathematicsPy_CurveFitting_ChebyshevSeries(curve_fitting);
     OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator(curve_fitting);
+    OpenSpaceToolkitMathematicsPy_CurveFitting_VectorInterpolator(curve_fitting);
 }
@@ -0,0 +1,45 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/ChebyshevSeries.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_CurveFitting_ChebyshevSeries(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::curvefitting::ChebyshevSeries;
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::VectorXd;
+
+    class_<ChebyshevSeries>(aModule, "ChebyshevSeries")
+
+        .def(init<const VectorXd&, const Array<MatrixXd>&>(), arg("breakpoints"), arg("coefficients"))
+
+        .def("get_segment_count", &ChebyshevSeries::getSegmentCount)
+        .def("get_component_count", &ChebyshevSeries::getComponentCount)
+        .def("get_breakpoints", &ChebyshevSeries::getBreakpoints)
+        .def("get_coefficients", &ChebyshevSeries::getCoefficients)
+
+        .def("evaluate", overload_cast<const VectorXd&>(&ChebyshevSeries::evaluate, const_), arg("x"))
+        .def("evaluate", overload_cast<const double&>(&ChebyshevSeries::evaluate, const_), arg("x"))
+        .def(
+            "evaluate_derivative",
+            overload_cast<const VectorXd&, const Size&>(&ChebyshevSeries::evaluateDerivative, const_),
+            arg("x"),
+            arg("order") = 1
+        )
+        .def(
+            "evaluate_derivative",
+            overload_cast<const double&, const Size&>(&ChebyshevSeries::evaluateDerivative, const_),
+            arg("x"),
+            arg("order") = 1
+        )
+
+        .def_static("fit", &ChebyshevSeries::Fit, arg("x"), arg("y"), arg("degree"), arg("segment_count") = 1)
+        .def_static("fit_adaptive", &ChebyshevSeries::FitAdaptive, arg("x"), arg("y"), arg("degree"), arg("tolerance"))
+
+        ;
+}
@@ -4,13 +4,20 @@
 
 #include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/BarycentricRational.cpp>
 #include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/CubicSpline.cpp>
+#include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/Hermite.cpp>
+#include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/Lagrange.cpp>
+#include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/LagrangeHermite.cpp>
 #include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/Linear.cpp>
+#include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/NonUniformCubicSpline.cpp>
+#include <OpenSpaceToolkitMathematicsPy/CurveFitting/Interpolator/Streaming.cpp>
 
 using namespace pybind11;
 
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 // Trampoline class for virtual member functions
@@ -30,6 +37,34 @@ class PyInterpolator : public Interpolator
     {
         PYBIND11_OVERRIDE_PURE(double, Interpolator, evaluate, aQueryValue);
     }
+
+    VectorXd evaluateDerivative(const VectorXd& aQueryVector, const Size& anOrder) const override
+    {
+        PYBIND11_OVERRIDE_NAME(
+            VectorXd, Interpolator, "evaluate_derivative", evaluateDerivative, aQueryVector, anOrder
+        );
+    }
+
+    double evaluateDerivative(const double& aQueryValue, const Size& anOrder) const override
+    {
+        PYBIND11_OVERRIDE_PURE_NAME(
+            double, Interpolator, "evaluate_derivative", evaluateDerivative, aQueryValue, anOrder
+        );
+    }
+
+    MatrixXd evaluateWithDerivatives(const VectorXd& aQueryVector, const Size& aMaximumOrder) const override
+    {
+        PYBIND11_OVERRIDE_NAME(
+            MatrixXd, Interpolator, "evaluate_with_derivatives", evaluateWithDerivatives, aQueryVector, aMaximumOrder
+        );
+    }
+
+    VectorXd evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const override
+    {
+        PYBIND11_OVERRIDE_NAME(
+            VectorXd, Interpolator, "evaluate_with_derivatives", evaluateWithDerivatives, aQueryValue, aMaximumOrder
+        );
+    }
 };
 
 inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator(pybind11::module& aModule)
@@ -40,7 +75,12 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator(pybind11::mo
 
         .value("BarycentricRational", Interpolator::Type::BarycentricRational)
         .value("CubicSpline", Interpolator::Type::CubicSpline)
+        .value("Hermite", Interpolator::Type::Hermite)
+        .value("Lagrange", Interpolator::Type::Lagrange)
+        .value("LagrangeHermite", Interpolator::Type::LagrangeHermite)
         .value("Linear", Interpolator::Type::Linear)
+        .value("NonUniformCubicSpline", Interpolator::Type::NonUniformCubicSpline)
+        .value("Streaming", Interpolator::Type::Streaming)
 
         ;
 
@@ -52,6 +92,51 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator(pybind11::mo
 
         .def("evaluate", overload_cast<const VectorXd&>(&Interpolator::evaluate, const_), arg("x"))
         .def("evaluate", overload_cast<const double&>(&Interpolator::evaluate, const_), arg("x"))
+        .def(
+            "evaluate",
+            overload_cast<const Eigen::Ref<const VectorXd>&, Eigen::Ref<VectorXd>>(&Interpolator::evaluate, const_),
+            arg("x"),
+            arg("y").noconvert()
+        )
+        .def(
+            "evaluate_parallel",
+            overload_cast<const VectorXd&, const Size&>(&Interpolator::evaluateParallel, const_),
+            arg("x"),
+            arg("thread_count") = 0,
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "evaluate_parallel",
+            overload_cast<const VectorXd&, Eigen::Ref<VectorXd>, const Size&>(&Interpolator::evaluateParallel, const_),
+            arg("x"),
+            arg("y").noconvert(),
+            arg("thread_count") = 0,
+            call_guard<gil_scoped_release>()
+        )
+        .def(
+            "evaluate_derivative",
+            overload_cast<const VectorXd&, const Size&>(&Interpolator::evaluateDerivative, const_),
+            arg("x"),
+            arg("order") = 1
+        )
+        .def(
+            "evaluate_derivative",
+            overload_cast<const double&, const Size&>(&Interpolator::evaluateDerivative, const_),
+            arg("x"),
+            arg("order") = 1
+        )
+        .def(
+            "evaluate_with_derivatives",
+            overload_cast<const VectorXd&, const Size&>(&Interpolator::evaluateWithDerivatives, const_),
+            arg("x"),
+            arg("maximum_order")
+        )
+        .def(
+            "evaluate_with_derivatives",
+            overload_cast<const double&, const Size&>(&Interpolator::evaluateWithDerivatives, const_),
+            arg("x"),
+            arg("maximum_order")
+        )
 
         .def_static(
             "generate_interpolator", &Interpolator::GenerateInterpolator, arg("interpolation_type"), arg("x"), arg("y")
@@ -65,5 +150,10 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator(pybind11::mo
     // Add object to python "interpolator" submodules
     OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_BarycentricRational(interpolator);
     OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_CubicSpline(interpolator);
+    OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Hermite(interpolator);
+    OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Lagrange(interpolator);
+    OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_LagrangeHermite(interpolator);
     OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Linear(interpolator);
+    OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_NonUniformCubicSpline(interpolator);
+    OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Streaming(interpolator);
 }
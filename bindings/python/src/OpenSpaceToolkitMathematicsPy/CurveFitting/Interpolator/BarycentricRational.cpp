@@ -18,5 +18,13 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_BarycentricR
         .def(init<const VectorXd&, const VectorXd&>(), arg("x"), arg("y"))
 
         .def("evaluate", overload_cast<const VectorXd&>(&BarycentricRational::evaluate, const_), arg("x"))
-        .def("evaluate", overload_cast<const double&>(&BarycentricRational::evaluate, const_), arg("x"));
+        .def("evaluate", overload_cast<const double&>(&BarycentricRational::evaluate, const_), arg("x"))
+        .def(
+            "evaluate",
+            overload_cast<const Eigen::Ref<const VectorXd>&, Eigen::Ref<VectorXd>>(
+                &BarycentricRational::evaluate, const_
+            ),
+            arg("x"),
+            arg("y").noconvert()
+        );
 }
@@ -20,5 +20,11 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_CubicSpline(
         .def(init<const VectorXd&, const Real&, const Real&>(), arg("y"), arg("x_0"), arg("h"))
 
         .def("evaluate", overload_cast<const VectorXd&>(&CubicSpline::evaluate, const_), arg("x"))
-        .def("evaluate", overload_cast<const double&>(&CubicSpline::evaluate, const_), arg("x"));
+        .def("evaluate", overload_cast<const double&>(&CubicSpline::evaluate, const_), arg("x"))
+        .def(
+            "evaluate",
+            overload_cast<const Eigen::Ref<const VectorXd>&, Eigen::Ref<VectorXd>>(&CubicSpline::evaluate, const_),
+            arg("x"),
+            arg("y").noconvert()
+        );
 }
@@ -0,0 +1,37 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Hermite.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Hermite(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+
+    using ostk::mathematics::curvefitting::Interpolator;
+    using ostk::mathematics::object::VectorXd;
+
+    using ostk::mathematics::curvefitting::interpolator::Hermite;
+
+    class_<Hermite, Interpolator, Shared<Hermite>>(aModule, "Hermite")
+
+        .def(init<const VectorXd&, const VectorXd&, const VectorXd&>(), arg("x"), arg("y"), arg("dy_dx"))
+        .def(
+            init<const VectorXd&, const VectorXd&, const VectorXd&, const VectorXd&>(),
+            arg("x"),
+            arg("y"),
+            arg("dy_dx"),
+            arg("d2y_dx2")
+        )
+
+        .def("get_degree", &Hermite::getDegree)
+
+        .def("evaluate", overload_cast<const VectorXd&>(&Hermite::evaluate, const_), arg("x"))
+        .def("evaluate", overload_cast<const double&>(&Hermite::evaluate, const_), arg("x"))
+        .def(
+            "evaluate",
+            overload_cast<const Eigen::Ref<const VectorXd>&, Eigen::Ref<VectorXd>>(&Hermite::evaluate, const_),
+            arg("x"),
+            arg("y").noconvert()
+        );
+}
@@ -0,0 +1,31 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Lagrange.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Lagrange(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::curvefitting::Interpolator;
+    using ostk::mathematics::object::VectorXd;
+
+    using ostk::mathematics::curvefitting::interpolator::Lagrange;
+
+    class_<Lagrange, Interpolator, Shared<Lagrange>>(aModule, "Lagrange")
+
+        .def(init<const VectorXd&, const VectorXd&, const Size&>(), arg("x"), arg("y"), arg("point_count") = 8)
+
+        .def("get_point_count", &Lagrange::getPointCount)
+
+        .def("evaluate", overload_cast<const VectorXd&>(&Lagrange::evaluate, const_), arg("x"))
+        .def("evaluate", overload_cast<const double&>(&Lagrange::evaluate, const_), arg("x"))
+        .def(
+            "evaluate",
+            overload_cast<const Eigen::Ref<const VectorXd>&, Eigen::Ref<VectorXd>>(&Lagrange::evaluate, const_),
+            arg("x"),
+            arg("y").noconvert()
+        );
+}
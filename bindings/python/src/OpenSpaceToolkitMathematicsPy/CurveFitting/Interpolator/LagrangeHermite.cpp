@@ -0,0 +1,37 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/LagrangeHermite.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_LagrangeHermite(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::curvefitting::Interpolator;
+    using ostk::mathematics::object::VectorXd;
+
+    using ostk::mathematics::curvefitting::interpolator::LagrangeHermite;
+
+    class_<LagrangeHermite, Interpolator, Shared<LagrangeHermite>>(aModule, "LagrangeHermite")
+
+        .def(
+            init<const VectorXd&, const VectorXd&, const VectorXd&, const Size&>(),
+            arg("x"),
+            arg("y"),
+            arg("dy_dx"),
+            arg("point_count") = 4
+        )
+
+        .def("get_point_count", &LagrangeHermite::getPointCount)
+
+        .def("evaluate", overload_cast<const VectorXd&>(&LagrangeHermite::evaluate, const_), arg("x"))
+        .def("evaluate", overload_cast<const double&>(&LagrangeHermite::evaluate, const_), arg("x"))
+        .def(
+            "evaluate",
+            overload_cast<const Eigen::Ref<const VectorXd>&, Eigen::Ref<VectorXd>>(&LagrangeHermite::evaluate, const_),
+            arg("x"),
+            arg("y").noconvert()
+        );
+}
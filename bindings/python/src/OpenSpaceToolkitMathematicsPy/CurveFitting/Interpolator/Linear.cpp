@@ -18,5 +18,12 @@ inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Linear(pybin
         .def(init<const VectorXd&, const VectorXd&>(), arg("x"), arg("y"))
 
         .def("evaluate", overload_cast<const VectorXd&>(&Linear::evaluate, const_), arg("x"))
-        .def("evaluate", overload_cast<const double&>(&Linear::evaluate, const_), arg("x"));
+        .def("evaluate", overload_cast<const double&>(&Linear::evaluate, const_), arg("x"))
+        .def(
+            "evaluate",
+            overload_cast<const Eigen::Ref<const VectorXd>&, Eigen::Ref<VectorXd>>(&Linear::evaluate, const_),
+            arg("x"),
+            arg("y").noconvert()
+        )
+        .def("evaluate_sorted", &Linear::evaluateSorted, arg("x"), arg("y").noconvert());
 }
@@ -0,0 +1,63 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/NonUniformCubicSpline.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_NonUniformCubicSpline(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+    using ostk::core::type::Shared;
+
+    using ostk::mathematics::curvefitting::Interpolator;
+    using ostk::mathematics::object::VectorXd;
+
+    using ostk::mathematics::curvefitting::interpolator::NonUniformCubicSpline;
+
+    class_<NonUniformCubicSpline, Interpolator, Shared<NonUniformCubicSpline>> nonUniformCubicSpline(
+        aModule, "NonUniformCubicSpline"
+    );
+
+    enum_<NonUniformCubicSpline::BoundaryCondition>(nonUniformCubicSpline, "BoundaryCondition")
+
+        .value("Natural", NonUniformCubicSpline::BoundaryCondition::Natural)
+        .value("Clamped", NonUniformCubicSpline::BoundaryCondition::Clamped)
+        .value("NotAKnot", NonUniformCubicSpline::BoundaryCondition::NotAKnot)
+
+        ;
+
+    nonUniformCubicSpline
+
+        .def(
+            init<const VectorXd&, const VectorXd&, const NonUniformCubicSpline::BoundaryCondition&>(),
+            arg("x"),
+            arg("y"),
+            arg_v("boundary_condition", NonUniformCubicSpline::BoundaryCondition::NotAKnot, "BoundaryCondition.NotAKnot")
+        )
+        .def(
+            init<const VectorXd&, const VectorXd&, const Real&, const Real&>(),
+            arg("x"),
+            arg("y"),
+            arg("start_derivative"),
+            arg("end_derivative")
+        )
+
+        .def("get_boundary_condition", &NonUniformCubicSpline::getBoundaryCondition)
+
+        .def("evaluate", overload_cast<const VectorXd&>(&NonUniformCubicSpline::evaluate, const_), arg("x"))
+        .def("evaluate", overload_cast<const double&>(&NonUniformCubicSpline::evaluate, const_), arg("x"))
+        .def(
+            "evaluate",
+            overload_cast<const Eigen::Ref<const VectorXd>&, Eigen::Ref<VectorXd>>(
+                &NonUniformCubicSpline::evaluate, const_
+            ),
+            arg("x"),
+            arg("y").noconvert()
+        )
+
+        .def_static(
+            "string_from_boundary_condition",
+            &NonUniformCubicSpline::StringFromBoundaryCondition,
+            arg("boundary_condition")
+        );
+}
@@ -0,0 +1,41 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Streaming.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_CurveFitting_Interpolator_Streaming(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::curvefitting::Interpolator;
+    using ostk::mathematics::object::VectorXd;
+
+    using ostk::mathematics::curvefitting::interpolator::Streaming;
+
+    class_<Streaming, Interpolator, Shared<Streaming>>(aModule, "Streaming")
+
+        .def(init<const Size&>(), arg("capacity") = 0)
+        .def(init<const VectorXd&, const VectorXd&, const Size&>(), arg("x"), arg("y"), arg("capacity") = 0)
+
+        .def("is_defined", &Streaming::isDefined)
+
+        .def("get_size", &Streaming::getSize)
+        .def("get_capacity", &Streaming::getCapacity)
+        .def("get_x", &Streaming::getXVector)
+        .def("get_y", &Streaming::getYVector)
+
+        .def("append", overload_cast<const double&, const double&>(&Streaming::append), arg("x"), arg("y"))
+        .def("append", overload_cast<const VectorXd&, const VectorXd&>(&Streaming::append), arg("x"), arg("y"))
+        .def("clear", &Streaming::clear)
+
+        .def("evaluate", overload_cast<const VectorXd&>(&Streaming::evaluate, const_), arg("x"))
+        .def("evaluate", overload_cast<const double&>(&Streaming::evaluate, const_), arg("x"))
+        .def(
+            "evaluate",
+            overload_cast<const Eigen::Ref<const VectorXd>&, Eigen::Ref<VectorXd>>(&Streaming::evaluate, const_),
+            arg("x"),
+            arg("y").noconvert()
+        );
+}
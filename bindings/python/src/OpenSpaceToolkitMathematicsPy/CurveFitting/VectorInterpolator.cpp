@@ -0,0 +1,32 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/VectorInterpolator.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_CurveFitting_VectorInterpolator(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+
+    using ostk::mathematics::curvefitting::Interpolator;
+    using ostk::mathematics::curvefitting::VectorInterpolator;
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::VectorXd;
+
+    class_<VectorInterpolator, Shared<VectorInterpolator>>(aModule, "VectorInterpolator")
+
+        .def(
+            init<const Interpolator::Type&, const VectorXd&, const MatrixXd&>(),
+            arg("interpolation_type"),
+            arg("x"),
+            arg("y")
+        )
+
+        .def("get_interpolation_type", &VectorInterpolator::getInterpolationType)
+        .def("get_component_count", &VectorInterpolator::getComponentCount)
+
+        .def("evaluate", overload_cast<const VectorXd&>(&VectorInterpolator::evaluate, const_), arg("x"))
+        .def("evaluate", overload_cast<const double&>(&VectorInterpolator::evaluate, const_), arg("x"))
+
+        ;
+}
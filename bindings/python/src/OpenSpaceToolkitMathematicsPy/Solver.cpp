@@ -1,6 +1,10 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkitMathematicsPy/Solver/DenseTrajectory.cpp>
+#include <OpenSpaceToolkitMathematicsPy/Solver/EventCondition.cpp>
+#include <OpenSpaceToolkitMathematicsPy/Solver/IntegrationSession.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Solver/NumericalSolver.cpp>
+#include <OpenSpaceToolkitMathematicsPy/Solver/Parareal.cpp>
 
 inline void OpenSpaceToolkitMathematicsPy_Solver(pybind11::module& aModule)
 {
@@ -8,5 +12,9 @@ inline void OpenSpaceToolkitMathematicsPy_Solver(pybind11::module& aModule)
     auto solver = aModule.def_submodule("solver");
 
     // Add object to python "interpolators" submodules
+    OpenSpaceToolkitMathematicsPy_Solver_DenseTrajectory(solver);
+    OpenSpaceToolkitMathematicsPy_Solver_EventCondition(solver);
     OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(solver);
+    OpenSpaceToolkitMathematicsPy_Solver_IntegrationSession(solver);
+    OpenSpaceToolkitMathematicsPy_Solver_Parareal(solver);
 }
@@ -0,0 +1,40 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Solver/DenseTrajectory.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_Solver_DenseTrajectory(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::VectorXd;
+    using ostk::mathematics::solver::DenseTrajectory;
+
+    class_<DenseTrajectory>(aModule, "DenseTrajectory")
+
+        .def(init<const VectorXd&, const MatrixXd&>(), arg("step_times"), arg("node_states"))
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<DenseTrajectory>))
+        .def("__repr__", &(shiftToString<DenseTrajectory>))
+
+        .def("is_defined", &DenseTrajectory::isDefined)
+
+        .def("get_step_times", &DenseTrajectory::accessStepTimes)
+        .def("get_node_states", &DenseTrajectory::accessNodeStates)
+        .def("get_step_count", &DenseTrajectory::getStepCount)
+        .def("get_state_dimension", &DenseTrajectory::getStateDimension)
+        .def("get_start_time", &DenseTrajectory::getStartTime)
+        .def("get_end_time", &DenseTrajectory::getEndTime)
+
+        .def("evaluate", overload_cast<const Real&>(&DenseTrajectory::evaluate, const_), arg("time"))
+        .def("evaluate", overload_cast<const VectorXd&>(&DenseTrajectory::evaluate, const_), arg("times"))
+
+        .def_static("undefined", &DenseTrajectory::Undefined)
+
+        ;
+}
@@ -0,0 +1,52 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Solver/EventCondition.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_Solver_EventCondition(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::String;
+
+    using ostk::mathematics::solver::EventCondition;
+
+    {
+        class_<EventCondition> eventCondition(aModule, "EventCondition");
+
+        eventCondition
+
+            .def(
+                init<const String&, const EventCondition::Criterion&, const EventCondition::Evaluator&, const bool>(),
+                arg("name"),
+                arg("criterion"),
+                arg("evaluator"),
+                arg("is_terminal") = true
+            )
+
+            .def("__str__", &(shiftToString<EventCondition>))
+            .def("__repr__", &(shiftToString<EventCondition>))
+
+            .def("is_defined", &EventCondition::isDefined)
+            .def("is_terminal", &EventCondition::isTerminal)
+
+            .def("get_name", &EventCondition::getName)
+            .def("get_criterion", &EventCondition::getCriterion)
+
+            .def("evaluate", &EventCondition::evaluate, arg("state_vector"), arg("time"))
+            .def("is_satisfied", &EventCondition::isSatisfied, arg("previous_value"), arg("current_value"))
+
+            .def_static("string_from_criterion", &EventCondition::StringFromCriterion, arg("criterion"))
+
+            .def_static("undefined", &EventCondition::Undefined)
+
+            ;
+
+        enum_<EventCondition::Criterion>(eventCondition, "Criterion")
+
+            .value("PositiveCrossing", EventCondition::Criterion::PositiveCrossing)
+            .value("NegativeCrossing", EventCondition::Criterion::NegativeCrossing)
+            .value("AnyCrossing", EventCondition::Criterion::AnyCrossing)
+
+            ;
+    }
+}
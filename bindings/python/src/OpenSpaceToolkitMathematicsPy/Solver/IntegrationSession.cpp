@@ -0,0 +1,67 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Solver/IntegrationSession.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_Solver_IntegrationSession(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+
+    using ostk::mathematics::solver::IntegrationSession;
+    using ostk::mathematics::solver::NumericalSolver;
+
+    typedef std::function<NumericalSolver::StateVector(
+        const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+    )>
+        pythonSystemOfEquationsSignature;
+
+    class_<IntegrationSession>(aModule, "IntegrationSession")
+
+        .def(
+            init(
+                [](const NumericalSolver& aNumericalSolver,
+                   const NumericalSolver::StateVector& anInitialStateVector,
+                   const Real& aStartTime,
+                   const object& aSystemOfEquationsObject)
+                {
+                    const auto pythonDynamicsEquation =
+                        pybind11::cast<pythonSystemOfEquationsSignature>(aSystemOfEquationsObject);
+
+                    // The session outlives this call, so the Python callable is held by value
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        [pythonDynamicsEquation](
+                            const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+                        ) -> void
+                    {
+                        dxdt = pythonDynamicsEquation(x, dxdt, t);
+                    };
+
+                    return IntegrationSession(aNumericalSolver, anInitialStateVector, aStartTime, systemOfEquations);
+                }
+            ),
+            arg("numerical_solver"),
+            arg("state_vector"),
+            arg("start_time"),
+            arg("system_of_equations")
+        )
+
+        .def("__str__", &(shiftToString<IntegrationSession>))
+        .def("__repr__", &(shiftToString<IntegrationSession>))
+
+        .def("is_defined", &IntegrationSession::isDefined)
+
+        .def("get_state_vector", &IntegrationSession::accessStateVector)
+        .def("get_time", &IntegrationSession::getTime)
+        .def("get_solution", &IntegrationSession::getSolution)
+        .def("get_time_step", &IntegrationSession::getTimeStep)
+        .def("get_statistics", &IntegrationSession::getStatistics)
+
+        .def("advance_to", &IntegrationSession::advanceTo, arg("time"))
+        .def("advance_by", &IntegrationSession::advanceBy, arg("duration_in_seconds"))
+        .def("reset", &IntegrationSession::reset, arg("state_vector"), arg("time"))
+
+        .def_static("undefined", &IntegrationSession::Undefined)
+
+        ;
+}
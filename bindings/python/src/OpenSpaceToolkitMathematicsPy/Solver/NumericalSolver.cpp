@@ -1,7 +1,105 @@
 /// Apache License 2.0
 
+#include <cstdint>
+#include <optional>
+
 #include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
 
+// Python system of equations writing its derivative in place: it is called with NumPy state and derivative arrays
+// allocated once per integration, the solver buffers being copied in and out of them (no per call allocation)
+
+struct PyInPlaceSystemOfEquations
+{
+    pybind11::object function;
+};
+
+// Compiled system of equations, of C signature void(const double* x, double* dxdt, double t, int64_t n) (such as a
+// Numba cfunc): it is called on the solver buffers directly, and the integration runs without holding the GIL
+
+struct PyCompiledSystemOfEquations
+{
+    std::uintptr_t address;
+};
+
+// System of equations from a Python callable f(x, dxdt, t) -> dxdt, an in place or a compiled system of equations
+
+inline ostk::mathematics::solver::NumericalSolver::SystemOfEquationsWrapper PyCastSystemOfEquations(
+    const pybind11::object& aSystemOfEquationsObject
+)
+{
+    using ostk::mathematics::solver::NumericalSolver;
+
+    if (pybind11::isinstance<PyCompiledSystemOfEquations>(aSystemOfEquationsObject))
+    {
+        typedef void (*CompiledSystemOfEquations)(const double*, double*, double, std::int64_t);
+
+        const CompiledSystemOfEquations compiledSystemOfEquations = reinterpret_cast<CompiledSystemOfEquations>(
+            aSystemOfEquationsObject.cast<const PyCompiledSystemOfEquations&>().address
+        );
+
+        return [compiledSystemOfEquations](
+                   const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+               ) -> void
+        {
+            compiledSystemOfEquations(x.data(), dxdt.data(), t, x.size());
+        };
+    }
+
+    if (pybind11::isinstance<PyInPlaceSystemOfEquations>(aSystemOfEquationsObject))
+    {
+        return [function = aSystemOfEquationsObject.cast<const PyInPlaceSystemOfEquations&>().function,
+                stateArray = pybind11::array_t<double>(),
+                derivativeArray = pybind11::array_t<double>()](
+                   const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+               ) mutable -> void
+        {
+            if (stateArray.size() != x.size())
+            {
+                stateArray = pybind11::array_t<double>(x.size());
+                derivativeArray = pybind11::array_t<double>(x.size());
+            }
+
+            Eigen::Map<NumericalSolver::StateVector>(stateArray.mutable_data(), x.size()) = x;
+
+            function(stateArray, derivativeArray, t);
+
+            dxdt = Eigen::Map<const NumericalSolver::StateVector>(derivativeArray.data(), x.size());
+        };
+    }
+
+    typedef std::function<NumericalSolver::StateVector(
+        const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+    )>
+        pythonSystemOfEquationsSignature;
+
+    const auto pythonDynamicsEquation = pybind11::cast<pythonSystemOfEquationsSignature>(aSystemOfEquationsObject);
+
+    return [pythonDynamicsEquation](
+               const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+           ) -> void
+    {
+        dxdt = pythonDynamicsEquation(x, dxdt, t);
+    };
+}
+
+// Releases the GIL while in scope, when the system of equations is compiled (Python callbacks set on the solver, such
+// as observers, reacquire it)
+
+class PySystemOfEquationsGilRelease
+{
+   public:
+    explicit PySystemOfEquationsGilRelease(const pybind11::object& aSystemOfEquationsObject)
+    {
+        if (pybind11::isinstance<PyCompiledSystemOfEquations>(aSystemOfEquationsObject))
+        {
+            gilRelease_.emplace();
+        }
+    }
+
+   private:
+    std::optional<pybind11::gil_scoped_release> gilRelease_;
+};
+
 inline void OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(pybind11::module& aModule)
 {
     using namespace pybind11;
@@ -11,12 +109,20 @@ inline void OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(pybind11::modul
     using ostk::core::type::Real;
     using ostk::core::type::String;
 
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::VectorXd;
+    using ostk::mathematics::solver::EventCondition;
     using ostk::mathematics::solver::NumericalSolver;
 
-    typedef std::function<NumericalSolver::StateVector(
-        const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+    typedef std::function<NumericalSolver::EnsembleState(
+        const NumericalSolver::EnsembleState& x, NumericalSolver::EnsembleState& dxdt, const double t
     )>
-        pythonSystemOfEquationsSignature;
+        pythonEnsembleSystemOfEquationsSignature;
+
+    typedef std::function<std::tuple<MatrixXd, NumericalSolver::StateVector>(
+        const NumericalSolver::StateVector& x, const double t
+    )>
+        pythonJacobianSignature;
 
     {
         class_<NumericalSolver> numericalSolver(aModule, "NumericalSolver");
@@ -51,6 +157,46 @@ inline void OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(pybind11::modul
             .def("get_relative_tolerance", &NumericalSolver::getRelativeTolerance)
             .def("get_absolute_tolerance", &NumericalSolver::getAbsoluteTolerance)
             .def("get_observed_state_vectors", &NumericalSolver::getObservedStateVectors)
+            .def("get_observation_step_interval", &NumericalSolver::getObservationStepInterval)
+            .def(
+                "get_observation_minimum_time_separation", &NumericalSolver::getObservationMinimumTimeSeparation
+            )
+            .def("get_statistics", &NumericalSolver::getStatistics)
+
+            .def("set_state_observer", &NumericalSolver::setStateObserver, arg("state_observer"))
+            .def(
+                "set_jacobian",
+                +[](NumericalSolver& aNumericalSolver, const object& aJacobianObject)
+                {
+                    if (aJacobianObject.is_none())
+                    {
+                        aNumericalSolver.setJacobian(nullptr);
+                        return;
+                    }
+
+                    const auto pythonJacobian = pybind11::cast<pythonJacobianSignature>(aJacobianObject);
+
+                    aNumericalSolver.setJacobian(
+                        [pythonJacobian](
+                            const NumericalSolver::StateVector& x,
+                            MatrixXd& dfdx,
+                            NumericalSolver::StateVector& dfdt,
+                            const double t
+                        ) -> void
+                        {
+                            std::tie(dfdx, dfdt) = pythonJacobian(x, t);
+                        }
+                    );
+                },
+                arg("jacobian")
+            )
+            .def("set_step_trace_hook", &NumericalSolver::setStepTraceHook, arg("step_trace_hook"))
+            .def(
+                "set_observation_decimation",
+                &NumericalSolver::setObservationDecimation,
+                arg("step_interval"),
+                arg("minimum_time_separation") = Real::Undefined()
+            )
 
             .def(
                 "integrate_duration",
@@ -59,15 +205,10 @@ inline void OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(pybind11::modul
                     const Real& aDurationInSeconds,
                     const object& aSystemOfEquationsObject)
                 {
-                    const auto pythonDynamicsEquation =
-                        pybind11::cast<pythonSystemOfEquationsSignature>(aSystemOfEquationsObject);
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
 
-                    const NumericalSolver::SystemOfEquationsWrapper& systemOfEquations =
-                        [&](const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
-                        ) -> void
-                    {
-                        dxdt = pythonDynamicsEquation(x, dxdt, t);
-                    };
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
 
                     return aNumericalSolver.integrateDuration(aStateVector, aDurationInSeconds, systemOfEquations);
                 }
@@ -80,15 +221,10 @@ inline void OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(pybind11::modul
                     const Array<Real>& aDurationArray,
                     const object& aSystemOfEquationsObject)
                 {
-                    const auto pythonDynamicsEquation =
-                        pybind11::cast<pythonSystemOfEquationsSignature>(aSystemOfEquationsObject);
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
 
-                    const NumericalSolver::SystemOfEquationsWrapper& systemOfEquations =
-                        [&](const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
-                        ) -> void
-                    {
-                        dxdt = pythonDynamicsEquation(x, dxdt, t);
-                    };
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
 
                     return aNumericalSolver.integrateDuration(aStateVector, aDurationArray, systemOfEquations);
                 }
@@ -102,15 +238,10 @@ inline void OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(pybind11::modul
                     const Real& anEndTime,
                     const object& aSystemOfEquationsObject)
                 {
-                    const auto pythonDynamicsEquation =
-                        pybind11::cast<pythonSystemOfEquationsSignature>(aSystemOfEquationsObject);
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
 
-                    const NumericalSolver::SystemOfEquationsWrapper& systemOfEquations =
-                        [&](const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
-                        ) -> void
-                    {
-                        dxdt = pythonDynamicsEquation(x, dxdt, t);
-                    };
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
 
                     return aNumericalSolver.integrateTime(aStateVector, aStartTime, anEndTime, systemOfEquations);
                 }
@@ -123,23 +254,241 @@ inline void OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(pybind11::modul
                     const Real& aStartTime,
                     const Array<Real>& aTimeArray,
                     const object& aSystemOfEquationsObject)
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
+
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
+
+                    return aNumericalSolver.integrateTime(aStateVector, aStartTime, aTimeArray, systemOfEquations);
+                }
+            )
+
+            .def(
+                "integrate_time_matrix",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::StateVector& aStateVector,
+                    const Real& aStartTime,
+                    const VectorXd& aTimeVector,
+                    const object& aSystemOfEquationsObject)
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
+
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
+
+                    // Moved into the returned NumPy array, without a copy
+                    return aNumericalSolver.integrateTime(aStateVector, aStartTime, aTimeVector, systemOfEquations);
+                },
+                arg("state_vector"),
+                arg("start_time"),
+                arg("times"),
+                arg("system_of_equations")
+            )
+
+            .def(
+                "integrate_time",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::StateVector& aStateVector,
+                    const Real& aStartTime,
+                    const Real& anEndTime,
+                    const object& aSystemOfEquationsObject,
+                    const Array<EventCondition>& anEventConditionArray)
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
+
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
+
+                    return aNumericalSolver.integrateTime(
+                        aStateVector, aStartTime, anEndTime, systemOfEquations, anEventConditionArray
+                    );
+                },
+                arg("state_vector"),
+                arg("start_time"),
+                arg("end_time"),
+                arg("system_of_equations"),
+                arg("event_conditions")
+            )
+
+            .def(
+                "integrate_duration",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::StateVector& aStateVector,
+                    const Real& aDurationInSeconds,
+                    const object& aSystemOfEquationsObject,
+                    const Array<EventCondition>& anEventConditionArray)
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
+
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
+
+                    return aNumericalSolver.integrateDuration(
+                        aStateVector, aDurationInSeconds, systemOfEquations, anEventConditionArray
+                    );
+                },
+                arg("state_vector"),
+                arg("duration_in_seconds"),
+                arg("system_of_equations"),
+                arg("event_conditions")
+            )
+
+            .def(
+                "integrate_dense_time",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::StateVector& aStateVector,
+                    const Real& aStartTime,
+                    const Real& anEndTime,
+                    const object& aSystemOfEquationsObject)
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
+
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
+
+                    return aNumericalSolver.integrateDenseTime(aStateVector, aStartTime, anEndTime, systemOfEquations);
+                },
+                arg("state_vector"),
+                arg("start_time"),
+                arg("end_time"),
+                arg("system_of_equations")
+            )
+
+            .def(
+                "integrate_dense_duration",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::StateVector& aStateVector,
+                    const Real& aDurationInSeconds,
+                    const object& aSystemOfEquationsObject)
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
+
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
+
+                    return aNumericalSolver.integrateDenseDuration(aStateVector, aDurationInSeconds, systemOfEquations);
+                },
+                arg("state_vector"),
+                arg("duration_in_seconds"),
+                arg("system_of_equations")
+            )
+
+            .def(
+                "integrate_ensemble_duration",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::EnsembleState& anEnsembleState,
+                    const Real& aDurationInSeconds,
+                    const object& anEnsembleSystemOfEquationsObject,
+                    const NumericalSolver::EnsembleStepControl& anEnsembleStepControl)
                 {
                     const auto pythonDynamicsEquation =
-                        pybind11::cast<pythonSystemOfEquationsSignature>(aSystemOfEquationsObject);
+                        pybind11::cast<pythonEnsembleSystemOfEquationsSignature>(anEnsembleSystemOfEquationsObject);
 
-                    const NumericalSolver::SystemOfEquationsWrapper& systemOfEquations =
-                        [&](const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
-                        ) -> void
+                    const NumericalSolver::EnsembleSystemOfEquationsWrapper& ensembleSystemOfEquations =
+                        [&](const NumericalSolver::EnsembleState& x,
+                            NumericalSolver::EnsembleState& dxdt,
+                            const double t) -> void
                     {
                         dxdt = pythonDynamicsEquation(x, dxdt, t);
                     };
 
-                    return aNumericalSolver.integrateTime(aStateVector, aStartTime, aTimeArray, systemOfEquations);
-                }
+                    return aNumericalSolver.integrateEnsembleDuration(
+                        anEnsembleState, aDurationInSeconds, ensembleSystemOfEquations, anEnsembleStepControl
+                    );
+                },
+                arg("ensemble_state"),
+                arg("duration_in_seconds"),
+                arg("system_of_equations"),
+                arg("ensemble_step_control") = NumericalSolver::EnsembleStepControl::Shared
+            )
+
+            .def(
+                "integrate_ensemble_time",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::EnsembleState& anEnsembleState,
+                    const Real& aStartTime,
+                    const Real& anEndTime,
+                    const object& anEnsembleSystemOfEquationsObject,
+                    const NumericalSolver::EnsembleStepControl& anEnsembleStepControl)
+                {
+                    const auto pythonDynamicsEquation =
+                        pybind11::cast<pythonEnsembleSystemOfEquationsSignature>(anEnsembleSystemOfEquationsObject);
+
+                    const NumericalSolver::EnsembleSystemOfEquationsWrapper& ensembleSystemOfEquations =
+                        [&](const NumericalSolver::EnsembleState& x,
+                            NumericalSolver::EnsembleState& dxdt,
+                            const double t) -> void
+                    {
+                        dxdt = pythonDynamicsEquation(x, dxdt, t);
+                    };
+
+                    return aNumericalSolver.integrateEnsembleTime(
+                        anEnsembleState, aStartTime, anEndTime, ensembleSystemOfEquations, anEnsembleStepControl
+                    );
+                },
+                arg("ensemble_state"),
+                arg("start_time"),
+                arg("end_time"),
+                arg("system_of_equations"),
+                arg("ensemble_step_control") = NumericalSolver::EnsembleStepControl::Shared
+            )
+
+            .def(
+                "integrate_variational_duration",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::StateVector& aStateVector,
+                    const Real& aDurationInSeconds,
+                    const object& aSystemOfEquationsObject,
+                    const Real& aStateTransitionMatrixErrorWeight)
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
+
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
+
+                    return aNumericalSolver.integrateVariationalDuration(
+                        aStateVector, aDurationInSeconds, systemOfEquations, aStateTransitionMatrixErrorWeight
+                    );
+                },
+                arg("state_vector"),
+                arg("duration_in_seconds"),
+                arg("system_of_equations"),
+                arg("state_transition_matrix_error_weight") = 1.0
+            )
+
+            .def(
+                "integrate_variational_time",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::StateVector& aStateVector,
+                    const Real& aStartTime,
+                    const Real& anEndTime,
+                    const object& aSystemOfEquationsObject,
+                    const Real& aStateTransitionMatrixErrorWeight)
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        PyCastSystemOfEquations(aSystemOfEquationsObject);
+
+                    const PySystemOfEquationsGilRelease gilRelease(aSystemOfEquationsObject);
+
+                    return aNumericalSolver.integrateVariationalTime(
+                        aStateVector, aStartTime, anEndTime, systemOfEquations, aStateTransitionMatrixErrorWeight
+                    );
+                },
+                arg("state_vector"),
+                arg("start_time"),
+                arg("end_time"),
+                arg("system_of_equations"),
+                arg("state_transition_matrix_error_weight") = 1.0
             )
 
             .def_static("string_from_stepper_type", &NumericalSolver::StringFromStepperType, arg("stepper_type"))
             .def_static("string_from_log_type", &NumericalSolver::StringFromLogType, arg("log_type"))
+            .def_static(
+                "string_from_ensemble_step_control",
+                &NumericalSolver::StringFromEnsembleStepControl,
+                arg("ensemble_step_control")
+            )
             .def_static("default", &NumericalSolver::Default)
             .def_static("undefined", &NumericalSolver::Undefined)
 
@@ -151,6 +500,11 @@ inline void OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(pybind11::modul
             .value("RungeKuttaCashKarp54", NumericalSolver::StepperType::RungeKuttaCashKarp54)
             .value("RungeKuttaFehlberg78", NumericalSolver::StepperType::RungeKuttaFehlberg78)
             .value("RungeKuttaDopri5", NumericalSolver::StepperType::RungeKuttaDopri5)
+            .value("Rosenbrock4", NumericalSolver::StepperType::Rosenbrock4)
+            .value("BackwardDifferentiationFormula", NumericalSolver::StepperType::BackwardDifferentiationFormula)
+            .value("VelocityVerlet", NumericalSolver::StepperType::VelocityVerlet)
+            .value("Yoshida4", NumericalSolver::StepperType::Yoshida4)
+            .value("AdamsBashforthMoulton8", NumericalSolver::StepperType::AdamsBashforthMoulton8)
 
             ;
 
@@ -160,6 +514,75 @@ inline void OpenSpaceToolkitMathematicsPy_Solver_NumericalSolver(pybind11::modul
             .value("LogConstant", NumericalSolver::LogType::LogConstant)
             .value("LogAdaptive", NumericalSolver::LogType::LogAdaptive)
 
+            ;
+
+        class_<NumericalSolver::ConditionSolution>(numericalSolver, "ConditionSolution")
+
+            .def_readonly("solution", &NumericalSolver::ConditionSolution::solution)
+            .def_readonly("event_solutions", &NumericalSolver::ConditionSolution::eventSolutions)
+            .def_readonly("condition_is_satisfied", &NumericalSolver::ConditionSolution::conditionIsSatisfied)
+
+            ;
+
+        class_<NumericalSolver::VariationalSolution>(numericalSolver, "VariationalSolution")
+
+            .def_readonly("state", &NumericalSolver::VariationalSolution::state)
+            .def_readonly("state_transition_matrix", &NumericalSolver::VariationalSolution::stateTransitionMatrix)
+            .def_readonly("time", &NumericalSolver::VariationalSolution::time)
+
+            ;
+
+        class_<NumericalSolver::Statistics>(numericalSolver, "Statistics")
+
+            .def_readonly(
+                "system_of_equations_call_count", &NumericalSolver::Statistics::systemOfEquationsCallCount
+            )
+            .def_readonly("accepted_step_count", &NumericalSolver::Statistics::acceptedStepCount)
+            .def_readonly("rejected_step_count", &NumericalSolver::Statistics::rejectedStepCount)
+            .def_readonly("minimum_step_size", &NumericalSolver::Statistics::minimumStepSize)
+            .def_readonly("maximum_step_size", &NumericalSolver::Statistics::maximumStepSize)
+            .def_readonly("mean_step_size", &NumericalSolver::Statistics::meanStepSize)
+            .def_readonly("wall_time", &NumericalSolver::Statistics::wallTime)
+
+            ;
+
+        class_<PyInPlaceSystemOfEquations>(numericalSolver, "InPlaceSystemOfEquations")
+
+            .def(
+                init(
+                    [](const object& aFunction)
+                    {
+                        return PyInPlaceSystemOfEquations {aFunction};
+                    }
+                ),
+                arg("function")
+            )
+
+            .def_readonly("function", &PyInPlaceSystemOfEquations::function)
+
+            ;
+
+        class_<PyCompiledSystemOfEquations>(numericalSolver, "CompiledSystemOfEquations")
+
+            .def(
+                init(
+                    [](const std::uintptr_t anAddress)
+                    {
+                        return PyCompiledSystemOfEquations {anAddress};
+                    }
+                ),
+                arg("address")
+            )
+
+            .def_readonly("address", &PyCompiledSystemOfEquations::address)
+
+            ;
+
+        enum_<NumericalSolver::EnsembleStepControl>(numericalSolver, "EnsembleStepControl")
+
+            .value("Shared", NumericalSolver::EnsembleStepControl::Shared)
+            .value("PerMember", NumericalSolver::EnsembleStepControl::PerMember)
+
             ;
     }
 }
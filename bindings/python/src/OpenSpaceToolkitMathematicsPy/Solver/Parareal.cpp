@@ -0,0 +1,119 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Mathematics/Solver/Parareal.hpp>
+
+inline void OpenSpaceToolkitMathematicsPy_Solver_Parareal(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::solver::NumericalSolver;
+    using ostk::mathematics::solver::Parareal;
+
+    // The system of equations is called from worker threads: the GIL is released for the whole integration, Python
+    // callables reacquiring it on each call, and in place systems of equations (sharing their NumPy buffers) are
+    // rejected
+
+    const auto castSystemOfEquations = [](const object& aSystemOfEquationsObject
+                                       ) -> NumericalSolver::SystemOfEquationsWrapper
+    {
+        if (isinstance<PyInPlaceSystemOfEquations>(aSystemOfEquationsObject))
+        {
+            throw ostk::core::error::RuntimeError("In place systems of equations are not supported by Parareal.");
+        }
+
+        return PyCastSystemOfEquations(aSystemOfEquationsObject);
+    };
+
+    {
+        class_<Parareal> parareal(aModule, "Parareal");
+
+        parareal
+
+            .def(
+                init<
+                    const NumericalSolver&,
+                    const NumericalSolver&,
+                    const Size&,
+                    const Real&,
+                    const Size&,
+                    const Size&>(),
+                arg("coarse_solver"),
+                arg("fine_solver"),
+                arg("slice_count"),
+                arg("tolerance"),
+                arg("maximum_iteration_count"),
+                arg("thread_count") = 0
+            )
+
+            .def("__str__", &(shiftToString<Parareal>))
+            .def("__repr__", &(shiftToString<Parareal>))
+
+            .def("is_defined", &Parareal::isDefined)
+
+            .def("get_slice_count", &Parareal::getSliceCount)
+            .def("get_tolerance", &Parareal::getTolerance)
+            .def("get_maximum_iteration_count", &Parareal::getMaximumIterationCount)
+            .def("get_statistics", &Parareal::getStatistics)
+
+            .def(
+                "integrate_time",
+                [castSystemOfEquations](
+                    Parareal& aParareal,
+                    const NumericalSolver::StateVector& aStateVector,
+                    const Real& aStartTime,
+                    const Real& anEndTime,
+                    const object& aSystemOfEquationsObject
+                )
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        castSystemOfEquations(aSystemOfEquationsObject);
+
+                    gil_scoped_release gilRelease;
+
+                    return aParareal.integrateTime(aStateVector, aStartTime, anEndTime, systemOfEquations);
+                },
+                arg("state_vector"),
+                arg("start_time"),
+                arg("end_time"),
+                arg("system_of_equations")
+            )
+            .def(
+                "integrate_duration",
+                [castSystemOfEquations](
+                    Parareal& aParareal,
+                    const NumericalSolver::StateVector& aStateVector,
+                    const Real& aDurationInSeconds,
+                    const object& aSystemOfEquationsObject
+                )
+                {
+                    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+                        castSystemOfEquations(aSystemOfEquationsObject);
+
+                    gil_scoped_release gilRelease;
+
+                    return aParareal.integrateDuration(aStateVector, aDurationInSeconds, systemOfEquations);
+                },
+                arg("state_vector"),
+                arg("duration_in_seconds"),
+                arg("system_of_equations")
+            )
+
+            .def_static("undefined", &Parareal::Undefined)
+
+            ;
+
+        class_<Parareal::Statistics>(parareal, "Statistics")
+
+            .def_readonly("iteration_count", &Parareal::Statistics::iterationCount)
+            .def_readonly("is_converged", &Parareal::Statistics::isConverged)
+            .def_readonly("correction", &Parareal::Statistics::correction)
+            .def_readonly("wall_time", &Parareal::Statistics::wallTime)
+            .def_readonly("serial_fine_time", &Parareal::Statistics::serialFineTime)
+            .def_readonly("speedup", &Parareal::Statistics::speedup)
+
+            ;
+    }
+}
@@ -0,0 +1,43 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.curve_fitting import Interpolator
+from ostk.mathematics.curve_fitting.interpolator import Hermite
+
+
+@pytest.fixture
+def x() -> np.ndarray:
+    return np.linspace(0.0, 2.0 * np.pi, 13)
+
+
+@pytest.fixture
+def interpolator(x: np.ndarray) -> Hermite:
+    return Hermite(x=x, y=np.cos(x), dy_dx=-np.sin(x))
+
+
+class TestHermite:
+    def test_constructor_success(self, interpolator: Hermite):
+        assert interpolator is not None
+        assert isinstance(interpolator, Interpolator)
+        assert isinstance(interpolator, Hermite)
+        assert interpolator.get_interpolation_type() == Interpolator.Type.Hermite
+        assert interpolator.get_degree() == 3
+
+    def test_constructor_quintic(self, x: np.ndarray):
+        interpolator = Hermite(x=x, y=np.cos(x), dy_dx=-np.sin(x), d2y_dx2=-np.cos(x))
+
+        assert interpolator.get_degree() == 5
+
+    def test_constructor_failure(self, x: np.ndarray):
+        with pytest.raises(RuntimeError):
+            Hermite(x=x, y=np.cos(x), dy_dx=-np.sin(x[:-1]))
+
+    def test_evaluate(self, x: np.ndarray, interpolator: Hermite):
+        query = np.linspace(0.0, 2.0 * np.pi, 100)
+
+        assert interpolator.evaluate(x) == pytest.approx(np.cos(x), abs=1e-14)
+        assert interpolator.evaluate(query) == pytest.approx(np.cos(query), abs=2e-3)
+        assert interpolator.evaluate(1.0) == pytest.approx(np.cos(1.0), abs=2e-3)
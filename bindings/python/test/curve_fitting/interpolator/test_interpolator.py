@@ -2,6 +2,8 @@
 
 import pytest
 
+import numpy as np
+
 from ostk.mathematics.curve_fitting import Interpolator
 
 
@@ -47,11 +49,26 @@ class TestInterpolator:
                 [0.0, 1.0, 2.0, 3.0, 4.0, 5.0],
                 [0.0, 3.0, 6.0, 9.0, 17.0, 5.0],
             ),
+            (
+                Interpolator.Type.Lagrange,
+                [0.0, 1.0, 2.0, 4.0, 5.0, 6.0],
+                [0.0, 3.0, 6.0, 9.0, 17.0, 5.0],
+            ),
             (
                 Interpolator.Type.Linear,
                 [0.0, 1.0, 2.0, 4.0, 5.0, 6.0],
                 [0.0, 3.0, 6.0, 9.0, 17.0, 5.0],
             ),
+            (
+                Interpolator.Type.NonUniformCubicSpline,
+                [0.0, 1.0, 2.0, 4.0, 5.0, 6.0],
+                [0.0, 3.0, 6.0, 9.0, 17.0, 5.0],
+            ),
+            (
+                Interpolator.Type.Streaming,
+                [0.0, 1.0, 2.0, 4.0, 5.0, 6.0],
+                [0.0, 3.0, 6.0, 9.0, 17.0, 5.0],
+            ),
         ],
     )
     def test_generate_interpolators(
@@ -69,3 +86,90 @@ class TestInterpolator:
         assert interpolator is not None
         assert isinstance(interpolator, Interpolator)
         assert interpolator.get_interpolation_type() == parametrized_interpolation_type
+
+    @pytest.mark.parametrize(
+        "parametrized_interpolation_type",
+        [
+            Interpolator.Type.BarycentricRational,
+            Interpolator.Type.CubicSpline,
+            Interpolator.Type.Lagrange,
+            Interpolator.Type.Linear,
+            Interpolator.Type.NonUniformCubicSpline,
+            Interpolator.Type.Streaming,
+        ],
+    )
+    def test_evaluate_derivative(
+        self,
+        parametrized_interpolation_type: Interpolator.Type,
+    ):
+        x = np.linspace(0.0, 1.0, 11)
+        y = 2.0 * x + 1.0
+
+        interpolator: Interpolator = Interpolator.generate_interpolator(
+            interpolation_type=parametrized_interpolation_type,
+            x=x,
+            y=y,
+        )
+
+        assert interpolator.evaluate_derivative(0.55) == pytest.approx(2.0, abs=1e-9)
+        assert interpolator.evaluate_derivative(
+            np.array([0.25, 0.55]), order=1
+        ) == pytest.approx([2.0, 2.0], abs=1e-9)
+        assert interpolator.evaluate_derivative(0.55, order=0) == pytest.approx(
+            2.1, abs=1e-9
+        )
+
+        value_and_derivatives = interpolator.evaluate_with_derivatives(
+            0.55, maximum_order=1
+        )
+
+        assert value_and_derivatives == pytest.approx([2.1, 2.0], abs=1e-9)
+
+        values_and_derivatives = interpolator.evaluate_with_derivatives(
+            np.array([0.25, 0.55]), maximum_order=1
+        )
+
+        assert values_and_derivatives.shape == (2, 2)
+
+    @pytest.mark.parametrize(
+        "parametrized_interpolation_type",
+        [
+            Interpolator.Type.BarycentricRational,
+            Interpolator.Type.CubicSpline,
+            Interpolator.Type.Lagrange,
+            Interpolator.Type.Linear,
+            Interpolator.Type.NonUniformCubicSpline,
+            Interpolator.Type.Streaming,
+        ],
+    )
+    def test_evaluate_parallel(
+        self,
+        parametrized_interpolation_type: Interpolator.Type,
+    ):
+        x = np.linspace(0.0, 1.0, 11)
+        y = np.sin(x)
+
+        interpolator: Interpolator = Interpolator.generate_interpolator(
+            interpolation_type=parametrized_interpolation_type,
+            x=x,
+            y=y,
+        )
+
+        query_x = np.linspace(-0.5, 1.5, 100001)
+
+        expected_y = interpolator.evaluate(query_x)
+
+        assert np.array_equal(interpolator.evaluate_parallel(query_x), expected_y)
+        assert np.array_equal(
+            interpolator.evaluate_parallel(query_x, thread_count=2), expected_y
+        )
+
+        values = np.empty_like(query_x)
+        interpolator.evaluate_parallel(query_x, values, thread_count=2)
+
+        assert np.array_equal(values, expected_y)
+
+        values = np.empty_like(query_x)
+        interpolator.evaluate(query_x, values)
+
+        assert np.array_equal(values, expected_y)
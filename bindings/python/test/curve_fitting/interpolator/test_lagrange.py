@@ -0,0 +1,41 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.curve_fitting import Interpolator
+from ostk.mathematics.curve_fitting.interpolator import Lagrange
+
+
+@pytest.fixture
+def x() -> np.ndarray:
+    return np.linspace(0.0, 10.0, 1001)
+
+
+@pytest.fixture
+def interpolator(x: np.ndarray) -> Lagrange:
+    return Lagrange(x=x, y=np.sin(x))
+
+
+class TestLagrange:
+    def test_constructor_success(self, interpolator: Lagrange):
+        assert interpolator is not None
+        assert isinstance(interpolator, Interpolator)
+        assert isinstance(interpolator, Lagrange)
+        assert interpolator.get_interpolation_type() == Interpolator.Type.Lagrange
+        assert interpolator.get_point_count() == 8
+
+    def test_constructor_point_count(self, x: np.ndarray):
+        assert Lagrange(x=x, y=np.sin(x), point_count=11).get_point_count() == 11
+
+    def test_constructor_failure(self, x: np.ndarray):
+        with pytest.raises(RuntimeError):
+            Lagrange(x=x[:4], y=np.sin(x[:4]), point_count=8)
+
+    def test_evaluate(self, x: np.ndarray, interpolator: Lagrange):
+        query = np.linspace(0.005, 9.995, 100)
+
+        assert interpolator.evaluate(x) == pytest.approx(np.sin(x), abs=1e-15)
+        assert interpolator.evaluate(query) == pytest.approx(np.sin(query), abs=1e-12)
+        assert interpolator.evaluate(1.0) == pytest.approx(np.sin(1.0), abs=1e-12)
@@ -0,0 +1,47 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.curve_fitting import Interpolator
+from ostk.mathematics.curve_fitting.interpolator import LagrangeHermite
+
+
+@pytest.fixture
+def x() -> np.ndarray:
+    return np.linspace(0.0, 2.0 * np.pi, 13)
+
+
+@pytest.fixture
+def interpolator(x: np.ndarray) -> LagrangeHermite:
+    return LagrangeHermite(x=x, y=np.cos(x), dy_dx=-np.sin(x))
+
+
+class TestLagrangeHermite:
+    def test_constructor_success(self, interpolator: LagrangeHermite):
+        assert interpolator is not None
+        assert isinstance(interpolator, Interpolator)
+        assert isinstance(interpolator, LagrangeHermite)
+        assert (
+            interpolator.get_interpolation_type() == Interpolator.Type.LagrangeHermite
+        )
+        assert interpolator.get_point_count() == 4
+
+    def test_constructor_point_count(self, x: np.ndarray):
+        interpolator = LagrangeHermite(
+            x=x, y=np.cos(x), dy_dx=-np.sin(x), point_count=6
+        )
+
+        assert interpolator.get_point_count() == 6
+
+    def test_constructor_failure(self, x: np.ndarray):
+        with pytest.raises(RuntimeError):
+            LagrangeHermite(x=x, y=np.cos(x), dy_dx=-np.sin(x), point_count=1)
+
+    def test_evaluate(self, x: np.ndarray, interpolator: LagrangeHermite):
+        query = np.linspace(0.0, 2.0 * np.pi, 100)
+
+        assert interpolator.evaluate(x) == pytest.approx(np.cos(x), abs=1e-14)
+        assert interpolator.evaluate(query) == pytest.approx(np.cos(query), abs=1e-6)
+        assert interpolator.evaluate(1.0) == pytest.approx(np.cos(1.0), abs=1e-6)
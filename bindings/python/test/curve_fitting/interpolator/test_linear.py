@@ -2,6 +2,8 @@
 
 import pytest
 
+import numpy as np
+
 from ostk.mathematics.curve_fitting import Interpolator
 from ostk.mathematics.curve_fitting.interpolator import Linear
 
@@ -33,3 +35,22 @@ class TestLinear:
             interpolator.evaluate(x=[0.0, 1.0, 2.0, 4.0, 5.0, 6.0])
             == [0.0, 3.0, 6.0, 9.0, 17.0, 5.0]
         ).all()
+
+    def test_evaluate_in_place(self, interpolator: Linear):
+        x: np.ndarray = np.array([-1.0, 0.5, 3.0, 4.5, 7.0])
+        expected_y: np.ndarray = np.array([0.0, 1.5, 7.5, 13.0, 5.0])
+
+        y: np.ndarray = np.zeros(5)
+        interpolator.evaluate(x=x, y=y)
+
+        assert pytest.approx(y) == expected_y
+
+        y = np.zeros(5)
+        interpolator.evaluate_sorted(x=x, y=y)
+
+        assert pytest.approx(y) == expected_y
+
+        y = np.zeros(5)
+        interpolator.evaluate(x=x[::-1], y=y)
+
+        assert pytest.approx(y) == expected_y[::-1]
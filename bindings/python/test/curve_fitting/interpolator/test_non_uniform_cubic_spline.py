@@ -0,0 +1,84 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.curve_fitting import Interpolator
+from ostk.mathematics.curve_fitting.interpolator import NonUniformCubicSpline
+
+
+def cubic(x):
+    return 2.0 - 1.5 * x + 0.7 * x**2 - 0.3 * x**3
+
+
+@pytest.fixture
+def x() -> np.ndarray:
+    return np.array([0.0, 0.1, 0.35, 0.5, 1.2, 1.3, 2.1, 3.0])
+
+
+@pytest.fixture
+def interpolator(x: np.ndarray) -> NonUniformCubicSpline:
+    return NonUniformCubicSpline(x=x, y=cubic(x))
+
+
+class TestNonUniformCubicSpline:
+    def test_constructor_success(self, interpolator: NonUniformCubicSpline):
+        assert interpolator is not None
+        assert isinstance(interpolator, Interpolator)
+        assert isinstance(interpolator, NonUniformCubicSpline)
+        assert (
+            interpolator.get_interpolation_type()
+            == Interpolator.Type.NonUniformCubicSpline
+        )
+        assert (
+            interpolator.get_boundary_condition()
+            == NonUniformCubicSpline.BoundaryCondition.NotAKnot
+        )
+
+    def test_constructor_boundary_condition(self, x: np.ndarray):
+        interpolator = NonUniformCubicSpline(
+            x=x,
+            y=cubic(x),
+            boundary_condition=NonUniformCubicSpline.BoundaryCondition.Natural,
+        )
+
+        assert (
+            interpolator.get_boundary_condition()
+            == NonUniformCubicSpline.BoundaryCondition.Natural
+        )
+
+    def test_constructor_clamped(self, x: np.ndarray):
+        interpolator = NonUniformCubicSpline(
+            x=x,
+            y=cubic(x),
+            start_derivative=-1.5,
+            end_derivative=-1.5 + 1.4 * 3.0 - 0.9 * 9.0,
+        )
+
+        assert (
+            interpolator.get_boundary_condition()
+            == NonUniformCubicSpline.BoundaryCondition.Clamped
+        )
+
+        query = np.linspace(0.0, 3.0, 50)
+
+        assert interpolator.evaluate(query) == pytest.approx(cubic(query), abs=1e-12)
+
+    def test_constructor_failure(self):
+        with pytest.raises(RuntimeError):
+            NonUniformCubicSpline(x=[0.0, 2.0, 1.0, 3.0], y=[0.0, 1.0, 2.0, 3.0])
+
+    def test_evaluate(self, interpolator: NonUniformCubicSpline):
+        query = np.linspace(-0.5, 3.5, 50)
+
+        assert interpolator.evaluate(query) == pytest.approx(cubic(query), abs=1e-12)
+        assert interpolator.evaluate(1.7) == pytest.approx(cubic(1.7), abs=1e-12)
+
+    def test_string_from_boundary_condition(self):
+        assert (
+            NonUniformCubicSpline.string_from_boundary_condition(
+                NonUniformCubicSpline.BoundaryCondition.Clamped
+            )
+            == "Clamped"
+        )
@@ -0,0 +1,80 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.curve_fitting import Interpolator
+from ostk.mathematics.curve_fitting.interpolator import Streaming
+
+
+def quadratic(x):
+    return 2.0 - 1.5 * x + 0.7 * x**2
+
+
+@pytest.fixture
+def x() -> np.ndarray:
+    return np.array([0.0, 0.1, 0.35, 0.5, 1.2, 1.3, 2.1, 3.0])
+
+
+@pytest.fixture
+def interpolator(x: np.ndarray) -> Streaming:
+    return Streaming(x=x, y=quadratic(x))
+
+
+class TestStreaming:
+    def test_constructor_success(self, interpolator: Streaming):
+        assert interpolator is not None
+        assert isinstance(interpolator, Interpolator)
+        assert isinstance(interpolator, Streaming)
+        assert interpolator.get_interpolation_type() == Interpolator.Type.Streaming
+        assert interpolator.is_defined()
+        assert interpolator.get_size() == 8
+        assert interpolator.get_capacity() == 0
+
+    def test_constructor_capacity(self, x: np.ndarray):
+        interpolator = Streaming(x=x, y=quadratic(x), capacity=3)
+
+        assert interpolator.get_size() == 3
+        assert interpolator.get_capacity() == 3
+        assert np.array_equal(interpolator.get_x(), x[-3:])
+        assert np.array_equal(interpolator.get_y(), quadratic(x[-3:]))
+
+    def test_constructor_failure(self, x: np.ndarray):
+        with pytest.raises(RuntimeError):
+            Streaming(capacity=1)
+
+        with pytest.raises(RuntimeError):
+            Streaming(x=x[::-1], y=quadratic(x))
+
+    def test_append(self, x: np.ndarray):
+        interpolator = Streaming(capacity=4)
+
+        assert not interpolator.is_defined()
+
+        for x_value in x:
+            interpolator.append(x=x_value, y=quadratic(x_value))
+
+        assert interpolator.get_size() == 4
+        assert np.array_equal(interpolator.get_x(), x[-4:])
+
+        interpolator.append(x=np.array([3.5, 4.0]), y=quadratic(np.array([3.5, 4.0])))
+
+        assert np.array_equal(interpolator.get_x(), [2.1, 3.0, 3.5, 4.0])
+
+        with pytest.raises(RuntimeError):
+            interpolator.append(x=1.0, y=0.0)
+
+        interpolator.clear()
+
+        assert interpolator.get_size() == 0
+
+    def test_evaluate(self, x: np.ndarray, interpolator: Streaming):
+        query = np.linspace(-0.5, 3.5, 101)
+
+        assert interpolator.evaluate(x) == pytest.approx(quadratic(x), abs=1e-14)
+        assert interpolator.evaluate(query) == pytest.approx(
+            quadratic(query), abs=1e-12
+        )
+        assert interpolator.evaluate(1.0) == pytest.approx(quadratic(1.0), abs=1e-12)
+        assert interpolator.evaluate_derivative(1.0) == pytest.approx(-0.1, abs=1e-12)
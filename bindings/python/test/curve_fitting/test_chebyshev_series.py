@@ -0,0 +1,81 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.curve_fitting import ChebyshevSeries
+
+
+@pytest.fixture
+def x() -> np.ndarray:
+    return np.linspace(0.0, 10.0, 2001)
+
+
+@pytest.fixture
+def y(x: np.ndarray) -> np.ndarray:
+    return np.column_stack((np.sin(x), np.exp(0.3 * x)))
+
+
+@pytest.fixture
+def chebyshev_series() -> ChebyshevSeries:
+    return ChebyshevSeries(
+        breakpoints=np.array([0.0, 2.0, 3.0]),
+        coefficients=[
+            np.array([[1.0, 0.0], [2.0, 0.0], [3.0, 0.0], [0.0, 1.0]]),
+            np.array([[1.0, 1.0], [-1.0, 0.0]]),
+        ],
+    )
+
+
+class TestChebyshevSeries:
+    def test_constructor_success(self, chebyshev_series: ChebyshevSeries):
+        assert chebyshev_series is not None
+        assert isinstance(chebyshev_series, ChebyshevSeries)
+        assert chebyshev_series.get_segment_count() == 2
+        assert chebyshev_series.get_component_count() == 2
+        assert np.array_equal(chebyshev_series.get_breakpoints(), [0.0, 2.0, 3.0])
+        assert len(chebyshev_series.get_coefficients()) == 2
+
+    def test_constructor_failure(self):
+        with pytest.raises(RuntimeError):
+            ChebyshevSeries(
+                breakpoints=np.array([0.0, 2.0]),
+                coefficients=[np.ones((2, 1)), np.ones((2, 1))],
+            )
+
+    def test_evaluate(self, chebyshev_series: ChebyshevSeries):
+        assert chebyshev_series.evaluate(1.5) == pytest.approx(
+            [-2.0 + 1.0 + 1.5, 0.5 - 1.5], abs=1e-14
+        )
+        assert chebyshev_series.evaluate(np.array([1.5, 2.5])) == pytest.approx(
+            np.array([[0.5, -1.0], [1.0, 1.0]]), abs=1e-14
+        )
+
+        with pytest.raises(RuntimeError):
+            chebyshev_series.evaluate(3.5)
+
+    def test_evaluate_derivative(self, chebyshev_series: ChebyshevSeries):
+        assert chebyshev_series.evaluate_derivative(1.5) == pytest.approx(
+            [8.0, 0.0], abs=1e-13
+        )
+        assert chebyshev_series.evaluate_derivative(1.5, order=2) == pytest.approx(
+            [12.0, 12.0], abs=1e-13
+        )
+        assert chebyshev_series.evaluate_derivative(
+            np.array([1.5, 2.5])
+        ) == pytest.approx(np.array([[8.0, 0.0], [-2.0, 0.0]]), abs=1e-13)
+
+    def test_fit(self, x: np.ndarray, y: np.ndarray):
+        chebyshev_series = ChebyshevSeries.fit(x=x, y=y, degree=14, segment_count=4)
+
+        assert chebyshev_series.get_segment_count() == 4
+        assert chebyshev_series.evaluate(x) == pytest.approx(y, abs=1e-10)
+
+    def test_fit_adaptive(self, x: np.ndarray, y: np.ndarray):
+        chebyshev_series = ChebyshevSeries.fit_adaptive(
+            x=x, y=y, degree=8, tolerance=1e-6
+        )
+
+        assert chebyshev_series.get_segment_count() > 1
+        assert np.abs(chebyshev_series.evaluate(x) - y).max() <= 1e-6
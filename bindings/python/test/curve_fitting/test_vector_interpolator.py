@@ -0,0 +1,61 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.curve_fitting import Interpolator
+from ostk.mathematics.curve_fitting import VectorInterpolator
+
+
+@pytest.fixture
+def x() -> np.ndarray:
+    return np.linspace(0.0, 10.0, 41)
+
+
+@pytest.fixture
+def y(x: np.ndarray) -> np.ndarray:
+    return np.column_stack((np.sin(x), np.cos(x), 0.1 * x**2))
+
+
+class TestVectorInterpolator:
+    def test_constructor_success(self, x: np.ndarray, y: np.ndarray):
+        vector_interpolator = VectorInterpolator(
+            interpolation_type=Interpolator.Type.CubicSpline, x=x, y=y
+        )
+
+        assert vector_interpolator is not None
+        assert isinstance(vector_interpolator, VectorInterpolator)
+        assert (
+            vector_interpolator.get_interpolation_type()
+            == Interpolator.Type.CubicSpline
+        )
+        assert vector_interpolator.get_component_count() == 3
+
+    @pytest.mark.parametrize(
+        "interpolation_type",
+        [
+            Interpolator.Type.Linear,
+            Interpolator.Type.CubicSpline,
+            Interpolator.Type.BarycentricRational,
+        ],
+    )
+    def test_evaluate(
+        self, interpolation_type: Interpolator.Type, x: np.ndarray, y: np.ndarray
+    ):
+        vector_interpolator = VectorInterpolator(interpolation_type, x, y)
+
+        query_x: np.ndarray = np.linspace(0.1, 9.9, 17)
+
+        values: np.ndarray = vector_interpolator.evaluate(query_x)
+
+        assert values.shape == (17, 3)
+
+        for j in range(3):
+            interpolator = Interpolator.generate_interpolator(
+                interpolation_type, x, y[:, j]
+            )
+
+            assert pytest.approx(interpolator.evaluate(query_x)) == values[:, j]
+
+        assert pytest.approx(vector_interpolator.evaluate(query_x[3])) == values[3, :]
@@ -0,0 +1,53 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.solver import DenseTrajectory
+
+
+@pytest.fixture
+def step_times() -> np.ndarray:
+    return np.array([0.0, 1.0, 3.0])
+
+
+@pytest.fixture
+def node_states(step_times: np.ndarray) -> np.ndarray:
+    node_times = np.concatenate(
+        [
+            np.linspace(step_times[0], step_times[1], 6)[:-1],
+            np.linspace(step_times[1], step_times[2], 6),
+        ]
+    )
+
+    return np.array([node_times**2, 1.0 - node_times])
+
+
+@pytest.fixture
+def dense_trajectory(step_times: np.ndarray, node_states: np.ndarray) -> DenseTrajectory:
+    return DenseTrajectory(step_times, node_states)
+
+
+class TestDenseTrajectory:
+    def test_constructor_success(self, dense_trajectory: DenseTrajectory):
+        assert dense_trajectory is not None
+        assert isinstance(dense_trajectory, DenseTrajectory)
+        assert dense_trajectory.is_defined()
+
+    def test_getters(self, dense_trajectory: DenseTrajectory):
+        assert dense_trajectory.get_step_count() == 2
+        assert dense_trajectory.get_state_dimension() == 2
+        assert dense_trajectory.get_start_time() == 0.0
+        assert dense_trajectory.get_end_time() == 3.0
+        assert dense_trajectory.get_step_times().shape == (3,)
+        assert dense_trajectory.get_node_states().shape == (2, 11)
+
+    def test_evaluate(self, dense_trajectory: DenseTrajectory):
+        assert np.allclose(dense_trajectory.evaluate(2.5), [6.25, -1.5])
+
+        times = np.array([0.5, 1.5, 2.5])
+        assert np.allclose(dense_trajectory.evaluate(times), [times**2, 1.0 - times])
+
+    def test_undefined(self):
+        assert DenseTrajectory.undefined().is_defined() is False
@@ -0,0 +1,44 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.mathematics.solver import EventCondition
+
+
+@pytest.fixture
+def event_condition() -> EventCondition:
+    return EventCondition(
+        "Crossing",
+        EventCondition.Criterion.PositiveCrossing,
+        lambda x, t: x[0] - t,
+    )
+
+
+class TestEventCondition:
+    def test_constructor_success(self, event_condition: EventCondition):
+        assert event_condition is not None
+        assert isinstance(event_condition, EventCondition)
+        assert event_condition.is_defined()
+
+    def test_getters(self, event_condition: EventCondition):
+        assert event_condition.get_name() == "Crossing"
+        assert event_condition.get_criterion() == EventCondition.Criterion.PositiveCrossing
+        assert event_condition.is_terminal()
+
+    def test_evaluate(self, event_condition: EventCondition):
+        assert event_condition.evaluate(np.array([3.0, 1.0]), 2.0) == 1.0
+
+    def test_is_satisfied(self, event_condition: EventCondition):
+        assert event_condition.is_satisfied(-1.0, 1.0)
+        assert not event_condition.is_satisfied(1.0, -1.0)
+
+    def test_string_from_criterion(self):
+        assert (
+            EventCondition.string_from_criterion(EventCondition.Criterion.AnyCrossing)
+            == "AnyCrossing"
+        )
+
+    def test_undefined(self):
+        assert EventCondition.undefined().is_defined() is False
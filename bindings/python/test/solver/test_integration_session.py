@@ -0,0 +1,75 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+import math
+
+from ostk.mathematics.solver import IntegrationSession
+from ostk.mathematics.solver import NumericalSolver
+
+
+def oscillator(x, dxdt, _):
+    dxdt[0] = x[1]
+    dxdt[1] = -x[0]
+    return dxdt
+
+
+def get_state_vec(time: float) -> np.ndarray:
+    return np.array([math.sin(time), math.cos(time)])
+
+
+@pytest.fixture
+def numerical_solver() -> NumericalSolver:
+    return NumericalSolver(
+        NumericalSolver.LogType.NoLog,
+        NumericalSolver.StepperType.RungeKuttaDopri5,
+        1e-3,
+        1.0e-12,
+        1.0e-12,
+    )
+
+
+@pytest.fixture
+def integration_session(numerical_solver: NumericalSolver) -> IntegrationSession:
+    return IntegrationSession(numerical_solver, get_state_vec(0.0), 0.0, oscillator)
+
+
+class TestIntegrationSession:
+    def test_constructor_success(self, integration_session: IntegrationSession):
+        assert integration_session is not None
+        assert isinstance(integration_session, IntegrationSession)
+        assert integration_session.is_defined()
+
+    def test_getters(self, integration_session: IntegrationSession):
+        assert np.array_equal(integration_session.get_state_vector(), get_state_vec(0.0))
+        assert integration_session.get_time() == 0.0
+        assert integration_session.get_time_step() == 1e-3
+        assert integration_session.get_statistics().accepted_step_count == 0
+
+    def test_advance(self, integration_session: IntegrationSession):
+        for hop_index in range(1, 21):
+            hop_time: float = 0.5 * hop_index
+
+            state_vector, time = integration_session.advance_to(hop_time)
+
+            assert time == hop_time
+            assert np.allclose(state_vector, get_state_vec(hop_time), atol=2e-8)
+
+        assert integration_session.get_time_step() > 1e-2
+
+        state_vector, time = integration_session.advance_by(-12.5)
+
+        assert time == -2.5
+        assert np.allclose(state_vector, get_state_vec(-2.5), atol=5e-8)
+
+    def test_reset(self, integration_session: IntegrationSession):
+        integration_session.advance_to(5.0)
+        integration_session.reset(get_state_vec(2.0), 5.0)
+
+        state_vector, _ = integration_session.advance_to(6.0)
+
+        assert np.allclose(state_vector, get_state_vec(3.0), atol=2e-8)
+
+    def test_undefined(self):
+        assert not IntegrationSession.undefined().is_defined()
@@ -4,7 +4,9 @@ import pytest
 
 import numpy as np
 import math
+import ctypes
 
+from ostk.mathematics.solver import EventCondition
 from ostk.mathematics.solver import NumericalSolver
 
 
@@ -14,6 +16,12 @@ def oscillator(x, dxdt, _):
     return dxdt
 
 
+def ensemble_oscillator(x, dxdt, _):
+    dxdt[0, :] = x[1, :]
+    dxdt[1, :] = -x[0, :]
+    return dxdt
+
+
 def get_state_vec(time: float) -> np.ndarray:
     return np.array([math.sin(time), math.cos(time)])
 
@@ -109,6 +117,18 @@ class TestNumericalSolver:
             )
             == "RungeKuttaFehlberg78"
         )
+        assert (
+            NumericalSolver.string_from_stepper_type(
+                NumericalSolver.StepperType.BackwardDifferentiationFormula
+            )
+            == "BackwardDifferentiationFormula"
+        )
+        assert (
+            NumericalSolver.string_from_stepper_type(
+                NumericalSolver.StepperType.AdamsBashforthMoulton8
+            )
+            == "AdamsBashforthMoulton8"
+        )
         assert (
             NumericalSolver.string_from_log_type(NumericalSolver.LogType.NoLog) == "NoLog"
         )
@@ -168,6 +188,318 @@ class TestNumericalSolver:
             assert 5e-9 >= abs(state_vector[0] - math.sin(end_time))
             assert 5e-9 >= abs(state_vector[1] - math.cos(end_time))
 
+    def test_observation_decimation(
+        self, numerical_solver: NumericalSolver, initial_state_vec: np.ndarray
+    ):
+        numerical_solver.set_observation_decimation(1, 1.0)
+
+        assert numerical_solver.get_observation_step_interval() == 1
+        assert numerical_solver.get_observation_minimum_time_separation() == 1.0
+
+        streamed_times: list[float] = []
+        numerical_solver.set_state_observer(lambda x, t: streamed_times.append(t))
+
+        numerical_solver.integrate_duration(initial_state_vec, 10.0, oscillator)
+
+        assert len(streamed_times) > 1
+        assert np.all(np.diff(streamed_times) >= 1.0)
+        assert len(numerical_solver.get_observed_state_vectors()) == 0
+
+        numerical_solver.set_state_observer(None)
+
+        numerical_solver.integrate_duration(initial_state_vec, 10.0, oscillator)
+
+        assert len(numerical_solver.get_observed_state_vectors()) == len(streamed_times)
+
+    def test_statistics(
+        self, numerical_solver: NumericalSolver, initial_state_vec: np.ndarray
+    ):
+        traced_steps: list[tuple[float, float, bool]] = []
+        numerical_solver.set_step_trace_hook(
+            lambda t, dt, is_accepted: traced_steps.append((t, dt, is_accepted))
+        )
+
+        numerical_solver.integrate_duration(initial_state_vec, 10.0, oscillator)
+
+        statistics: NumericalSolver.Statistics = numerical_solver.get_statistics()
+
+        assert statistics.system_of_equations_call_count > 0
+        assert statistics.accepted_step_count == (
+            len(numerical_solver.get_observed_state_vectors()) - 1
+        )
+        assert statistics.accepted_step_count == sum(
+            is_accepted for _, _, is_accepted in traced_steps
+        )
+        assert statistics.rejected_step_count == sum(
+            not is_accepted for _, _, is_accepted in traced_steps
+        )
+        assert (
+            statistics.minimum_step_size
+            <= statistics.mean_step_size
+            <= statistics.maximum_step_size
+        )
+        assert statistics.wall_time >= 0.0
+
+        numerical_solver.set_step_trace_hook(None)
+
+    def test_integrate_implicit(self):
+        system_matrix = np.array([[998.0, 1998.0], [-999.0, -1999.0]])
+
+        def stiff_system(x, dxdt, _):
+            dxdt = system_matrix @ x
+            return dxdt
+
+        def stiff_jacobian(x, _):
+            return system_matrix, np.zeros(2)
+
+        initial_state_vec = np.array([1.0, 0.0])
+        end_time: float = 10.0
+
+        for stepper_type in (
+            NumericalSolver.StepperType.Rosenbrock4,
+            NumericalSolver.StepperType.BackwardDifferentiationFormula,
+        ):
+            numerical_solver = NumericalSolver(
+                NumericalSolver.LogType.NoLog,
+                stepper_type,
+                1e-4,
+                1.0e-10,
+                1.0e-10,
+            )
+
+            for jacobian in (stiff_jacobian, None):
+                numerical_solver.set_jacobian(jacobian)
+
+                state_vector, _ = numerical_solver.integrate_time(
+                    initial_state_vec, 0.0, end_time, stiff_system
+                )
+
+                assert 1e-8 >= abs(state_vector[0] - 2.0 * math.exp(-end_time))
+                assert 1e-8 >= abs(state_vector[1] + math.exp(-end_time))
+
+    def test_integrate_time_matrix(
+        self, numerical_solver: NumericalSolver, initial_state_vec: np.ndarray
+    ):
+        times = np.linspace(1.0, 10.0, 10)
+
+        states: np.ndarray = numerical_solver.integrate_time_matrix(
+            initial_state_vec, 0.0, times, oscillator
+        )
+
+        assert states.shape == (2, 10)
+        assert np.allclose(states, np.array([np.sin(times), np.cos(times)]), atol=2e-8)
+
+    def test_integrate_in_place_system_of_equations(
+        self, numerical_solver: NumericalSolver, initial_state_vec: np.ndarray
+    ):
+        state_arrays: set[int] = set()
+
+        def in_place_oscillator(x, dxdt, _):
+            state_arrays.add(id(x))
+            dxdt[0] = x[1]
+            dxdt[1] = -x[0]
+
+        system_of_equations = NumericalSolver.InPlaceSystemOfEquations(
+            in_place_oscillator
+        )
+
+        integration_duration: float = 100.0
+
+        state_vector, time = numerical_solver.integrate_duration(
+            initial_state_vec, integration_duration, system_of_equations
+        )
+
+        assert time == integration_duration
+        assert np.allclose(
+            state_vector, get_state_vec(integration_duration), atol=1e-8
+        )
+
+        # The same (preallocated) array is passed at every call
+        assert len(state_arrays) == 1
+
+    def test_integrate_compiled_system_of_equations(
+        self, numerical_solver: NumericalSolver, initial_state_vec: np.ndarray
+    ):
+        # A ctypes callback stands in for a compiled function, such as a Numba cfunc
+        # (whose address is cfunc.address)
+        @ctypes.CFUNCTYPE(
+            None,
+            ctypes.POINTER(ctypes.c_double),
+            ctypes.POINTER(ctypes.c_double),
+            ctypes.c_double,
+            ctypes.c_int64,
+        )
+        def compiled_oscillator(x, dxdt, _, n):
+            assert n == 2
+            dxdt[0] = x[1]
+            dxdt[1] = -x[0]
+
+        system_of_equations = NumericalSolver.CompiledSystemOfEquations(
+            ctypes.cast(compiled_oscillator, ctypes.c_void_p).value
+        )
+
+        integration_duration: float = 100.0
+
+        for integrate in (
+            lambda: numerical_solver.integrate_duration(
+                initial_state_vec, integration_duration, system_of_equations
+            ),
+            lambda: numerical_solver.integrate_time(
+                initial_state_vec, 0.0, integration_duration, system_of_equations
+            ),
+        ):
+            state_vector, time = integrate()
+
+            assert time == integration_duration
+            assert np.allclose(
+                state_vector, get_state_vec(integration_duration), atol=1e-8
+            )
+
+    def test_integrate_variational(
+        self, numerical_solver: NumericalSolver, initial_state_vec: np.ndarray
+    ):
+        integration_duration: float = 5.0
+
+        expected_state_transition_matrix = np.array(
+            [
+                [math.cos(integration_duration), math.sin(integration_duration)],
+                [-math.sin(integration_duration), math.cos(integration_duration)],
+            ]
+        )
+
+        for state_transition_matrix_error_weight in (1.0, 0.0):
+            variational_solution: NumericalSolver.VariationalSolution = (
+                numerical_solver.integrate_variational_duration(
+                    initial_state_vec,
+                    integration_duration,
+                    oscillator,
+                    state_transition_matrix_error_weight,
+                )
+            )
+
+            assert variational_solution.time == integration_duration
+            assert np.allclose(
+                variational_solution.state,
+                get_state_vec(integration_duration),
+                atol=1e-8,
+            )
+            assert np.allclose(
+                variational_solution.state_transition_matrix,
+                expected_state_transition_matrix,
+                atol=1e-6,
+            )
+
+        variational_solution = numerical_solver.integrate_variational_time(
+            initial_state_vec, 0.0, integration_duration, oscillator
+        )
+
+        assert np.allclose(
+            variational_solution.state_transition_matrix,
+            expected_state_transition_matrix,
+            atol=1e-6,
+        )
+
+    def test_integrate_fixed_step(self, initial_state_vec: np.ndarray):
+        # The oscillator state is a position followed by a velocity, as symplectic steppers require
+        integration_duration: float = 10.0
+
+        for stepper_type in (
+            NumericalSolver.StepperType.VelocityVerlet,
+            NumericalSolver.StepperType.Yoshida4,
+            NumericalSolver.StepperType.AdamsBashforthMoulton8,
+        ):
+            numerical_solver = NumericalSolver(
+                NumericalSolver.LogType.NoLog,
+                stepper_type,
+                1.0 / 1024.0,
+                1.0e-12,
+                1.0e-12,
+            )
+
+            state_vector, _ = numerical_solver.integrate_duration(
+                initial_state_vec, integration_duration, oscillator
+            )
+
+            assert 1e-5 >= abs(state_vector[0] - math.sin(integration_duration))
+            assert 1e-5 >= abs(state_vector[1] - math.cos(integration_duration))
+
+    def test_integrate_time_event_conditions(
+        self, numerical_solver: NumericalSolver, initial_state_vec: np.ndarray
+    ):
+        zero_crossing = EventCondition(
+            "Zero crossing",
+            EventCondition.Criterion.AnyCrossing,
+            lambda x, t: x[0],
+            False,
+        )
+        threshold = EventCondition(
+            "Threshold",
+            EventCondition.Criterion.NegativeCrossing,
+            lambda x, t: x[0] + 0.5,
+        )
+
+        condition_solution = numerical_solver.integrate_time(
+            initial_state_vec, 0.0, 10.0, oscillator, [zero_crossing, threshold]
+        )
+
+        assert condition_solution.condition_is_satisfied
+        assert condition_solution.solution[1] == pytest.approx(7.0 * math.pi / 6.0, abs=1e-8)
+
+        assert len(condition_solution.event_solutions) == 2
+        assert condition_solution.event_solutions[0][0] == 0
+        assert condition_solution.event_solutions[0][1][1] == pytest.approx(math.pi, abs=1e-8)
+        assert condition_solution.event_solutions[1][0] == 1
+
+        condition_solution = numerical_solver.integrate_duration(
+            initial_state_vec, 10.0, oscillator, [zero_crossing]
+        )
+
+        assert not condition_solution.condition_is_satisfied
+        assert len(condition_solution.event_solutions) == 3
+
+    def test_integrate_dense_time(self, numerical_solver_conditional: NumericalSolver):
+        start_time: float = 0.0
+        end_time: float = 100.0
+
+        dense_trajectory = numerical_solver_conditional.integrate_dense_time(
+            get_state_vec(start_time), start_time, end_time, oscillator
+        )
+
+        assert dense_trajectory.is_defined()
+        assert dense_trajectory.get_start_time() == start_time
+        assert dense_trajectory.get_end_time() == end_time
+
+        times = np.linspace(start_time, end_time, 1000)
+        states = dense_trajectory.evaluate(times)
+
+        assert states.shape == (2, 1000)
+        assert np.all(1e-8 >= np.abs(states[0, :] - np.sin(times)))
+
+    def test_integrate_ensemble_duration(self, numerical_solver: NumericalSolver):
+        phases = np.array([0.0, 0.5, 1.0])
+        ensemble_state = np.array([np.sin(phases), np.cos(phases)])
+        integration_duration: float = 100.0
+
+        for ensemble_step_control in (
+            NumericalSolver.EnsembleStepControl.Shared,
+            NumericalSolver.EnsembleStepControl.PerMember,
+        ):
+            propagated_ensemble_state, _ = numerical_solver.integrate_ensemble_duration(
+                ensemble_state,
+                integration_duration,
+                ensemble_oscillator,
+                ensemble_step_control,
+            )
+
+            assert propagated_ensemble_state.shape == ensemble_state.shape
+            assert np.all(
+                5e-9
+                >= np.abs(
+                    propagated_ensemble_state[0, :]
+                    - np.sin(phases + integration_duration)
+                )
+            )
+
     def test_default(self):
         assert NumericalSolver.default() is not None
 
@@ -0,0 +1,92 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+import math
+
+from ostk.mathematics.solver import NumericalSolver
+from ostk.mathematics.solver import Parareal
+
+
+def oscillator(x, dxdt, _):
+    dxdt[0] = x[1]
+    dxdt[1] = -x[0]
+    return dxdt
+
+
+def get_state_vec(time: float) -> np.ndarray:
+    return np.array([math.sin(time), math.cos(time)])
+
+
+@pytest.fixture
+def coarse_solver() -> NumericalSolver:
+    return NumericalSolver(
+        NumericalSolver.LogType.NoLog,
+        NumericalSolver.StepperType.RungeKutta4,
+        0.25,
+        1.0e-12,
+        1.0e-12,
+    )
+
+
+@pytest.fixture
+def fine_solver() -> NumericalSolver:
+    return NumericalSolver(
+        NumericalSolver.LogType.NoLog,
+        NumericalSolver.StepperType.RungeKuttaFehlberg78,
+        1e-2,
+        1.0e-12,
+        1.0e-12,
+    )
+
+
+@pytest.fixture
+def parareal(coarse_solver: NumericalSolver, fine_solver: NumericalSolver) -> Parareal:
+    return Parareal(coarse_solver, fine_solver, 8, 1e-10, 8)
+
+
+class TestParareal:
+    def test_constructor_success(self, parareal: Parareal):
+        assert parareal is not None
+        assert isinstance(parareal, Parareal)
+        assert parareal.is_defined()
+
+    def test_getters(self, parareal: Parareal):
+        assert parareal.get_slice_count() == 8
+        assert parareal.get_tolerance() == 1e-10
+        assert parareal.get_maximum_iteration_count() == 8
+        assert parareal.get_statistics().iteration_count == 0
+
+    def test_integrate_duration(self, parareal: Parareal):
+        state_vector, time = parareal.integrate_duration(get_state_vec(0.0), 40.0, oscillator)
+
+        assert time == 40.0
+        assert np.allclose(state_vector, get_state_vec(40.0), atol=1e-8)
+
+        statistics: Parareal.Statistics = parareal.get_statistics()
+
+        assert statistics.is_converged
+        assert 0 < statistics.iteration_count < 8
+        assert statistics.speedup is not None
+
+    def test_integrate_time(self, parareal: Parareal):
+        state_vector, time = parareal.integrate_time(get_state_vec(1.0), 1.0, -9.0, oscillator)
+
+        assert time == -9.0
+        assert np.allclose(state_vector, get_state_vec(-9.0), atol=1e-8)
+
+    def test_integrate_in_place_system_of_equations(self, parareal: Parareal):
+        def in_place_oscillator(x, dxdt, _):
+            dxdt[0] = x[1]
+            dxdt[1] = -x[0]
+
+        with pytest.raises(RuntimeError):
+            parareal.integrate_duration(
+                get_state_vec(0.0),
+                1.0,
+                NumericalSolver.InPlaceSystemOfEquations(in_place_oscillator),
+            )
+
+    def test_undefined(self):
+        assert not Parareal.undefined().is_defined()
@@ -0,0 +1,165 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_ChebyshevSeries__
+#define __OpenSpaceToolkit_Mathematics_ChebyshevSeries__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+/// @brief Piecewise Chebyshev series
+///
+/// Approximates several components over a range of x values, split into contiguous segments with one set of
+/// coefficients each (as the SPICE SPK type 2 and 3 ephemeris segments). On the segment [a, b], each component is
+/// the sum of c_k T_k(u), with T_k the Chebyshev polynomials of the first kind and u = (2 x - a - b) / (b - a).
+///
+/// Evaluation uses the Clenshaw recurrence, in O(degree) per component. Derivatives are evaluated from the
+/// differentiated series. A table of samples can thus be replaced by a few coefficients per segment, fitted to a
+/// tolerance.
+///
+/// @ref https://en.wikipedia.org/wiki/Chebyshev_polynomials
+/// @ref https://en.wikipedia.org/wiki/Clenshaw_algorithm
+class ChebyshevSeries
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///                     ChebyshevSeries chebyshevSeries({0.0, 60.0, 120.0}, {coefficients0, coefficients1});
+    /// @endcode
+    ///
+    /// @param aBreakpointVector A vector of segment bounds, in strictly ascending order (one more than segments)
+    /// @param aCoefficientArray An array of coefficient matrices, one per segment, with one row per Chebyshev
+    /// polynomial (in increasing degrees) and one column per component
+    ChebyshevSeries(const VectorXd& aBreakpointVector, const Array<MatrixXd>& aCoefficientArray);
+
+    /// @brief Get the number of segments
+    ///
+    /// @return Number of segments
+    Size getSegmentCount() const;
+
+    /// @brief Get the number of components
+    ///
+    /// @return Number of components
+    Size getComponentCount() const;
+
+    /// @brief Get the segment bounds
+    ///
+    /// @return Vector of segment bounds
+    VectorXd getBreakpoints() const;
+
+    /// @brief Get the coefficients
+    ///
+    /// @return Array of coefficient matrices, one per segment
+    Array<MatrixXd> getCoefficients() const;
+
+    /// @brief Evaluate the Chebyshev series
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd values = chebyshevSeries.evaluate({1.0, 5.0, 6.0}) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values, within the segment bounds
+    /// @return Matrix of y values, one row per x value and one column per component
+    MatrixXd evaluate(const VectorXd& aQueryVector) const;
+
+    /// @brief Evaluate the Chebyshev series
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values = chebyshevSeries.evaluate(5.0) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value, within the segment bounds
+    /// @return Vector of y values, one per component
+    VectorXd evaluate(const double& aQueryValue) const;
+
+    /// @brief Evaluate a derivative of the Chebyshev series
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd derivatives = chebyshevSeries.evaluateDerivative({1.0, 5.0, 6.0}, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values, within the segment bounds
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Matrix of derivatives of y, one row per x value and one column per component
+    MatrixXd evaluateDerivative(const VectorXd& aQueryVector, const Size& anOrder = 1) const;
+
+    /// @brief Evaluate a derivative of the Chebyshev series
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd derivatives = chebyshevSeries.evaluateDerivative(5.0, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value, within the segment bounds
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Vector of derivatives of y, one per component
+    VectorXd evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const;
+
+    /// @brief Fit a Chebyshev series to samples, with segments of equal length
+    ///
+    /// The coefficients of each segment are the least squares fit to the samples within the segment (its bounds
+    /// included).
+    ///
+    /// @code{.cpp}
+    ///                     ChebyshevSeries chebyshevSeries = ChebyshevSeries::Fit(x, y, 12, 10);
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values, in strictly ascending order
+    /// @param aYMatrix A matrix of y values, one row per x value and one column per component
+    /// @param aDegree A degree of the series of each segment
+    /// @param aSegmentCount (optional) A number of segments
+    /// @return Chebyshev series
+    ///
+    /// @warning Each segment must contain more samples than the degree
+    static ChebyshevSeries Fit(
+        const VectorXd& anXVector, const MatrixXd& aYMatrix, const Size& aDegree, const Size& aSegmentCount = 1
+    );
+
+    /// @brief Fit a Chebyshev series to samples, splitting segments in halves until a tolerance is met
+    ///
+    /// Starting from a single segment, each segment whose largest residual over its samples exceeds the tolerance is
+    /// split in two halves, as long as both halves contain more samples than the degree.
+    ///
+    /// @code{.cpp}
+    ///                     ChebyshevSeries chebyshevSeries = ChebyshevSeries::FitAdaptive(x, y, 12, 1e-3);
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values, in strictly ascending order
+    /// @param aYMatrix A matrix of y values, one row per x value and one column per component
+    /// @param aDegree A degree of the series of each segment
+    /// @param aTolerance An absolute tolerance on the residuals
+    /// @return Chebyshev series
+    static ChebyshevSeries FitAdaptive(
+        const VectorXd& anXVector, const MatrixXd& aYMatrix, const Size& aDegree, const Real& aTolerance
+    );
+
+   private:
+    VectorXd breakpoints_;
+    Array<MatrixXd> coefficients_;
+
+    Index findSegmentIndex(const double& aQueryValue) const;
+};
+
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -20,6 +20,7 @@ using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 /// @brief Interpolator (abstract class)
@@ -35,7 +36,12 @@ class Interpolator
     {
         BarycentricRational,
         CubicSpline,
-        Linear
+        Hermite,
+        Lagrange,
+        LagrangeHermite,
+        Linear,
+        NonUniformCubicSpline,
+        Streaming
     };
 
     /// @brief Constructor (can only be called by derived classes since it is pure virtual)
@@ -62,8 +68,77 @@ class Interpolator
     /// @return Vector of y values
     virtual double evaluate(const double& aQueryValue) const = 0;
 
+    /// @brief Evaluate the interpolator into a caller-supplied vector
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @param aValueVector A vector of y values, of the same size as the vector of x values
+    virtual void evaluate(const Eigen::Ref<const VectorXd>& aQueryVector, Eigen::Ref<VectorXd> aValueVector) const;
+
+    /// @brief Evaluate the interpolator, in parallel
+    ///
+    /// The x values are split into contiguous chunks, pulled by a set of worker threads (the calling thread included)
+    /// and each evaluated as a vector. Short vectors of x values are evaluated serially, the threads costing more than
+    /// they save.
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values = interpolator.evaluateParallel(queryVector) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @param aThreadCount (optional) A maximum number of worker threads (0 for the hardware concurrency)
+    /// @return Vector of y values
+    ///
+    /// @warning The values are the same as the serial ones, whatever the thread count
+    VectorXd evaluateParallel(const VectorXd& aQueryVector, const Size& aThreadCount = 0) const;
+
+    /// @brief Evaluate the interpolator into a caller-supplied vector, in parallel
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values(queryVector.size());
+    ///                     interpolator.evaluateParallel(queryVector, values) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @param aValueVector A vector of y values, of the same size as the vector of x values
+    /// @param aThreadCount (optional) A maximum number of worker threads (0 for the hardware concurrency)
+    void evaluateParallel(
+        const VectorXd& aQueryVector, Eigen::Ref<VectorXd> aValueVector, const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Evaluate a derivative of the interpolator
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @param anOrder A derivative order (0 being the y values)
+    /// @return Vector of derivatives of y
+    virtual VectorXd evaluateDerivative(const VectorXd& aQueryVector, const Size& anOrder = 1) const;
+
+    /// @brief Evaluate a derivative of the interpolator
+    ///
+    /// @param aQueryValue An x value
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Derivative of y
+    virtual double evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const = 0;
+
+    /// @brief Evaluate the interpolator and its derivatives
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @param aMaximumOrder A maximum derivative order
+    /// @return Matrix of y values (first column) and their derivatives, one row per x value
+    virtual MatrixXd evaluateWithDerivatives(const VectorXd& aQueryVector, const Size& aMaximumOrder) const;
+
+    /// @brief Evaluate the interpolator and its derivatives
+    ///
+    /// @param aQueryValue An x value
+    /// @param aMaximumOrder A maximum derivative order
+    /// @return Vector of the y value and its derivatives, up to the maximum order
+    virtual VectorXd evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const;
+
     /// @brief Generate an interpolator
     ///
+    /// The Lagrange type is generated with a window of (up to) 8 points, and the NonUniformCubicSpline type with
+    /// not-a-knot boundary conditions. The Hermite and LagrangeHermite types require derivatives of the y values, and
+    /// cannot be generated.
+    ///
     /// @param aType Interpolation type
     /// @param anXVector A vector of x values
     /// @param aYVector A vector of y values
@@ -72,6 +147,12 @@ class Interpolator
         const Type& aType, const VectorXd& anXVector, const VectorXd& aYVector
     );
 
+    /// @brief Minimum number of x values evaluated in parallel by evaluateParallel
+    static constexpr Size ParallelEvaluationThreshold = 65536;
+
+    /// @brief Number of x values per chunk of evaluateParallel
+    static constexpr Size ParallelEvaluationChunkSize = 8192;
+
    private:
     const Type type_;
 };
@@ -53,6 +53,8 @@ class BarycentricRational : public Interpolator
     /// @brief Destructor
     virtual ~BarycentricRational() override;
 
+    using Interpolator::evaluate;
+
     /// @brief Evaluate the spline
     ///
     /// @code{.cpp}
@@ -73,6 +75,20 @@ class BarycentricRational : public Interpolator
     /// @return Vector of y values
     virtual double evaluate(const double& aQueryValue) const override;
 
+    using Interpolator::evaluateDerivative;
+
+    /// @brief Evaluate a derivative of the barycentric rational interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double derivative = barycentricRational.evaluateDerivative(5.0, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Derivative of y
+    /// @warning Only the first derivative is available
+    virtual double evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const override;
+
    private:
     barycentric_rational<double> interpolator_;
 };
@@ -70,6 +70,8 @@ class CubicSpline : public Interpolator
     /// @brief Destructor
     virtual ~CubicSpline() override;
 
+    using Interpolator::evaluate;
+
     /// @brief Evaluate the cubic spline interpolator
     ///
     /// @code{.cpp}
@@ -90,6 +92,20 @@ class CubicSpline : public Interpolator
     /// @return Vector of y values
     virtual double evaluate(const double& aQueryValue) const override;
 
+    using Interpolator::evaluateDerivative;
+
+    /// @brief Evaluate a derivative of the cubic spline interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double derivative = cubicSpline.evaluateDerivative(5.0, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Derivative of y
+    /// @warning Only the first and second derivatives are available
+    virtual double evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const override;
+
    private:
     cardinal_cubic_b_spline<double> interpolator_;
 };
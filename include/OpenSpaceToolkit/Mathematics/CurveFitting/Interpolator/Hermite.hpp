@@ -0,0 +1,142 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Interpolator_Hermite__
+#define __OpenSpaceToolkit_Mathematics_Interpolator_Hermite__
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::VectorXd;
+
+/// @brief Hermite
+///
+/// Piecewise Hermite interpolator, matching the y values and their derivatives at each x value (e.g. positions and
+/// velocities of an ephemeris). With first derivatives, each piece is a cubic polynomial; with first and second
+/// derivatives, each piece is a quintic polynomial. For the same accuracy, far fewer samples are needed than with
+/// interpolators using the y values only.
+///
+/// Queries outside of the x range are extrapolated with the first and last pieces.
+///
+/// @ref https://en.wikipedia.org/wiki/Hermite_interpolation
+class Hermite : public Interpolator
+{
+   public:
+    /// @brief Constructor, for a piecewise cubic Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     Hermite hermite(x, y, dydx);
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values
+    /// @param aYVector A vector of y values
+    /// @param aDerivativeVector A vector of dy/dx values
+    ///
+    /// @warning The x values must be sorted in strictly ascending order
+    Hermite(const VectorXd& anXVector, const VectorXd& aYVector, const VectorXd& aDerivativeVector);
+
+    /// @brief Constructor, for a piecewise quintic Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     Hermite hermite(x, y, dydx, d2ydx2);
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values
+    /// @param aYVector A vector of y values
+    /// @param aDerivativeVector A vector of dy/dx values
+    /// @param aSecondDerivativeVector A vector of d2y/dx2 values
+    ///
+    /// @warning The x values must be sorted in strictly ascending order
+    Hermite(
+        const VectorXd& anXVector,
+        const VectorXd& aYVector,
+        const VectorXd& aDerivativeVector,
+        const VectorXd& aSecondDerivativeVector
+    );
+
+    /// @brief Destructor
+    virtual ~Hermite() override;
+
+    /// @brief Get the degree of the polynomial pieces
+    ///
+    /// @return Degree (3 or 5)
+    Size getDegree() const;
+
+    using Interpolator::evaluate;
+
+    /// @brief Evaluate the Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values = hermite.evaluate({1.0, 5.0, 6.0}) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @return Vector of y values
+    virtual VectorXd evaluate(const VectorXd& aQueryVector) const override;
+
+    /// @brief Evaluate the Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double value = hermite.evaluate(5.0) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @return y value
+    virtual double evaluate(const double& aQueryValue) const override;
+
+    using Interpolator::evaluateDerivative;
+
+    /// @brief Evaluate a derivative of the Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double derivative = hermite.evaluateDerivative(5.0, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Derivative of y
+    virtual double evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const override;
+
+    using Interpolator::evaluateWithDerivatives;
+
+    /// @brief Evaluate the Hermite interpolator and its derivatives, in a single pass
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd valueAndDerivatives = hermite.evaluateWithDerivatives(5.0, 2) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param aMaximumOrder A maximum derivative order
+    /// @return Vector of the y value and its derivatives, up to the maximum order
+    virtual VectorXd evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const override;
+
+   private:
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> CoefficientMatrix;
+
+    VectorXd x_;
+    CoefficientMatrix coefficients_;  // Polynomial coefficients of each piece, in powers of (x - x_i)
+
+    Index findPieceIndex(const double& aQueryValue) const;
+};
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,147 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Interpolator_Lagrange__
+#define __OpenSpaceToolkit_Mathematics_Interpolator_Lagrange__
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::VectorXd;
+
+/// @brief Lagrange
+///
+/// Windowed Lagrange interpolator: each query is interpolated by the polynomial of degree m - 1 through a window of m
+/// consecutive x values centered on the interval containing the query, in barycentric form. The window is located
+/// with a binary search, so that a query costs 𝑶(log N + m²) regardless of the total number of x values N (compared
+/// to 𝑶(N) for BarycentricRational).
+///
+/// When evaluating a vector of x values, the barycentric weights of a window are reused across consecutive queries
+/// falling in the same window, which then only cost 𝑶(m).
+///
+/// Queries outside of the x range are extrapolated with the first and last windows.
+///
+/// @ref https://en.wikipedia.org/wiki/Lagrange_polynomial#Barycentric_form
+class Lagrange : public Interpolator
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///                     Lagrange lagrange(x, y, 8);
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values
+    /// @param aYVector A vector of y values
+    /// @param aPointCount A number of points in the window (defaults to 8, i.e. degree 7)
+    ///
+    /// @warning The x values must be sorted in strictly ascending order
+    Lagrange(const VectorXd& anXVector, const VectorXd& aYVector, const Size& aPointCount = 8);
+
+    /// @brief Destructor
+    virtual ~Lagrange() override;
+
+    /// @brief Get the number of points in the window
+    ///
+    /// @return Number of points
+    Size getPointCount() const;
+
+    using Interpolator::evaluate;
+
+    /// @brief Evaluate the Lagrange interpolator
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values = lagrange.evaluate({1.0, 5.0, 6.0}) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @return Vector of y values
+    virtual VectorXd evaluate(const VectorXd& aQueryVector) const override;
+
+    /// @brief Evaluate the Lagrange interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double value = lagrange.evaluate(5.0) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @return y value
+    virtual double evaluate(const double& aQueryValue) const override;
+
+    /// @brief Evaluate the Lagrange interpolator into a caller-supplied vector
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values(queryVector.size());
+    ///                     lagrange.evaluate(queryVector, values) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @param aValueVector A vector of y values, of the same size as the vector of x values
+    virtual void evaluate(const Eigen::Ref<const VectorXd>& aQueryVector, Eigen::Ref<VectorXd> aValueVector)
+        const override;
+
+    using Interpolator::evaluateDerivative;
+
+    /// @brief Evaluate a derivative of the Lagrange interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double derivative = lagrange.evaluateDerivative(5.0, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Derivative of y
+    virtual double evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const override;
+
+    using Interpolator::evaluateWithDerivatives;
+
+    /// @brief Evaluate the Lagrange interpolator and its derivatives, in a single pass
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd valueAndDerivatives = lagrange.evaluateWithDerivatives(5.0, 2) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param aMaximumOrder A maximum derivative order
+    /// @return Vector of the y value and its derivatives, up to the maximum order
+    virtual VectorXd evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const override;
+
+   private:
+    VectorXd x_;
+    VectorXd y_;
+
+    Size pointCount_;
+
+    Index findWindowStartIndex(const double& aQueryValue) const;
+
+    VectorXd computeValueAndDerivatives(
+        const double& aQueryValue, const Index& aWindowStartIndex, const Size& aMaximumOrder
+    ) const;
+
+    void computeWeights(const Index& aWindowStartIndex, VectorXd& aWeightVector) const;
+
+    double interpolate(const double& aQueryValue, const Index& aWindowStartIndex, const VectorXd& aWeightVector)
+        const;
+};
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
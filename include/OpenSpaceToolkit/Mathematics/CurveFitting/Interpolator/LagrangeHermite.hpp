@@ -0,0 +1,135 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Interpolator_LagrangeHermite__
+#define __OpenSpaceToolkit_Mathematics_Interpolator_LagrangeHermite__
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::VectorXd;
+
+/// @brief Lagrange-Hermite
+///
+/// Local Hermite interpolator, matching the y values and their first derivatives at a window of consecutive x values
+/// around each query. With a window of m points, the interpolating polynomial is of degree 2m - 1, built from the
+/// squared Lagrange basis polynomials of the window:
+///
+///     H(x) = Σ_j [y_j + (x - x_j) (y'_j - 2 y_j L'_j(x_j))] L_j(x)²
+///
+/// Queries outside of the x range are extrapolated with the first and last windows.
+///
+/// @ref https://en.wikipedia.org/wiki/Hermite_interpolation
+class LagrangeHermite : public Interpolator
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///                     LagrangeHermite lagrangeHermite(x, y, dydx, 4);
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values
+    /// @param aYVector A vector of y values
+    /// @param aDerivativeVector A vector of dy/dx values
+    /// @param aPointCount A number of points in the window (defaults to 4, i.e. degree 7)
+    ///
+    /// @warning The x values must be sorted in strictly ascending order
+    LagrangeHermite(
+        const VectorXd& anXVector,
+        const VectorXd& aYVector,
+        const VectorXd& aDerivativeVector,
+        const Size& aPointCount = 4
+    );
+
+    /// @brief Destructor
+    virtual ~LagrangeHermite() override;
+
+    /// @brief Get the number of points in the window
+    ///
+    /// @return Number of points
+    Size getPointCount() const;
+
+    using Interpolator::evaluate;
+
+    /// @brief Evaluate the Lagrange-Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values = lagrangeHermite.evaluate({1.0, 5.0, 6.0}) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @return Vector of y values
+    virtual VectorXd evaluate(const VectorXd& aQueryVector) const override;
+
+    /// @brief Evaluate the Lagrange-Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double value = lagrangeHermite.evaluate(5.0) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @return y value
+    virtual double evaluate(const double& aQueryValue) const override;
+
+    using Interpolator::evaluateDerivative;
+
+    /// @brief Evaluate a derivative of the Lagrange-Hermite interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double derivative = lagrangeHermite.evaluateDerivative(5.0, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Derivative of y
+    virtual double evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const override;
+
+    using Interpolator::evaluateWithDerivatives;
+
+    /// @brief Evaluate the Lagrange-Hermite interpolator and its derivatives, in a single pass
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd valueAndDerivatives = lagrangeHermite.evaluateWithDerivatives(5.0, 2) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param aMaximumOrder A maximum derivative order
+    /// @return Vector of the y value and its derivatives, up to the maximum order
+    virtual VectorXd evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const override;
+
+   private:
+    VectorXd x_;
+    VectorXd y_;
+    VectorXd derivatives_;
+
+    Size pointCount_;
+
+    Index findWindowStartIndex(const double& aQueryValue) const;
+
+    VectorXd computeValueAndDerivatives(
+        const double& aQueryValue, const Index& aWindowStartIndex, const Size& aMaximumOrder
+    ) const;
+};
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -55,6 +55,8 @@ class Linear : public Interpolator
     /// @brief Destructor
     virtual ~Linear() override;
 
+    using Interpolator::evaluate;
+
     /// @brief Evaluate the linear interpolator
     ///
     /// @code{.cpp}
@@ -65,6 +67,38 @@ class Linear : public Interpolator
     /// @return Vector of y values
     virtual VectorXd evaluate(const VectorXd& aQueryVector) const override;
 
+    /// @brief Evaluate the linear interpolator into a caller-supplied vector
+    ///
+    /// Queries sorted in ascending order (as detected, in O(m)) are evaluated as by evaluateSorted, others with a
+    /// search per query value.
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values(queryVector.size());
+    ///                     linear.evaluate(queryVector, values) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @param aValueVector A vector of y values, of the same size as the vector of x values
+    virtual void evaluate(const Eigen::Ref<const VectorXd>& aQueryVector, Eigen::Ref<VectorXd> aValueVector)
+        const override;
+
+    /// @brief Evaluate the linear interpolator at sorted x values into a caller-supplied vector
+    ///
+    /// A cursor moves forward through x, galloping past the x values less than each query value, in O(m log(n / m))
+    /// at worst instead of O(m log(n)) (and O(n + m) for dense queries). Callers knowing their queries are sorted skip
+    /// the detection of evaluate.
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values(queryVector.size());
+    ///                     linear.evaluateSorted(queryVector, values) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @param aValueVector A vector of y values, of the same size as the vector of x values
+    ///
+    /// @warning The x values must be sorted in ascending order, which is not checked
+    void evaluateSorted(const Eigen::Ref<const VectorXd>& aQueryVector, Eigen::Ref<VectorXd> aValueVector) const;
+
     /// @brief Evaluate the linear interpolator
     ///
     /// @code{.cpp}
@@ -75,11 +109,28 @@ class Linear : public Interpolator
     /// @return Vector of y values
     virtual double evaluate(const double& aQueryValue) const override;
 
+    using Interpolator::evaluateDerivative;
+
+    /// @brief Evaluate a derivative of the linear interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double derivative = linear.evaluateDerivative(5.0, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Derivative of y
+    virtual double evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const override;
+
    private:
     VectorXd x_;
     VectorXd y_;
 
     Pair<Index, Index> findIndexRange(const double& aQueryValue) const;
+
+    Pair<Index, Index> getIndexRange(const Index& aLowerBoundIndex) const;
+
+    double interpolate(const double& aQueryValue, const Pair<Index, Index>& anIndexRange) const;
 };
 
 }  // namespace interpolator
@@ -0,0 +1,163 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Interpolator_NonUniformCubicSpline__
+#define __OpenSpaceToolkit_Mathematics_Interpolator_NonUniformCubicSpline__
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::VectorXd;
+
+/// @brief NonUniformCubicSpline
+///
+/// Cubic spline interpolator on arbitrarily spaced x values (e.g. the outputs of an adaptive step integrator). The
+/// slopes at the x values are solved once at construction from a tridiagonal system, in 𝑶(N), and each piece is
+/// stored in polynomial form: an evaluation costs a 𝑶(log N) interval search and a cubic polynomial evaluation.
+///
+/// Queries outside of the x range are extrapolated with the first and last pieces.
+///
+/// @ref https://en.wikipedia.org/wiki/Spline_interpolation
+class NonUniformCubicSpline : public Interpolator
+{
+   public:
+    enum class BoundaryCondition
+    {
+        Natural,  ///< Zero second derivative at both ends
+        Clamped,  ///< Given first derivative at both ends
+        NotAKnot  ///< Continuous third derivative at the second and second to last x values
+    };
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///                     NonUniformCubicSpline spline(x, y, NonUniformCubicSpline::BoundaryCondition::Natural);
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values
+    /// @param aYVector A vector of y values
+    /// @param aBoundaryCondition A boundary condition (Natural or NotAKnot, Clamped being zero end derivatives)
+    ///
+    /// @warning The x values must be sorted in strictly ascending order
+    NonUniformCubicSpline(
+        const VectorXd& anXVector,
+        const VectorXd& aYVector,
+        const BoundaryCondition& aBoundaryCondition = BoundaryCondition::NotAKnot
+    );
+
+    /// @brief Constructor, with clamped boundary conditions
+    ///
+    /// @code{.cpp}
+    ///                     NonUniformCubicSpline spline(x, y, 1.0, -1.0);
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values
+    /// @param aYVector A vector of y values
+    /// @param aStartDerivative The first derivative at the first x value
+    /// @param anEndDerivative The first derivative at the last x value
+    ///
+    /// @warning The x values must be sorted in strictly ascending order
+    NonUniformCubicSpline(
+        const VectorXd& anXVector, const VectorXd& aYVector, const Real& aStartDerivative, const Real& anEndDerivative
+    );
+
+    /// @brief Destructor
+    virtual ~NonUniformCubicSpline() override;
+
+    /// @brief Get the boundary condition
+    ///
+    /// @return Boundary condition
+    BoundaryCondition getBoundaryCondition() const;
+
+    using Interpolator::evaluate;
+
+    /// @brief Evaluate the non-uniform cubic spline interpolator
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values = spline.evaluate({1.0, 5.0, 6.0}) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @return Vector of y values
+    virtual VectorXd evaluate(const VectorXd& aQueryVector) const override;
+
+    /// @brief Evaluate the non-uniform cubic spline interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double value = spline.evaluate(5.0) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @return y value
+    virtual double evaluate(const double& aQueryValue) const override;
+
+    using Interpolator::evaluateDerivative;
+
+    /// @brief Evaluate a derivative of the non-uniform cubic spline interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double derivative = spline.evaluateDerivative(5.0, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Derivative of y
+    virtual double evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const override;
+
+    using Interpolator::evaluateWithDerivatives;
+
+    /// @brief Evaluate the non-uniform cubic spline interpolator and its derivatives, in a single pass
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd valueAndDerivatives = spline.evaluateWithDerivatives(5.0, 2) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param aMaximumOrder A maximum derivative order
+    /// @return Vector of the y value and its derivatives, up to the maximum order
+    virtual VectorXd evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const override;
+
+    /// @brief Convert boundary condition to string
+    ///
+    /// @param aBoundaryCondition A boundary condition
+    /// @return String
+    static String StringFromBoundaryCondition(const BoundaryCondition& aBoundaryCondition);
+
+   private:
+    typedef Eigen::Matrix<double, Eigen::Dynamic, 4, Eigen::RowMajor> CoefficientMatrix;
+
+    BoundaryCondition boundaryCondition_;
+
+    VectorXd x_;
+    CoefficientMatrix coefficients_;  // Polynomial coefficients of each piece, in powers of (x - x_i)
+
+    void computeCoefficients(const VectorXd& aYVector, const Real& aStartDerivative, const Real& anEndDerivative);
+
+    Index findPieceIndex(const double& aQueryValue) const;
+};
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
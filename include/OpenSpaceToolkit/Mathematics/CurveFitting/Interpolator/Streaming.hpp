@@ -0,0 +1,183 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Interpolator_Streaming__
+#define __OpenSpaceToolkit_Mathematics_Interpolator_Streaming__
+
+#include <deque>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::VectorXd;
+
+/// @brief Streaming
+///
+/// Appendable piecewise cubic Hermite interpolator, for data received one sample at a time (e.g. live telemetry).
+/// The derivative at each x value is the one of the parabola through it and its two neighbors, so that appending (or
+/// dropping) a sample only updates the derivatives of the samples next to it, in constant time. Quadratic polynomials
+/// are reproduced exactly.
+///
+/// With a capacity, the oldest samples are dropped as new ones are appended, so that memory stays bounded. The
+/// interpolator is then the same as one built from the retained samples only.
+///
+/// Queries outside of the x range are extrapolated with the first and last pieces.
+///
+/// @ref https://en.wikipedia.org/wiki/Cubic_Hermite_spline
+class Streaming : public Interpolator
+{
+   public:
+    /// @brief Constructor, for an empty interpolator
+    ///
+    /// @code{.cpp}
+    ///                     Streaming streaming(3600);
+    ///                     streaming.append(0.0, 1.0);
+    ///                     streaming.append(1.0, 2.0);
+    /// @endcode
+    ///
+    /// @param aCapacity (optional) A maximum number of retained samples (0 for no maximum)
+    Streaming(const Size& aCapacity = 0);
+
+    /// @brief Constructor, appending an initial set of samples
+    ///
+    /// @code{.cpp}
+    ///                     Streaming streaming(x, y, 3600);
+    /// @endcode
+    ///
+    /// @param anXVector A vector of x values
+    /// @param aYVector A vector of y values
+    /// @param aCapacity (optional) A maximum number of retained samples (0 for no maximum)
+    ///
+    /// @warning The x values must be sorted in strictly ascending order
+    Streaming(const VectorXd& anXVector, const VectorXd& aYVector, const Size& aCapacity = 0);
+
+    /// @brief Destructor
+    virtual ~Streaming() override;
+
+    /// @brief Check if the interpolator is defined (at least two samples are retained)
+    ///
+    /// @return True if the interpolator is defined
+    bool isDefined() const;
+
+    /// @brief Get the number of retained samples
+    ///
+    /// @return Number of retained samples
+    Size getSize() const;
+
+    /// @brief Get the maximum number of retained samples
+    ///
+    /// @return Capacity (0 for no maximum)
+    Size getCapacity() const;
+
+    /// @brief Get the retained x values
+    ///
+    /// @return Vector of x values
+    VectorXd getXVector() const;
+
+    /// @brief Get the retained y values
+    ///
+    /// @return Vector of y values
+    VectorXd getYVector() const;
+
+    /// @brief Append a sample, in amortized constant time
+    ///
+    /// If the capacity is reached, the oldest sample is dropped.
+    ///
+    /// @code{.cpp}
+    ///                     streaming.append(2.0, 5.0);
+    /// @endcode
+    ///
+    /// @param anXValue An x value, greater than the last one
+    /// @param aYValue A y value
+    void append(const double& anXValue, const double& aYValue);
+
+    /// @brief Append a set of samples
+    ///
+    /// @param anXVector A vector of x values, in strictly ascending order and greater than the last one
+    /// @param aYVector A vector of y values
+    void append(const VectorXd& anXVector, const VectorXd& aYVector);
+
+    /// @brief Drop all samples
+    void clear();
+
+    using Interpolator::evaluate;
+
+    /// @brief Evaluate the streaming interpolator
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values = streaming.evaluate({1.0, 5.0, 6.0}) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @return Vector of y values
+    virtual VectorXd evaluate(const VectorXd& aQueryVector) const override;
+
+    /// @brief Evaluate the streaming interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double value = streaming.evaluate(5.0) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @return y value
+    virtual double evaluate(const double& aQueryValue) const override;
+
+    using Interpolator::evaluateDerivative;
+
+    /// @brief Evaluate a derivative of the streaming interpolator
+    ///
+    /// @code{.cpp}
+    ///                     double derivative = streaming.evaluateDerivative(5.0, 1) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param anOrder A derivative order (0 being the y value)
+    /// @return Derivative of y
+    virtual double evaluateDerivative(const double& aQueryValue, const Size& anOrder = 1) const override;
+
+    using Interpolator::evaluateWithDerivatives;
+
+    /// @brief Evaluate the streaming interpolator and its derivatives, in a single pass
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd valueAndDerivatives = streaming.evaluateWithDerivatives(5.0, 2) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @param aMaximumOrder A maximum derivative order
+    /// @return Vector of the y value and its derivatives, up to the maximum order
+    virtual VectorXd evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const override;
+
+   private:
+    Size capacity_;
+
+    std::deque<double> x_;
+    std::deque<double> y_;
+    std::deque<double> dydx_;  // Derivatives of the parabolas through each sample and its neighbors
+
+    void updateDerivative(const Index& anIndex);
+
+    Index findPieceIndex(const double& aQueryValue) const;
+};
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,107 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_VectorInterpolator__
+#define __OpenSpaceToolkit_Mathematics_VectorInterpolator__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::RowVectorXd;
+using ostk::mathematics::object::VectorXd;
+
+/// @brief Vector interpolator
+///
+/// Interpolates several components sampled on the same x values (e.g. the position and velocity components of an
+/// ephemeris). Each query locates its x interval once, and all the components are then evaluated in a single pass
+/// over contiguous rows, instead of one scalar interpolator per component.
+///
+/// The Linear, CubicSpline and BarycentricRational types yield the same values as the corresponding scalar
+/// interpolators, built on each component.
+class VectorInterpolator
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///                     VectorInterpolator vectorInterpolator(Interpolator::Type::Linear, x, y);
+    /// @endcode
+    ///
+    /// @param aType Interpolation type
+    /// @param anXVector A vector of x values
+    /// @param aYMatrix A matrix of y values, one row per x value and one column per component
+    ///
+    /// @warning The x values must be sorted in ascending order
+    /// @warning The x values must be equally spaced for the CubicSpline type
+    VectorInterpolator(const Interpolator::Type& aType, const VectorXd& anXVector, const MatrixXd& aYMatrix);
+
+    /// @brief Get the interpolation type
+    ///
+    /// @return Interpolation type
+    Interpolator::Type getInterpolationType() const;
+
+    /// @brief Get the number of components
+    ///
+    /// @return Number of components
+    Size getComponentCount() const;
+
+    /// @brief Evaluate the vector interpolator
+    ///
+    /// @code{.cpp}
+    ///                     MatrixXd values = vectorInterpolator.evaluate({1.0, 5.0, 6.0}) ;
+    /// @endcode
+    ///
+    /// @param aQueryVector A vector of x values
+    /// @return Matrix of y values, one row per x value and one column per component
+    MatrixXd evaluate(const VectorXd& aQueryVector) const;
+
+    /// @brief Evaluate the vector interpolator
+    ///
+    /// @code{.cpp}
+    ///                     VectorXd values = vectorInterpolator.evaluate(5.0) ;
+    /// @endcode
+    ///
+    /// @param aQueryValue An x value
+    /// @return Vector of y values, one per component
+    VectorXd evaluate(const double& aQueryValue) const;
+
+   private:
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrixXd;
+    typedef Eigen::Ref<RowVectorXd, 0, Eigen::InnerStride<>> RowVectorRef;
+
+    Interpolator::Type type_;
+
+    VectorXd x_;
+    RowMajorMatrixXd y_;  // Samples (Linear, BarycentricRational), or B-spline coefficients (CubicSpline)
+
+    VectorXd weights_;     // Barycentric weights (BarycentricRational)
+    RowVectorXd average_;  // Average of the samples, added to the B-spline sum (CubicSpline)
+    double inverseStep_;   // Inverse of the x spacing (CubicSpline)
+
+    void evaluate(const double& aQueryValue, RowVectorRef aRow) const;
+
+    void evaluateLinear(const double& aQueryValue, RowVectorRef aRow) const;
+
+    void evaluateCubicSpline(const double& aQueryValue, RowVectorRef aRow) const;
+
+    void evaluateBarycentricRational(const double& aQueryValue, RowVectorRef aRow) const;
+};
+
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,162 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Solver_DenseTrajectory__
+#define __OpenSpaceToolkit_Mathematics_Solver_DenseTrajectory__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace solver
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+/// @brief                      Continuous trajectory produced by a dense output numerical integration
+///
+///                             Within each accepted integration step, the state is the degree 5 polynomial (in the
+///                             normalized step time) of the stepper continuous extension. It is stored as its values
+///                             at equispaced nodes, so that a trajectory can be evaluated at any time within its
+///                             interval without calling the system of equations, and be saved and rebuilt from its
+///                             step times and node states.
+
+class DenseTrajectory
+{
+   public:
+    /// @brief              Number of node intervals per step (the step polynomial degree)
+
+    static constexpr Size NodeIntervalsPerStep = 5;
+
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     DenseTrajectory denseTrajectory = { stepTimes, nodeStates } ;
+    /// @endcode
+    ///
+    /// @param              [in] aStepTimeVector A vector of m + 1 step boundary times, strictly monotonic
+    /// @param              [in] aNodeStateMatrix A matrix of node states, one column per node: step i is described
+    ///                     by columns NodeIntervalsPerStep * i to NodeIntervalsPerStep * (i + 1), that are equispaced
+    ///                     in time over the step
+
+    DenseTrajectory(const VectorXd& aStepTimeVector, const MatrixXd& aNodeStateMatrix);
+
+    /// @brief              Equal to operator
+    ///
+    /// @param              [in] aDenseTrajectory A dense trajectory
+    /// @return             True if dense trajectories are equal
+
+    bool operator==(const DenseTrajectory& aDenseTrajectory) const;
+
+    /// @brief              Not equal to operator
+    ///
+    /// @param              [in] aDenseTrajectory A dense trajectory
+    /// @return             True if dense trajectories are not equal
+
+    bool operator!=(const DenseTrajectory& aDenseTrajectory) const;
+
+    /// @brief              Output stream operator
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] aDenseTrajectory A dense trajectory
+    /// @return             Output stream reference
+
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const DenseTrajectory& aDenseTrajectory);
+
+    /// @brief              Check if dense trajectory is defined
+    ///
+    /// @return             True if dense trajectory is defined
+
+    bool isDefined() const;
+
+    /// @brief              Print dense trajectory
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] (optional) displayDecorators If true, display decorators
+
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief              Access step boundary times
+    ///
+    /// @return             Reference to step boundary times
+
+    const VectorXd& accessStepTimes() const;
+
+    /// @brief              Access node states
+    ///
+    /// @return             Reference to node states, one column per node
+
+    const MatrixXd& accessNodeStates() const;
+
+    /// @brief              Get number of integration steps
+    ///
+    /// @return             Number of integration steps
+
+    Size getStepCount() const;
+
+    /// @brief              Get state dimension
+    ///
+    /// @return             State dimension
+
+    Size getStateDimension() const;
+
+    /// @brief              Get start time
+    ///
+    /// @return             Start time
+
+    Real getStartTime() const;
+
+    /// @brief              Get end time
+    ///
+    /// @return             End time
+
+    Real getEndTime() const;
+
+    /// @brief              Evaluate state at a given time
+    ///
+    /// @code
+    ///                     VectorXd state = denseTrajectory.evaluate(5.0) ;
+    /// @endcode
+    ///
+    /// @param              [in] aTime A time, within the trajectory interval
+    /// @return             State vector
+
+    VectorXd evaluate(const Real& aTime) const;
+
+    /// @brief              Evaluate states at given times
+    ///
+    /// @code
+    ///                     MatrixXd states = denseTrajectory.evaluate(times) ;
+    /// @endcode
+    ///
+    /// @param              [in] aTimeVector A vector of times, within the trajectory interval
+    /// @return             State matrix, one column per time
+
+    MatrixXd evaluate(const VectorXd& aTimeVector) const;
+
+    /// @brief              Constructs an undefined dense trajectory
+    ///
+    /// @return             Undefined dense trajectory
+
+    static DenseTrajectory Undefined();
+
+   private:
+    VectorXd stepTimes_;
+    MatrixXd nodeStates_;
+
+    Size findStepIndex(const double& aTime) const;
+};
+
+}  // namespace solver
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,140 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Solver_EventCondition__
+#define __OpenSpaceToolkit_Mathematics_Solver_EventCondition__
+
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace solver
+{
+
+using ostk::core::type::String;
+
+using ostk::mathematics::object::VectorXd;
+
+/// @brief                      Event condition, met when a scalar function g(x, t) of the state and time crosses zero
+///
+///                             Event conditions are monitored by the numerical solver during integration: crossings
+///                             are detected on each accepted step and located within it from the stepper interpolant.
+
+class EventCondition
+{
+   public:
+    enum class Criterion
+    {
+        PositiveCrossing,  ///< g crosses zero from negative to positive values
+        NegativeCrossing,  ///< g crosses zero from positive to negative values
+        AnyCrossing        ///< g crosses zero in either direction
+    };
+
+    typedef std::function<double(const VectorXd&, const double)> Evaluator;  // Scalar function g(x, t)
+
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     EventCondition eventCondition = { "Apoapsis", EventCondition::Criterion::NegativeCrossing,
+    ///                     [] (const VectorXd& x, const double t) -> double { return x.head(3).dot(x.tail(3)); } } ;
+    /// @endcode
+    ///
+    /// @param              [in] aName A name
+    /// @param              [in] aCriterion A crossing criterion
+    /// @param              [in] anEvaluator A scalar function of the state and time
+    /// @param              [in] (optional) isTerminal If true, integration stops when the condition is met
+
+    EventCondition(
+        const String& aName, const Criterion& aCriterion, const Evaluator& anEvaluator, const bool isTerminal = true
+    );
+
+    /// @brief              Output stream operator
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] anEventCondition An event condition
+    /// @return             Output stream reference
+
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const EventCondition& anEventCondition);
+
+    /// @brief              Check if event condition is defined
+    ///
+    /// @return             True if event condition is defined
+
+    bool isDefined() const;
+
+    /// @brief              Check if event condition is terminal
+    ///
+    /// @return             True if integration stops when the condition is met
+
+    bool isTerminal() const;
+
+    /// @brief              Print event condition
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] (optional) displayDecorators If true, display decorators
+
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief              Get name
+    ///
+    /// @return             Name
+
+    String getName() const;
+
+    /// @brief              Get crossing criterion
+    ///
+    /// @return             Crossing criterion
+
+    Criterion getCriterion() const;
+
+    /// @brief              Evaluate the condition function
+    ///
+    /// @param              [in] aStateVector A state vector
+    /// @param              [in] aTime A time
+    /// @return             Value of g(x, t)
+
+    double evaluate(const VectorXd& aStateVector, const double aTime) const;
+
+    /// @brief              Check if the condition is met between two successive values of the condition function
+    ///
+    /// @code
+    ///                     eventCondition.isSatisfied(-1.0, 2.0) ; // True for a positive crossing
+    /// @endcode
+    ///
+    /// @param              [in] aPreviousValue A previous value of g
+    /// @param              [in] aCurrentValue A current value of g
+    /// @return             True if the values cross zero according to the criterion (reaching zero counts as
+    ///                     crossing, leaving it does not)
+
+    bool isSatisfied(const double aPreviousValue, const double aCurrentValue) const;
+
+    /// @brief              Get string from crossing criterion
+    ///
+    /// @param              [in] aCriterion A crossing criterion
+    /// @return             String
+
+    static String StringFromCriterion(const Criterion& aCriterion);
+
+    /// @brief              Constructs an undefined event condition
+    ///
+    /// @return             Undefined event condition
+
+    static EventCondition Undefined();
+
+   private:
+    String name_;
+    Criterion criterion_;
+    Evaluator evaluator_;
+    bool terminal_;
+};
+
+}  // namespace solver
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
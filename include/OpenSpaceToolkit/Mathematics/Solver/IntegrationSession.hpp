@@ -0,0 +1,168 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Solver_IntegrationSession__
+#define __OpenSpaceToolkit_Mathematics_Solver_IntegrationSession__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace solver
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+/// @brief                      Resumable numerical integration of a single trajectory
+///
+///                             A session advances a state in successive calls, keeping the stepper state between
+///                             them: the adapted step size, the step size controller and, for the Dopri5 stepper, the
+///                             first same as last (FSAL) derivative at the current state. A trajectory advanced in
+///                             many short hops then costs about as much as a single integration over the same span.
+
+class IntegrationSession
+{
+   public:
+    typedef NumericalSolver::StateVector StateVector;
+    typedef NumericalSolver::Solution Solution;
+    typedef NumericalSolver::SystemOfEquationsWrapper SystemOfEquationsWrapper;
+
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     IntegrationSession session = { numericalSolver, stateVector, 0.0, systemOfEquations } ;
+    ///                     session.advanceTo(60.0) ;
+    ///                     session.advanceTo(120.0) ;
+    /// @endcode
+    ///
+    /// @param              [in] aNumericalSolver A numerical solver, providing the stepper type, initial time step
+    ///                     and tolerances. Only the explicit Runge-Kutta steppers are supported.
+    /// @param              [in] anInitialStateVector An initial state vector
+    /// @param              [in] aStartTime A start time
+    /// @param              [in] aSystemOfEquations A system of equations
+
+    IntegrationSession(
+        const NumericalSolver& aNumericalSolver,
+        const StateVector& anInitialStateVector,
+        const Real& aStartTime,
+        const SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief              Output stream operator
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] anIntegrationSession An integration session
+    /// @return             Output stream reference
+
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const IntegrationSession& anIntegrationSession);
+
+    /// @brief              Check if integration session is defined
+    ///
+    /// @return             True if integration session is defined
+
+    bool isDefined() const;
+
+    /// @brief              Print integration session
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] (optional) displayDecorators If true, display decorators
+
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief              Access current state vector
+    ///
+    /// @return             Reference to current state vector
+
+    const StateVector& accessStateVector() const;
+
+    /// @brief              Get current time
+    ///
+    /// @return             Current time
+
+    Real getTime() const;
+
+    /// @brief              Get current state vector and time
+    ///
+    /// @return             Current solution
+
+    Solution getSolution() const;
+
+    /// @brief              Get time step
+    ///
+    ///                     The step size the next step will be attempted with, as adapted by the previous steps.
+    ///
+    /// @return             Time step magnitude
+
+    Real getTimeStep() const;
+
+    /// @brief              Get integration statistics
+    ///
+    ///                     Counts and step sizes are accumulated since the session creation or its last reset. The
+    ///                     wall time is the total time spent advancing the session.
+    ///
+    /// @return             Integration statistics
+
+    NumericalSolver::Statistics getStatistics() const;
+
+    /// @brief              Advance session to a given time
+    ///
+    ///                     The last step is shortened to end exactly at the given time, without discarding the adapted
+    ///                     step size. Times before the current time integrate backward.
+    ///
+    /// @param              [in] aTime A time
+    /// @return             State vector and time reached
+
+    Solution advanceTo(const Real& aTime);
+
+    /// @brief              Advance session by a given duration
+    ///
+    /// @param              [in] aDurationInSeconds A duration, negative to integrate backward
+    /// @return             State vector and time reached
+
+    Solution advanceBy(const Real& aDurationInSeconds);
+
+    /// @brief              Reset session to a given state and time
+    ///
+    ///                     The adapted step size is kept, while the stepper state depending on the previous trajectory
+    ///                     (such as the FSAL derivative) is discarded. Use after an impulsive change of the state.
+    ///
+    /// @param              [in] aStateVector A state vector
+    /// @param              [in] aTime A time
+
+    void reset(const StateVector& aStateVector, const Real& aTime);
+
+    /// @brief              Constructs an undefined integration session
+    ///
+    /// @return             Undefined integration session
+
+    static IntegrationSession Undefined();
+
+   private:
+    NumericalSolver::StepperType stepperType_;
+    Real relativeTolerance_;
+    Real absoluteTolerance_;
+
+    SystemOfEquationsWrapper systemOfEquations_;
+    std::function<bool(const SystemOfEquationsWrapper&, StateVector&, double&, double&)> tryStep_;
+
+    StateVector stateVector_;
+    double time_;
+    double timeStep_;
+
+    NumericalSolver::Statistics statistics_;
+
+    void initializeStepper();
+
+    void recordStep(const double aStepSize, const bool isAccepted);
+};
+
+}  // namespace solver
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -3,13 +3,21 @@
 #ifndef __OpenSpaceToolkit_Mathematics_Solver_NumericalSolver__
 #define __OpenSpaceToolkit_Mathematics_Solver_NumericalSolver__
 
+#include <memory>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <Eigen/Core>
+#include <unsupported/Eigen/AutoDiff>
+
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/DenseTrajectory.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/EventCondition.hpp>
 
 namespace ostk
 {
@@ -20,15 +28,25 @@ namespace solver
 
 using ostk::core::container::Array;
 using ostk::core::container::Pair;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 /// @brief                      Defines a numerical ODE solver that use the Boost Odeint libraries. This class will be
 /// moved into OSTk-math in the future.
+///
+///                             Symplectic steppers (VelocityVerlet, Yoshida4) integrate states made of positions
+///                             followed by velocities of the same dimension, the position derivatives being these
+///                             velocities: only the velocity part of the system of equations output is used. The
+///                             accelerations must depend on positions and time only, not on velocities (e.g. drag or
+///                             damping): the acceleration at the end of a step is evaluated before its last velocity
+///                             half-kick, and reused by the next step. They cost one call to the system of equations
+///                             per Verlet step, and the AdamsBashforthMoulton8 stepper two per step.
 class NumericalSolver
 {
    public:
@@ -37,7 +55,12 @@ class NumericalSolver
         RungeKutta4,
         RungeKuttaCashKarp54,
         RungeKuttaFehlberg78,
-        RungeKuttaDopri5
+        RungeKuttaDopri5,
+        Rosenbrock4,                     ///< Linearly implicit 4th order Rosenbrock method, for stiff systems
+        BackwardDifferentiationFormula,  ///< Variable order (1 to 5) BDF method, for stiff systems
+        VelocityVerlet,                  ///< Symplectic 2nd order velocity Verlet method (fixed step)
+        Yoshida4,                        ///< Symplectic 4th order composition of 3 velocity Verlet steps (fixed step)
+        AdamsBashforthMoulton8           ///< 8 steps Adams-Bashforth-Moulton predictor-corrector (fixed step)
     };
 
     enum class LogType
@@ -47,12 +70,78 @@ class NumericalSolver
         LogAdaptive
     };
 
+    enum class EnsembleStepControl
+    {
+        Shared,    ///< One step size controller drives all ensemble members (error norm taken over all members)
+        PerMember  ///< Each ensemble member is integrated with its own step size controller, one member at a time
+    };
+
     typedef VectorXd StateVector;  // Container used to hold the state vector
 
     typedef Pair<StateVector, double> Solution;  // Container used to hold the state vector and time
     typedef std::function<void(const StateVector&, StateVector&, const double)>
         SystemOfEquationsWrapper;  // Function pointer type for returning dynamical equation's pointers
 
+    typedef MatrixXd EnsembleState;  // Container used to hold an ensemble of state vectors, one member per column
+
+    typedef Pair<EnsembleState, double> EnsembleSolution;  // Container used to hold the ensemble state and time
+    typedef std::function<void(const EnsembleState&, EnsembleState&, const double)>
+        EnsembleSystemOfEquationsWrapper;  // Function pointer type evaluating the dynamics of all members at once
+
+    typedef std::function<void(const StateVector&, MatrixXd&, StateVector&, const double)>
+        JacobianWrapper;  // Function pointer type returning the Jacobian of the dynamics wrt. the state, and their
+                          // partial derivative wrt. time (zero for autonomous systems)
+
+    typedef Eigen::AutoDiffScalar<VectorXd> Dual;  // Forward-mode dual number, carrying derivatives wrt. the state
+
+    typedef Eigen::Matrix<Dual, Eigen::Dynamic, 1> DualStateVector;  // Container used to hold a dual state vector
+    typedef std::function<void(const DualStateVector&, DualStateVector&, const double)>
+        DualSystemOfEquationsWrapper;  // Function pointer type for dynamical equations on dual numbers, that yields
+                                       // their Jacobian by automatic differentiation
+
+    typedef std::function<void(const StateVector&, const double)>
+        StateObserver;  // Sink receiving each observed state vector and time, without retaining them
+
+    typedef Pair<Index, Solution> EventSolution;  // Index of a met event condition, with the state and time met at
+
+    struct ConditionSolution
+    {
+        Solution solution;                    ///< State and time at which the integration stopped
+        Array<EventSolution> eventSolutions;  ///< Met event conditions, in chronological order
+        bool conditionIsSatisfied;            ///< True if the integration stopped on a terminal event condition
+    };
+
+    struct VariationalSolution
+    {
+        StateVector state;               ///< State vector at the end time
+        MatrixXd stateTransitionMatrix;  ///< Sensitivity of the state to the initial state, d(state) / d(initial state)
+        double time;                     ///< End time
+    };
+
+    struct Statistics
+    {
+        Size systemOfEquationsCallCount = 0;       ///< Number of calls to the system of equations
+        Size acceptedStepCount = 0;                ///< Number of accepted integration steps
+        Size rejectedStepCount = 0;                ///< Number of rejected step trials
+        Real minimumStepSize = Real::Undefined();  ///< Smallest accepted step size magnitude
+        Real maximumStepSize = Real::Undefined();  ///< Largest accepted step size magnitude
+        Real meanStepSize = Real::Undefined();     ///< Mean accepted step size magnitude
+        Real wallTime = Real::Undefined();         ///< Wall clock duration of the integration [s]
+    };
+
+    typedef std::function<void(const double, const double, const bool)>
+        StepTraceHook;  // Function called on each step trial with its start time, signed size and acceptance
+
+    template <int N>
+    using FixedStateVector = Eigen::Matrix<double, N, 1>;  // Fixed-size container, with stepper stages on the stack
+
+    template <int N>
+    using FixedSolution = Pair<FixedStateVector<N>, double>;  // Container used to hold a fixed-size state and time
+    template <int N>
+    using FixedSystemOfEquationsWrapper = std::function<void(
+        const FixedStateVector<N>&, FixedStateVector<N>&, const double
+    )>;  // Function pointer type for returning dynamical equation's pointers, on fixed-size states
+
     /// @brief                  Constructor
     ///
     /// @code
@@ -184,6 +273,104 @@ class NumericalSolver
 
     Array<Solution> getObservedStateVectors() const;
 
+    /// @brief                  Get observation step interval
+    ///
+    /// @code
+    ///                         numericalSolver.getObservationStepInterval();
+    /// @endcode
+    ///
+    /// @return                 Size
+
+    Size getObservationStepInterval() const;
+
+    /// @brief                  Get observation minimum time separation
+    ///
+    /// @code
+    ///                         numericalSolver.getObservationMinimumTimeSeparation();
+    /// @endcode
+    ///
+    /// @return                 Real, undefined if observations are not decimated in time
+
+    Real getObservationMinimumTimeSeparation() const;
+
+    /// @brief                  Get statistics of the last integration
+    ///
+    /// @code
+    ///                         NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+    /// @endcode
+    ///
+    /// @return                 Statistics, reset by each integrate call
+    ///
+    /// @note                   Calls made to locate event crossings and to reach output times between steps are
+    ///                         counted in the system of equations calls, but are not steps. The rejected trials of a
+    ///                         dense output step (integrateDense, and event conditions with RungeKuttaDopri5) are
+    ///                         deduced from its calls to the system of equations.
+
+    Statistics getStatistics() const;
+
+    /// @brief                  Stream observed states to a sink instead of buffering them
+    ///
+    /// @code
+    ///                         numericalSolver.setStateObserver([] (const StateVector& x, const double t) { ... });
+    /// @endcode
+    ///
+    /// @param                  [in] aStateObserver A sink called with each observed state vector and time, or nullptr
+    ///                         to buffer observed states again
+    ///
+    /// @note                   While a sink is set, observed state vectors are not retained. The sink is not called
+    ///                         by the parallel batch integration.
+
+    void setStateObserver(const StateObserver& aStateObserver);
+
+    /// @brief                  Set the Jacobian of the system of equations, used by implicit steppers
+    ///
+    /// @code
+    ///                         numericalSolver.setJacobian([] (const StateVector& x, MatrixXd& dfdx, StateVector&
+    ///                         dfdt, const double t) { ... });
+    /// @endcode
+    ///
+    /// @param                  [in] aJacobian A function returning the Jacobian of the dynamics with respect to the
+    ///                         state, and their partial derivative with respect to time, or nullptr to use finite
+    ///                         differences
+    ///
+    /// @note                   Without a Jacobian, it is computed by forward finite differences, for n + 1 calls to the
+    ///                         system of equations. It is cached: Rosenbrock4 reuses it when retrying a rejected step,
+    ///                         and BDF across steps until its Newton iterations stop converging.
+
+    void setJacobian(const JacobianWrapper& aJacobian);
+
+    /// @brief                  Set a hook called on each step trial, to profile the step size control
+    ///
+    /// @code
+    ///                         numericalSolver.setStepTraceHook([] (const double t, const double dt, const bool
+    ///                         isAccepted) { ... });
+    /// @endcode
+    ///
+    /// @param                  [in] aStepTraceHook A function called with the start time, signed size and acceptance
+    ///                         of each step trial, or nullptr to not trace steps
+    ///
+    /// @note                   The size of the rejected trials of a dense output step is not known, and traced as NaN.
+    ///                         The hook is not called by the parallel batch integration.
+
+    void setStepTraceHook(const StepTraceHook& aStepTraceHook);
+
+    /// @brief                  Decimate observed states
+    ///
+    /// @code
+    ///                         numericalSolver.setObservationDecimation(10, 60.0);
+    /// @endcode
+    ///
+    /// @param                  [in] aStepInterval Only every k-th integration step is observed (1 to observe all)
+    /// @param                  [in] (optional) aMinimumTimeSeparation Only steps at least this far in time from the
+    ///                         last observed one are observed (undefined to not decimate in time)
+    ///
+    /// @note                   The first observed state of an integration is always kept. Decimation applies to the
+    ///                         buffered states, the state observer and logging.
+
+    void setObservationDecimation(
+        const Size& aStepInterval, const Real& aMinimumTimeSeparation = Real::Undefined()
+    );
+
     /// @brief                  Perform numerical integration from a start time to an array of times
     ///
     /// @code
@@ -205,6 +392,55 @@ class NumericalSolver
         const SystemOfEquationsWrapper& aSystemOfEquations
     );
 
+    /// @brief                  Perform numerical integration from a start time to an array of times, returning a
+    ///                         state matrix
+    ///
+    ///                         States are returned as the columns of a single (column-major) matrix, rather than as
+    ///                         one state vector per time.
+    ///
+    /// @code
+    ///                         MatrixXd states =
+    ///                         numericalSolver.integrateTime(stateVector, startTime, timeVector, systemOfEquations);
+    /// @endcode
+    ///
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aStartTime A time to begin integrating from
+    /// @param                  [in] aTimeVector A vector of m times to integrate to
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @return                 State matrix (n x m), one column per time
+
+    MatrixXd integrateTime(
+        const StateVector& anInitialStateVector,
+        const Real& aStartTime,
+        const VectorXd& aTimeVector,
+        const SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief                  Perform numerical integration from a start time to an array of times, writing states
+    ///                         into a caller provided state matrix
+    ///
+    /// @code
+    ///                         MatrixXd states(stateVector.size(), timeVector.size());
+    ///                         numericalSolver.integrateTime(stateVector, startTime, timeVector, systemOfEquations,
+    ///                         states);
+    /// @endcode
+    ///
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aStartTime A time to begin integrating from
+    /// @param                  [in] aTimeVector A vector of m times to integrate to
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @param                  [out] aStateMatrix A state matrix (n x m), set to one state per column
+
+    void integrateTime(
+        const StateVector& anInitialStateVector,
+        const Real& aStartTime,
+        const VectorXd& aTimeVector,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        Eigen::Ref<MatrixXd> aStateMatrix
+    );
+
     /// @brief                  Perform numerical integration from a start time to an end time
     ///
     /// @code
@@ -261,6 +497,353 @@ class NumericalSolver
         const SystemOfEquationsWrapper& aSystemOfEquations
     );
 
+    /// @brief                  Perform numerical integration from a start time to an end time, monitoring event
+    ///                         conditions
+    ///
+    /// @code
+    ///                         ConditionSolution conditionSolution = numericalSolver.integrateTime(stateVector,
+    ///                         startTime, endTime, systemOfEquations, eventConditions);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aStartTime A time to begin integrating from
+    /// @param                  [in] anEndTime A time to integrate to
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @param                  [in] anEventConditionArray An array of event conditions
+    /// @return                 ConditionSolution, holding the state at the end time (or at the first met terminal
+    ///                         condition) and all met conditions
+    ///
+    /// @note                   Conditions are checked at the end of each accepted step, and their crossings located
+    ///                         within the step on the stepper interpolant: the Dopri5 continuous extension, or for the
+    ///                         other steppers a partial step of the same method from the start of the step. A crossing
+    ///                         at the start time is not reported.
+
+    ConditionSolution integrateTime(
+        const StateVector& anInitialStateVector,
+        const Real& aStartTime,
+        const Real& anEndTime,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const Array<EventCondition>& anEventConditionArray
+    );
+
+    /// @brief                  Perform numerical integration for a specified duration, monitoring event conditions
+    ///
+    /// @code
+    ///                         ConditionSolution conditionSolution = numericalSolver.integrateDuration(stateVector,
+    ///                         durationSeconds, systemOfEquations, eventConditions);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aDurationInSeconds A duration over which to integrate
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @param                  [in] anEventConditionArray An array of event conditions
+    /// @return                 ConditionSolution, with times starting at 0
+
+    ConditionSolution integrateDuration(
+        const StateVector& anInitialStateVector,
+        const Real& aDurationInSeconds,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const Array<EventCondition>& anEventConditionArray
+    );
+
+    /// @brief                  Perform numerical integration of a fixed-size state for a specified duration
+    ///
+    /// @code
+    ///                         NumericalSolver::FixedStateVector<6> stateVector = ... ;
+    ///                         NumericalSolver::FixedSolution<6> solution = numericalSolver.integrateDuration(
+    ///                         stateVector, durationSeconds, systemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial N-dimensional state vector to begin integrating at
+    /// @param                  [in] aDurationInSeconds A duration over which to integrate
+    /// @param                  [in] aSystemOfEquations A std::function wrapper taking fixed-size state references
+    /// @return                 FixedSolution
+    ///
+    /// @note                   Available for N = 6, 7, 13 and 42. The stepper stages are not heap allocated, and with
+    ///                         the NoLog log type intermediate states are not recorded in the observed state vectors,
+    ///                         so that the integration loop does not allocate.
+
+    template <int N>
+    FixedSolution<N> integrateDuration(
+        const FixedStateVector<N>& anInitialStateVector,
+        const Real& aDurationInSeconds,
+        const std::enable_if_t<(N > 0), FixedSystemOfEquationsWrapper<N>>& aSystemOfEquations
+    );
+
+    /// @brief                  Perform numerical integration of a fixed-size state from a start time to an end time
+    ///
+    /// @code
+    ///                         NumericalSolver::FixedSolution<6> solution = numericalSolver.integrateTime(
+    ///                         stateVector, startTime, endTime, systemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial N-dimensional state vector to begin integrating at
+    /// @param                  [in] aStartTime A time to begin integrating from
+    /// @param                  [in] anEndTime A time to integrate to
+    /// @param                  [in] aSystemOfEquations A std::function wrapper taking fixed-size state references
+    /// @return                 FixedSolution
+    ///
+    /// @note                   Available for N = 6, 7, 13 and 42.
+
+    template <int N>
+    FixedSolution<N> integrateTime(
+        const FixedStateVector<N>& anInitialStateVector,
+        const Real& aStartTime,
+        const Real& anEndTime,
+        const std::enable_if_t<(N > 0), FixedSystemOfEquationsWrapper<N>>& aSystemOfEquations
+    );
+
+    /// @brief                  Perform numerical integration of a batch of independent trajectories for a specified
+    ///                         duration, in parallel
+    ///
+    /// @code
+    ///                         Array<Solution> solutions = numericalSolver.integrateDuration(stateVectors,
+    ///                         durationSeconds, systemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialStateVectorArray An array of initial n-dimensional state vectors, one per
+    ///                         trajectory
+    /// @param                  [in] aDurationInSeconds A duration over which to integrate
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @param                  [in] (optional) aThreadCount A maximum number of worker threads (0 for the hardware
+    ///                         concurrency)
+    /// @return                 Array<Solution>, one solution per trajectory and in the same order
+    ///
+    /// @warning                The system of equations is called concurrently from several threads and must be
+    ///                         thread-safe. Each worker integrates with its own observer buffer, and the results do
+    ///                         not depend on the thread count. Trajectories are not logged, nor observed by the state
+    ///                         observer and step trace hook. The statistics are summed over all trajectories.
+
+    Array<Solution> integrateDuration(
+        const Array<StateVector>& anInitialStateVectorArray,
+        const Real& aDurationInSeconds,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const Size& aThreadCount = 0
+    );
+
+    /// @brief                  Perform numerical integration of a batch of independent trajectories from a start time
+    ///                         to an end time, in parallel
+    ///
+    /// @code
+    ///                         Array<Solution> solutions = numericalSolver.integrateTime(stateVectors, startTime,
+    ///                         endTime, systemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialStateVectorArray An array of initial n-dimensional state vectors, one per
+    ///                         trajectory
+    /// @param                  [in] aStartTime A time to begin integrating from
+    /// @param                  [in] anEndTime A time to integrate to
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @param                  [in] (optional) aThreadCount A maximum number of worker threads (0 for the hardware
+    ///                         concurrency)
+    /// @return                 Array<Solution>, one solution per trajectory and in the same order
+    ///
+    /// @warning                The system of equations is called concurrently from several threads and must be
+    ///                         thread-safe.
+
+    Array<Solution> integrateTime(
+        const Array<StateVector>& anInitialStateVectorArray,
+        const Real& aStartTime,
+        const Real& anEndTime,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const Size& aThreadCount = 0
+    );
+
+    /// @brief                  Perform dense output numerical integration from a start time to an end time
+    ///
+    /// @code
+    ///                         DenseTrajectory denseTrajectory = numericalSolver.integrateDenseTime(stateVector,
+    ///                         startTime, endTime, systemOfEquations);
+    ///                         VectorXd state = denseTrajectory.evaluate(someTime);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aStartTime A time to begin integrating from
+    /// @param                  [in] anEndTime A time to integrate to
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @return                 DenseTrajectory, evaluable at any time between the start and end times from the
+    ///                         stepper continuous extension, without further calls to the system of equations
+    ///
+    /// @warning                Only available with the RungeKuttaDopri5 stepper type
+
+    DenseTrajectory integrateDenseTime(
+        const StateVector& anInitialStateVector,
+        const Real& aStartTime,
+        const Real& anEndTime,
+        const SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief                  Perform dense output numerical integration for a specified duration
+    ///
+    /// @code
+    ///                         DenseTrajectory denseTrajectory = numericalSolver.integrateDenseDuration(stateVector,
+    ///                         durationSeconds, systemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aDurationInSeconds A duration over which to integrate
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @return                 DenseTrajectory, starting at time 0
+    ///
+    /// @warning                Only available with the RungeKuttaDopri5 stepper type
+
+    DenseTrajectory integrateDenseDuration(
+        const StateVector& anInitialStateVector,
+        const Real& aDurationInSeconds,
+        const SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief                  Perform numerical integration of an ensemble of states for a specified duration
+    ///
+    /// @code
+    ///                         EnsembleSolution ensembleSolution = numericalSolver.integrateEnsembleDuration(
+    ///                         ensembleState, durationSeconds, ensembleSystemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialEnsembleState An initial ensemble state, one n-dimensional state vector
+    ///                         per column
+    /// @param                  [in] aDurationInSeconds A duration over which to integrate
+    /// @param                  [in] anEnsembleSystemOfEquations A std::function wrapper evaluating the derivatives of
+    ///                         all ensemble members (columns) in a single call
+    /// @param                  [in] (optional) anEnsembleStepControl The step size control strategy
+    /// @return                 EnsembleSolution
+    ///
+    /// @note                   With EnsembleStepControl::PerMember, members are integrated one after the other and
+    ///                         the ensemble dynamics are called with a single n x 1 column at a time: evaluations are
+    ///                         not vectorized across members. Use EnsembleStepControl::Shared to evaluate all members
+    ///                         in a single call.
+
+    EnsembleSolution integrateEnsembleDuration(
+        const EnsembleState& anInitialEnsembleState,
+        const Real& aDurationInSeconds,
+        const EnsembleSystemOfEquationsWrapper& anEnsembleSystemOfEquations,
+        const NumericalSolver::EnsembleStepControl& anEnsembleStepControl = NumericalSolver::EnsembleStepControl::Shared
+    );
+
+    /// @brief                  Perform numerical integration of an ensemble of states from a start time to an end time
+    ///
+    /// @code
+    ///                         EnsembleSolution ensembleSolution = numericalSolver.integrateEnsembleTime(
+    ///                         ensembleState, startTime, endTime, ensembleSystemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialEnsembleState An initial ensemble state, one n-dimensional state vector
+    ///                         per column
+    /// @param                  [in] aStartTime A time to begin integrating from
+    /// @param                  [in] anEndTime A time to integrate to
+    /// @param                  [in] anEnsembleSystemOfEquations A std::function wrapper evaluating the derivatives of
+    ///                         all ensemble members (columns) in a single call
+    /// @param                  [in] (optional) anEnsembleStepControl The step size control strategy
+    /// @return                 EnsembleSolution
+
+    EnsembleSolution integrateEnsembleTime(
+        const EnsembleState& anInitialEnsembleState,
+        const Real& aStartTime,
+        const Real& anEndTime,
+        const EnsembleSystemOfEquationsWrapper& anEnsembleSystemOfEquations,
+        const NumericalSolver::EnsembleStepControl& anEnsembleStepControl = NumericalSolver::EnsembleStepControl::Shared
+    );
+
+    /// @brief                  Perform numerical integration of a state and its state transition matrix from a start
+    ///                         time to an end time
+    ///
+    /// @code
+    ///                         VariationalSolution variationalSolution = numericalSolver.integrateVariationalTime(
+    ///                         stateVector, startTime, endTime, systemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aStartTime A time to begin integrating from
+    /// @param                  [in] anEndTime A time to integrate to
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @param                  [in] (optional) aStateTransitionMatrixErrorWeight A weight of the state transition
+    ///                         matrix in the step size control (0 to control the error of the state only)
+    /// @return                 VariationalSolution
+    ///
+    /// @note                   The variational equations dPhi/dt = df/dx Phi are integrated together with the state,
+    ///                         as a single n + n^2 vector holding the state followed by the column-major state
+    ///                         transition matrix. The Jacobian is the one set with setJacobian, or else computed by
+    ///                         finite differences. Only the state is observed. Available with the RungeKutta4,
+    ///                         RungeKuttaCashKarp54, RungeKuttaFehlberg78 and RungeKuttaDopri5 stepper types.
+
+    VariationalSolution integrateVariationalTime(
+        const StateVector& anInitialStateVector,
+        const Real& aStartTime,
+        const Real& anEndTime,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const Real& aStateTransitionMatrixErrorWeight = 1.0
+    );
+
+    /// @brief                  Perform numerical integration of a state and its state transition matrix for a
+    ///                         specified duration
+    ///
+    /// @code
+    ///                         VariationalSolution variationalSolution = numericalSolver.integrateVariationalDuration(
+    ///                         stateVector, durationSeconds, systemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aDurationInSeconds A duration over which to integrate
+    /// @param                  [in] aSystemOfEquations A std::function wrapper with a particular signature that
+    ///                         boost::odeint accepts to perform numerical integration
+    /// @param                  [in] (optional) aStateTransitionMatrixErrorWeight A weight of the state transition
+    ///                         matrix in the step size control (0 to control the error of the state only)
+    /// @return                 VariationalSolution, with time starting at 0
+    ///
+    /// @note                   Available with the RungeKutta4, RungeKuttaCashKarp54, RungeKuttaFehlberg78 and
+    ///                         RungeKuttaDopri5 stepper types.
+
+    VariationalSolution integrateVariationalDuration(
+        const StateVector& anInitialStateVector,
+        const Real& aDurationInSeconds,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const Real& aStateTransitionMatrixErrorWeight = 1.0
+    );
+
+    /// @brief                  Perform numerical integration of a state and its state transition matrix from a start
+    ///                         time to an end time, the Jacobian being obtained by automatic differentiation
+    ///
+    /// @code
+    ///                         VariationalSolution variationalSolution = numericalSolver.integrateVariationalTime(
+    ///                         stateVector, startTime, endTime, dualSystemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aStartTime A time to begin integrating from
+    /// @param                  [in] anEndTime A time to integrate to
+    /// @param                  [in] aDualSystemOfEquations A std::function wrapper evaluating the dynamics on dual
+    ///                         numbers (typically the same templated dynamics as the double ones)
+    /// @param                  [in] (optional) aStateTransitionMatrixErrorWeight A weight of the state transition
+    ///                         matrix in the step size control (0 to control the error of the state only)
+    /// @return                 VariationalSolution
+    ///
+    /// @note                   A single call to the dual system of equations yields both the state derivative and the
+    ///                         exact Jacobian.
+
+    VariationalSolution integrateVariationalTime(
+        const StateVector& anInitialStateVector,
+        const Real& aStartTime,
+        const Real& anEndTime,
+        const DualSystemOfEquationsWrapper& aDualSystemOfEquations,
+        const Real& aStateTransitionMatrixErrorWeight = 1.0
+    );
+
+    /// @brief                  Perform numerical integration of a state and its state transition matrix for a
+    ///                         specified duration, the Jacobian being obtained by automatic differentiation
+    ///
+    /// @code
+    ///                         VariationalSolution variationalSolution = numericalSolver.integrateVariationalDuration(
+    ///                         stateVector, durationSeconds, dualSystemOfEquations);
+    /// @endcode
+    /// @param                  [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+    /// @param                  [in] aDurationInSeconds A duration over which to integrate
+    /// @param                  [in] aDualSystemOfEquations A std::function wrapper evaluating the dynamics on dual
+    ///                         numbers
+    /// @param                  [in] (optional) aStateTransitionMatrixErrorWeight A weight of the state transition
+    ///                         matrix in the step size control (0 to control the error of the state only)
+    /// @return                 VariationalSolution, with time starting at 0
+
+    VariationalSolution integrateVariationalDuration(
+        const StateVector& anInitialStateVector,
+        const Real& aDurationInSeconds,
+        const DualSystemOfEquationsWrapper& aDualSystemOfEquations,
+        const Real& aStateTransitionMatrixErrorWeight = 1.0
+    );
+
     /// @brief                  Get string from the integration stepper type
     ///
     /// @code
@@ -281,6 +864,16 @@ class NumericalSolver
 
     static String StringFromLogType(const NumericalSolver::LogType& aLogType);
 
+    /// @brief                  Get string from the ensemble step control
+    ///
+    /// @code
+    ///                         NumericalSolver::StringFromEnsembleStepControl(anEnsembleStepControl);
+    /// @endcode
+    /// @param                  [in] anEnsembleStepControl An ensemble step control enum
+    /// @return                 String
+
+    static String StringFromEnsembleStepControl(const NumericalSolver::EnsembleStepControl& anEnsembleStepControl);
+
     /// @brief                  Undefined
     ///
     /// @return                 An undefined numerical solver
@@ -303,9 +896,66 @@ class NumericalSolver
     double getSignedTimeStep(const Real& aReal) const;
 
    private:
+    class ExplicitSolver;  // Compile-time configured solvers of an explicit Runge-Kutta stepper type, behind an
+                           // interface independent of the stepper type
+
     Array<Solution> observedStateVectors_;
+    StateObserver stateObserver_;
+    Size observationStepInterval_;
+    Real observationMinimumTimeSeparation_;
+    Size observationStepCount_;
+    Real lastObservationTime_;
+    JacobianWrapper jacobian_;
+    Statistics statistics_;
+    StepTraceHook stepTraceHook_;
+    std::shared_ptr<const ExplicitSolver> explicitSolver_;  // Built at the first explicit Runge-Kutta integration
+
+    void resetObservedStateVectors();
 
     void observeNumericalIntegration(const StateVector& x, const double t);
+
+    void recordStep(const double aTime, const double aStepSize, const bool isAccepted);
+
+    void recordDenseOutputStep(const double aPreviousTime, const double aCurrentTime, const Size& aCallCount);
+
+    bool isImplicit() const;
+
+    const ExplicitSolver* accessExplicitSolver();
+
+    void integrateImplicitTime(
+        StateVector& aState,
+        const double aStartTime,
+        const double anEndTime,
+        const Array<double>& anOutputTimeArray,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const std::function<void(const StateVector&, const double)>& anObserver
+    );
+
+    template <class Observer>
+    void integrateStateTimes(
+        StateVector& aState,
+        const Array<double>& aTimeArray,
+        const double aTimeStep,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const Observer& anObserver
+    );
+
+    template <class VariationalSystemOfEquations>
+    VariationalSolution integrateVariationalState(
+        const StateVector& anInitialStateVector,
+        const Real& aStartTime,
+        const Real& anEndTime,
+        const VariationalSystemOfEquations& aVariationalSystemOfEquations,
+        const Real& aStateTransitionMatrixErrorWeight
+    );
+
+    template <class State, class SystemOfEquations, class Observer>
+    void integrateStateDuration(
+        State& aState,
+        const Real& aDurationInSeconds,
+        const SystemOfEquations& aSystemOfEquations,
+        const Observer& anObserver
+    );
 };
 
 }  // namespace solver
@@ -0,0 +1,342 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Solver_NumericalSolverT__
+#define __OpenSpaceToolkit_Mathematics_Solver_NumericalSolverT__
+
+#include <boost/numeric/odeint.hpp>
+#include <boost/numeric/odeint/external/eigen/eigen.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace solver
+{
+
+using ostk::core::container::Pair;
+using ostk::core::type::Real;
+
+/// @brief                      Odeint stepper of a stepper type, for a state type
+///
+///                             Only explicit Runge-Kutta stepper types are available, others failing to compile.
+
+template <NumericalSolver::StepperType Type, class State>
+struct NumericalSolverTStepper;
+
+template <class State>
+struct NumericalSolverTStepper<NumericalSolver::StepperType::RungeKutta4, State>
+{
+    typedef boost::numeric::odeint::runge_kutta4<State> Stepper;
+
+    static constexpr bool IsControlled = false;
+
+    static Stepper Make(const double, const double)
+    {
+        return {};
+    }
+};
+
+template <class State>
+struct NumericalSolverTStepper<NumericalSolver::StepperType::RungeKuttaCashKarp54, State>
+{
+    typedef typename boost::numeric::odeint::result_of::make_controlled<
+        boost::numeric::odeint::runge_kutta_cash_karp54<State>>::type Stepper;
+
+    static constexpr bool IsControlled = true;
+
+    static Stepper Make(const double anAbsoluteTolerance, const double aRelativeTolerance)
+    {
+        return boost::numeric::odeint::make_controlled(
+            anAbsoluteTolerance, aRelativeTolerance, boost::numeric::odeint::runge_kutta_cash_karp54<State>()
+        );
+    }
+};
+
+template <class State>
+struct NumericalSolverTStepper<NumericalSolver::StepperType::RungeKuttaFehlberg78, State>
+{
+    typedef typename boost::numeric::odeint::result_of::make_controlled<
+        boost::numeric::odeint::runge_kutta_fehlberg78<State>>::type Stepper;
+
+    static constexpr bool IsControlled = true;
+
+    static Stepper Make(const double anAbsoluteTolerance, const double aRelativeTolerance)
+    {
+        return boost::numeric::odeint::make_controlled(
+            anAbsoluteTolerance, aRelativeTolerance, boost::numeric::odeint::runge_kutta_fehlberg78<State>()
+        );
+    }
+};
+
+template <class State>
+struct NumericalSolverTStepper<NumericalSolver::StepperType::RungeKuttaDopri5, State>
+{
+    typedef typename boost::numeric::odeint::result_of::make_controlled<
+        boost::numeric::odeint::runge_kutta_dopri5<State>>::type Stepper;
+
+    static constexpr bool IsControlled = true;
+
+    static Stepper Make(const double anAbsoluteTolerance, const double aRelativeTolerance)
+    {
+        return boost::numeric::odeint::make_controlled(
+            anAbsoluteTolerance, aRelativeTolerance, boost::numeric::odeint::runge_kutta_dopri5<State>()
+        );
+    }
+};
+
+/// @brief                      Numerical ODE solver with a compile-time stepper type and state type
+///
+///                             The odeint stepper is configured at construction (and copied by each integration, the
+///                             odeint integrate functions taking it by value), and the system of equations and
+///                             observer are called as given (and may be inlined), without runtime dispatch over the
+///                             stepper type nor std::function indirection. NumericalSolver forwards its explicit
+///                             Runge-Kutta integrations to this class, with dynamic size or fixed size state vectors,
+///                             over [0, duration] (its time integrations being duration integrations, as they
+///                             always were).
+///
+/// @code
+///                             typedef NumericalSolverT<NumericalSolver::StepperType::RungeKuttaFehlberg78,
+///                             Eigen::Vector2d> Solver ;
+///                             const Solver numericalSolver = { NumericalSolver::LogType::NoLog, 5.0, 1e-12, 1e-12 } ;
+///                             const Solver::Solution solution = numericalSolver.integrateDuration(stateVector, 100.0,
+///                             systemOfEquations) ;
+/// @endcode
+
+template <NumericalSolver::StepperType Type, class State = NumericalSolver::StateVector>
+class NumericalSolverT
+{
+   public:
+    typedef State StateVector;
+    typedef Pair<State, double> Solution;
+    typedef typename NumericalSolverTStepper<Type, State>::Stepper Stepper;
+
+    /// @brief              Constructor
+    ///
+    /// @param              [in] aLogType A log type
+    /// @param              [in] aTimeStep An initial (or fixed) time step
+    /// @param              [in] aRelativeTolerance A relative tolerance
+    /// @param              [in] anAbsoluteTolerance An absolute tolerance
+
+    NumericalSolverT(
+        const NumericalSolver::LogType& aLogType,
+        const Real& aTimeStep,
+        const Real& aRelativeTolerance,
+        const Real& anAbsoluteTolerance
+    )
+        : logType_(aLogType),
+          timeStep_(aTimeStep),
+          relativeTolerance_(aRelativeTolerance),
+          absoluteTolerance_(anAbsoluteTolerance),
+          stepper_(NumericalSolverTStepper<Type, State>::Make(anAbsoluteTolerance, aRelativeTolerance))
+    {
+    }
+
+    /// @brief              Get log type
+    ///
+    /// @return             Log type
+
+    NumericalSolver::LogType getLogType() const
+    {
+        return logType_;
+    }
+
+    /// @brief              Get time step
+    ///
+    /// @return             Time step
+
+    double getTimeStep() const
+    {
+        return timeStep_;
+    }
+
+    /// @brief              Get relative tolerance
+    ///
+    /// @return             Relative tolerance
+
+    double getRelativeTolerance() const
+    {
+        return relativeTolerance_;
+    }
+
+    /// @brief              Get absolute tolerance
+    ///
+    /// @return             Absolute tolerance
+
+    double getAbsoluteTolerance() const
+    {
+        return absoluteTolerance_;
+    }
+
+    /// @brief              Access odeint stepper
+    ///
+    /// @return             Reference to odeint stepper
+
+    const Stepper& accessStepper() const
+    {
+        return stepper_;
+    }
+
+    /// @brief              Perform numerical integration for a duration
+    ///
+    /// @param              [in] anInitialStateVector An initial state vector
+    /// @param              [in] aDurationInSeconds A duration
+    /// @param              [in] aSystemOfEquations A system of equations, called as (x, dxdt, t)
+    /// @return             Solution
+
+    template <class SystemOfEquations>
+    Solution integrateDuration(
+        const State& anInitialStateVector, const double aDurationInSeconds, const SystemOfEquations& aSystemOfEquations
+    ) const
+    {
+        return this->integrateTime(anInitialStateVector, 0.0, aDurationInSeconds, aSystemOfEquations);
+    }
+
+    /// @brief              Perform numerical integration from a start time to an end time
+    ///
+    /// @param              [in] anInitialStateVector An initial state vector
+    /// @param              [in] aStartTime A start time
+    /// @param              [in] anEndTime An end time
+    /// @param              [in] aSystemOfEquations A system of equations, called as (x, dxdt, t)
+    /// @return             Solution
+
+    template <class SystemOfEquations>
+    Solution integrateTime(
+        const State& anInitialStateVector,
+        const double aStartTime,
+        const double anEndTime,
+        const SystemOfEquations& aSystemOfEquations
+    ) const
+    {
+        State stateVector = anInitialStateVector;
+
+        this->integrateState(
+            stateVector, aStartTime, anEndTime, aSystemOfEquations, [](const State&, const double) -> void {}
+        );
+
+        return {stateVector, anEndTime};
+    }
+
+    /// @brief              Integrate a state in place, observing the integration
+    ///
+    ///                     States are observed at each step (LogAdaptive, NoLog), or at multiples of the time step
+    ///                     (LogConstant), including the start and end states.
+    ///
+    /// @param              [in, out] aState A state, integrated from the start time to the end time
+    /// @param              [in] aStartTime A start time
+    /// @param              [in] anEndTime An end time
+    /// @param              [in] aSystemOfEquations A system of equations, called as (x, dxdt, t)
+    /// @param              [in] anObserver An observer, called as (x, t)
+
+    template <class SystemOfEquations, class Observer>
+    void integrateState(
+        State& aState,
+        const double aStartTime,
+        const double anEndTime,
+        const SystemOfEquations& aSystemOfEquations,
+        const Observer& anObserver
+    ) const
+    {
+        this->integrateState(
+            aState,
+            aStartTime,
+            anEndTime,
+            aSystemOfEquations,
+            anObserver,
+            [](const Stepper& aStepper) -> const Stepper&
+            {
+                return aStepper;
+            }
+        );
+    }
+
+    /// @brief              Integrate a state in place, observing the integration, with a decorated stepper
+    ///
+    /// @param              [in, out] aState A state, integrated from the start time to the end time
+    /// @param              [in] aStartTime A start time
+    /// @param              [in] anEndTime An end time
+    /// @param              [in] aSystemOfEquations A system of equations, called as (x, dxdt, t)
+    /// @param              [in] anObserver An observer, called as (x, t)
+    /// @param              [in] aStepperDecorator A function returning an odeint stepper forwarding to a given one
+
+    template <class SystemOfEquations, class Observer, class StepperDecorator>
+    void integrateState(
+        State& aState,
+        const double aStartTime,
+        const double anEndTime,
+        const SystemOfEquations& aSystemOfEquations,
+        const Observer& anObserver,
+        const StepperDecorator& aStepperDecorator
+    ) const
+    {
+        using boost::numeric::odeint::integrate_adaptive;
+        using boost::numeric::odeint::integrate_const;
+
+        if (anEndTime == aStartTime)  // If integration duration is zero seconds long, skip integration
+        {
+            return;
+        }
+
+        // Ensure integration starts in the correct direction with the initial time step guess
+        const double timeStep = timeStep_ * double((anEndTime > aStartTime) - (anEndTime < aStartTime));
+
+        // Integrate_adaptive uses constant step size under the hood for a stepper without error control like RK4:
+        // integrate_const is used instead
+
+        if ((!NumericalSolverTStepper<Type, State>::IsControlled) ||
+            (logType_ == NumericalSolver::LogType::LogConstant))
+        {
+            integrate_const(
+                aStepperDecorator(stepper_), aSystemOfEquations, aState, aStartTime, anEndTime, timeStep, anObserver
+            );
+            return;
+        }
+
+        integrate_adaptive(
+            aStepperDecorator(stepper_), aSystemOfEquations, aState, aStartTime, anEndTime, timeStep, anObserver
+        );
+    }
+
+    /// @brief              Constructs a numerical solver from the settings of a runtime configured one
+    ///
+    /// @param              [in] aNumericalSolver A numerical solver, of the same stepper type
+    /// @return             Numerical solver
+
+    static NumericalSolverT FromNumericalSolver(const NumericalSolver& aNumericalSolver)
+    {
+        if (!aNumericalSolver.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Numerical solver");
+        }
+
+        if (aNumericalSolver.getStepperType() != Type)
+        {
+            throw ostk::core::error::runtime::Wrong("Stepper type");
+        }
+
+        return {
+            aNumericalSolver.getLogType(),
+            aNumericalSolver.getTimeStep(),
+            aNumericalSolver.getRelativeTolerance(),
+            aNumericalSolver.getAbsoluteTolerance(),
+        };
+    }
+
+   private:
+    NumericalSolver::LogType logType_;
+    double timeStep_;
+    double relativeTolerance_;
+    double absoluteTolerance_;
+    Stepper stepper_;
+};
+
+}  // namespace solver
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,170 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Solver_Parareal__
+#define __OpenSpaceToolkit_Mathematics_Solver_Parareal__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace solver
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+/// @brief                      Parallel-in-time (Parareal) numerical integration
+///
+///                             The integration interval is split into time slices. A cheap coarse solver propagates
+///                             the state sequentially across slices, while an accurate fine solver propagates every
+///                             slice in parallel from the current slice start states. Each iteration corrects the
+///                             slice start states with the difference between the fine and coarse propagations, until
+///                             the correction falls below a tolerance. After as many iterations as slices, the result
+///                             is that of the fine solver run sequentially.
+///
+///                             Each slice is integrated over its own time window, so that the dynamics may depend on
+///                             time, and ends on the slice end time with a partial step when its duration is not a
+///                             multiple of the solver time step.
+///
+///                             The threads are started once per integration, and reused by all iterations. The system
+///                             of equations is called from several threads at once, and must be thread-safe.
+
+class Parareal
+{
+   public:
+    /// @brief              Statistics of the last integration
+
+    struct Statistics
+    {
+        Size iterationCount = 0;                     ///< Number of Parareal iterations
+        bool isConverged = false;                    ///< True if the correction fell below the tolerance
+        Real correction = Real::Undefined();         ///< Last correction, relative to the state magnitude
+        Real wallTime = Real::Undefined();           ///< Wall clock duration of the integration [s]
+        Real serialFineTime = Real::Undefined();     ///< Sum of the first iteration fine slice durations [s]
+        Real speedup = Real::Undefined();            ///< Serial fine time over wall time
+    };
+
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     Parareal parareal = { coarseSolver, fineSolver, 16, 1e-10, 8 } ;
+    ///                     NumericalSolver::Solution solution =
+    ///                         parareal.integrateDuration(stateVector, 1e5, systemOfEquations) ;
+    /// @endcode
+    ///
+    /// @param              [in] aCoarseSolver A cheap numerical solver, such as RK4 with a large time step
+    /// @param              [in] aFineSolver An accurate numerical solver, such as RKF78
+    /// @param              [in] aSliceCount A number of time slices
+    /// @param              [in] aTolerance A correction tolerance, relative to the state magnitude
+    /// @param              [in] aMaximumIterationCount A maximum number of iterations
+    /// @param              [in] (optional) aThreadCount A number of threads (0 uses the hardware concurrency)
+
+    Parareal(
+        const NumericalSolver& aCoarseSolver,
+        const NumericalSolver& aFineSolver,
+        const Size& aSliceCount,
+        const Real& aTolerance,
+        const Size& aMaximumIterationCount,
+        const Size& aThreadCount = 0
+    );
+
+    /// @brief              Output stream operator
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] aParareal A Parareal integrator
+    /// @return             Output stream reference
+
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Parareal& aParareal);
+
+    /// @brief              Check if Parareal integrator is defined
+    ///
+    /// @return             True if Parareal integrator is defined
+
+    bool isDefined() const;
+
+    /// @brief              Print Parareal integrator
+    ///
+    /// @param              [in] anOutputStream An output stream
+    /// @param              [in] (optional) displayDecorators If true, display decorators
+
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief              Get number of time slices
+    ///
+    /// @return             Number of time slices
+
+    Size getSliceCount() const;
+
+    /// @brief              Get correction tolerance
+    ///
+    /// @return             Correction tolerance
+
+    Real getTolerance() const;
+
+    /// @brief              Get maximum number of iterations
+    ///
+    /// @return             Maximum number of iterations
+
+    Size getMaximumIterationCount() const;
+
+    /// @brief              Get statistics of the last integration
+    ///
+    /// @return             Statistics
+
+    Statistics getStatistics() const;
+
+    /// @brief              Perform Parareal integration from a start time to an end time
+    ///
+    /// @param              [in] anInitialStateVector An initial state vector
+    /// @param              [in] aStartTime A start time
+    /// @param              [in] anEndTime An end time
+    /// @param              [in] aSystemOfEquations A thread-safe system of equations
+    /// @return             Solution
+
+    NumericalSolver::Solution integrateTime(
+        const NumericalSolver::StateVector& anInitialStateVector,
+        const Real& aStartTime,
+        const Real& anEndTime,
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief              Perform Parareal integration over a duration
+    ///
+    /// @param              [in] anInitialStateVector An initial state vector
+    /// @param              [in] aDurationInSeconds A duration
+    /// @param              [in] aSystemOfEquations A thread-safe system of equations
+    /// @return             Solution
+
+    NumericalSolver::Solution integrateDuration(
+        const NumericalSolver::StateVector& anInitialStateVector,
+        const Real& aDurationInSeconds,
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief              Constructs an undefined Parareal integrator
+    ///
+    /// @return             Undefined Parareal integrator
+
+    static Parareal Undefined();
+
+   private:
+    NumericalSolver coarseSolver_;
+    NumericalSolver fineSolver_;
+    Size sliceCount_;
+    Real tolerance_;
+    Size maximumIterationCount_;
+    Size threadCount_;
+
+    Statistics statistics_;
+};
+
+}  // namespace solver
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
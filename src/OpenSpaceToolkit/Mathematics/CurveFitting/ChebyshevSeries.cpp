@@ -0,0 +1,392 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/ChebyshevSeries.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+
+using ostk::mathematics::object::RowVectorXd;
+
+namespace
+{
+
+// Value of a series, given by its coefficients (one row per Chebyshev polynomial and one column per component), with
+// the Clenshaw recurrence
+
+VectorXd EvaluateClenshaw(const MatrixXd& aCoefficientMatrix, const double& u)
+{
+    RowVectorXd b1 = RowVectorXd::Zero(aCoefficientMatrix.cols());
+    RowVectorXd b2 = RowVectorXd::Zero(aCoefficientMatrix.cols());
+
+    for (Eigen::Index k = aCoefficientMatrix.rows() - 1; k >= 1; --k)
+    {
+        b2 = 2.0 * u * b1 - b2 + aCoefficientMatrix.row(k);
+        b1.swap(b2);
+    }
+
+    return (aCoefficientMatrix.row(0) + u * b1 - b2).transpose();
+}
+
+// Coefficients of the derivative of a series, with respect to u
+
+MatrixXd DifferentiateCoefficients(const MatrixXd& aCoefficientMatrix)
+{
+    const Eigen::Index n = aCoefficientMatrix.rows();
+
+    if (n == 1)
+    {
+        return MatrixXd::Zero(1, aCoefficientMatrix.cols());
+    }
+
+    MatrixXd derivativeCoefficients = MatrixXd::Zero(n - 1, aCoefficientMatrix.cols());
+
+    for (Eigen::Index k = n - 1; k >= 1; --k)
+    {
+        derivativeCoefficients.row(k - 1) = 2.0 * double(k) * aCoefficientMatrix.row(k);
+
+        if (k + 1 < n - 1)
+        {
+            derivativeCoefficients.row(k - 1) += derivativeCoefficients.row(k + 1);
+        }
+    }
+
+    derivativeCoefficients.row(0) *= 0.5;
+
+    return derivativeCoefficients;
+}
+
+// Values of the Chebyshev polynomials, up to a degree, at x values mapped from [aLowerBound, anUpperBound] to [-1, 1]
+
+MatrixXd ComputeChebyshevMatrix(
+    const Eigen::Ref<const VectorXd>& anXVector,
+    const double& aLowerBound,
+    const double& anUpperBound,
+    const Size& aDegree
+)
+{
+    const VectorXd u = ((2.0 * anXVector.array() - aLowerBound - anUpperBound) / (anUpperBound - aLowerBound)).matrix();
+
+    MatrixXd chebyshevMatrix(anXVector.size(), aDegree + 1);
+
+    chebyshevMatrix.col(0).setOnes();
+
+    if (aDegree > 0)
+    {
+        chebyshevMatrix.col(1) = u;
+    }
+
+    for (Eigen::Index k = 2; k <= Eigen::Index(aDegree); ++k)
+    {
+        chebyshevMatrix.col(k) =
+            (2.0 * u.array() * chebyshevMatrix.col(k - 1).array() - chebyshevMatrix.col(k - 2).array()).matrix();
+    }
+
+    return chebyshevMatrix;
+}
+
+void ValidateSamples(const VectorXd& anXVector, const MatrixXd& aYMatrix)
+{
+    if ((anXVector.size() != aYMatrix.rows()) || (aYMatrix.cols() == 0))
+    {
+        throw ostk::core::error::runtime::Wrong("x and y");
+    }
+
+    if (anXVector.size() < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("x");
+    }
+
+    const Eigen::Index n = anXVector.size();
+
+    if (!((anXVector.tail(n - 1) - anXVector.head(n - 1)).array() > 0.0).all())
+    {
+        throw ostk::core::error::runtime::Wrong("x must be strictly increasing");
+    }
+}
+
+// Index of the first sample, and number of samples, within [aLowerBound, anUpperBound]
+
+std::pair<Eigen::Index, Eigen::Index> FindSampleRange(
+    const VectorXd& anXVector, const double& aLowerBound, const double& anUpperBound
+)
+{
+    const auto firstIterator = std::lower_bound(anXVector.begin(), anXVector.end(), aLowerBound);
+    const auto lastIterator = std::upper_bound(firstIterator, anXVector.end(), anUpperBound);
+
+    return {std::distance(anXVector.begin(), firstIterator), std::distance(firstIterator, lastIterator)};
+}
+
+// Least squares fit, on a segment, and largest residual
+
+std::pair<MatrixXd, double> FitSegment(
+    const VectorXd& anXVector,
+    const MatrixXd& aYMatrix,
+    const double& aLowerBound,
+    const double& anUpperBound,
+    const Size& aDegree
+)
+{
+    const auto [startIndex, sampleCount] = FindSampleRange(anXVector, aLowerBound, anUpperBound);
+
+    const MatrixXd chebyshevMatrix =
+        ComputeChebyshevMatrix(anXVector.segment(startIndex, sampleCount), aLowerBound, anUpperBound, aDegree);
+    const MatrixXd yMatrix = aYMatrix.middleRows(startIndex, sampleCount);
+
+    const MatrixXd coefficientMatrix = chebyshevMatrix.colPivHouseholderQr().solve(yMatrix);
+
+    return {coefficientMatrix, (chebyshevMatrix * coefficientMatrix - yMatrix).cwiseAbs().maxCoeff()};
+}
+
+// Fit on a segment, split in halves (recursively) while the tolerance is not met
+
+void FitAdaptiveSegment(
+    const VectorXd& anXVector,
+    const MatrixXd& aYMatrix,
+    const double& aLowerBound,
+    const double& anUpperBound,
+    const Size& aDegree,
+    const double& aTolerance,
+    Array<double>& aBreakpointArray,
+    Array<MatrixXd>& aCoefficientArray
+)
+{
+    const auto [coefficientMatrix, residual] = FitSegment(anXVector, aYMatrix, aLowerBound, anUpperBound, aDegree);
+
+    if (residual > aTolerance)
+    {
+        const double middle = 0.5 * (aLowerBound + anUpperBound);
+
+        const Eigen::Index lowerSampleCount = FindSampleRange(anXVector, aLowerBound, middle).second;
+        const Eigen::Index upperSampleCount = FindSampleRange(anXVector, middle, anUpperBound).second;
+
+        if ((lowerSampleCount > Eigen::Index(aDegree)) && (upperSampleCount > Eigen::Index(aDegree)))
+        {
+            FitAdaptiveSegment(
+                anXVector, aYMatrix, aLowerBound, middle, aDegree, aTolerance, aBreakpointArray, aCoefficientArray
+            );
+            FitAdaptiveSegment(
+                anXVector, aYMatrix, middle, anUpperBound, aDegree, aTolerance, aBreakpointArray, aCoefficientArray
+            );
+
+            return;
+        }
+    }
+
+    aBreakpointArray.add(anUpperBound);
+    aCoefficientArray.add(coefficientMatrix);
+}
+
+}  // namespace
+
+ChebyshevSeries::ChebyshevSeries(const VectorXd& aBreakpointVector, const Array<MatrixXd>& aCoefficientArray)
+    : breakpoints_(aBreakpointVector),
+      coefficients_(aCoefficientArray)
+{
+    const Eigen::Index segmentCount = coefficients_.getSize();
+
+    if ((segmentCount == 0) || (breakpoints_.size() != segmentCount + 1))
+    {
+        throw ostk::core::error::runtime::Wrong("Breakpoints");
+    }
+
+    if (!((breakpoints_.tail(segmentCount) - breakpoints_.head(segmentCount)).array() > 0.0).all())
+    {
+        throw ostk::core::error::runtime::Wrong("Breakpoints must be strictly increasing");
+    }
+
+    for (const MatrixXd& coefficientMatrix : coefficients_)
+    {
+        if ((coefficientMatrix.rows() == 0) || (coefficientMatrix.cols() == 0) ||
+            (coefficientMatrix.cols() != coefficients_.accessFirst().cols()))
+        {
+            throw ostk::core::error::runtime::Wrong("Coefficients");
+        }
+    }
+}
+
+Size ChebyshevSeries::getSegmentCount() const
+{
+    return coefficients_.getSize();
+}
+
+Size ChebyshevSeries::getComponentCount() const
+{
+    return coefficients_.accessFirst().cols();
+}
+
+VectorXd ChebyshevSeries::getBreakpoints() const
+{
+    return breakpoints_;
+}
+
+Array<MatrixXd> ChebyshevSeries::getCoefficients() const
+{
+    return coefficients_;
+}
+
+MatrixXd ChebyshevSeries::evaluate(const VectorXd& aQueryVector) const
+{
+    return evaluateDerivative(aQueryVector, 0);
+}
+
+VectorXd ChebyshevSeries::evaluate(const double& aQueryValue) const
+{
+    const Index segmentIndex = findSegmentIndex(aQueryValue);
+
+    const double lowerBound = breakpoints_(segmentIndex);
+    const double upperBound = breakpoints_(segmentIndex + 1);
+
+    return EvaluateClenshaw(
+        coefficients_[segmentIndex], (2.0 * aQueryValue - lowerBound - upperBound) / (upperBound - lowerBound)
+    );
+}
+
+MatrixXd ChebyshevSeries::evaluateDerivative(const VectorXd& aQueryVector, const Size& anOrder) const
+{
+    MatrixXd derivatives(aQueryVector.size(), getComponentCount());
+
+    // Coefficients of the derivative on the last segment, reused as long as the queries stay in it
+
+    MatrixXd derivativeCoefficients;
+    Index derivativeSegmentIndex = coefficients_.getSize();
+
+    for (Eigen::Index i = 0; i < aQueryVector.size(); ++i)
+    {
+        const Index segmentIndex = findSegmentIndex(aQueryVector(i));
+
+        const double lowerBound = breakpoints_(segmentIndex);
+        const double upperBound = breakpoints_(segmentIndex + 1);
+
+        if (segmentIndex != derivativeSegmentIndex)
+        {
+            derivativeSegmentIndex = segmentIndex;
+            derivativeCoefficients = coefficients_[segmentIndex];
+
+            for (Size order = 0; order < anOrder; ++order)
+            {
+                derivativeCoefficients = DifferentiateCoefficients(derivativeCoefficients);
+            }
+
+            derivativeCoefficients *= std::pow(2.0 / (upperBound - lowerBound), double(anOrder));
+        }
+
+        const double u = (2.0 * aQueryVector(i) - lowerBound - upperBound) / (upperBound - lowerBound);
+
+        derivatives.row(i) = EvaluateClenshaw(derivativeCoefficients, u).transpose();
+    }
+
+    return derivatives;
+}
+
+VectorXd ChebyshevSeries::evaluateDerivative(const double& aQueryValue, const Size& anOrder) const
+{
+    return evaluateDerivative(VectorXd::Constant(1, aQueryValue), anOrder).row(0).transpose();
+}
+
+ChebyshevSeries ChebyshevSeries::Fit(
+    const VectorXd& anXVector, const MatrixXd& aYMatrix, const Size& aDegree, const Size& aSegmentCount
+)
+{
+    ValidateSamples(anXVector, aYMatrix);
+
+    if (aSegmentCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Segment count");
+    }
+
+    VectorXd breakpoints = VectorXd::LinSpaced(aSegmentCount + 1, anXVector(0), anXVector(anXVector.size() - 1));
+    breakpoints(aSegmentCount) = anXVector(anXVector.size() - 1);
+
+    Array<MatrixXd> coefficients = Array<MatrixXd>::Empty();
+
+    for (Index segmentIndex = 0; segmentIndex < aSegmentCount; ++segmentIndex)
+    {
+        const Eigen::Index sampleCount =
+            FindSampleRange(anXVector, breakpoints(segmentIndex), breakpoints(segmentIndex + 1)).second;
+
+        if (sampleCount <= Eigen::Index(aDegree))
+        {
+            throw ostk::core::error::RuntimeError(
+                "Segment [{}] contains [{}] samples, not more than the degree [{}].", segmentIndex, sampleCount, aDegree
+            );
+        }
+
+        coefficients.add(
+            FitSegment(anXVector, aYMatrix, breakpoints(segmentIndex), breakpoints(segmentIndex + 1), aDegree).first
+        );
+    }
+
+    return {breakpoints, coefficients};
+}
+
+ChebyshevSeries ChebyshevSeries::FitAdaptive(
+    const VectorXd& anXVector, const MatrixXd& aYMatrix, const Size& aDegree, const Real& aTolerance
+)
+{
+    ValidateSamples(anXVector, aYMatrix);
+
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
+
+    if (aTolerance <= 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    if (anXVector.size() <= Eigen::Index(aDegree))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Number of samples [{}] not more than the degree [{}].", anXVector.size(), aDegree
+        );
+    }
+
+    Array<double> breakpoints = {anXVector(0)};
+    Array<MatrixXd> coefficients = Array<MatrixXd>::Empty();
+
+    FitAdaptiveSegment(
+        anXVector,
+        aYMatrix,
+        anXVector(0),
+        anXVector(anXVector.size() - 1),
+        aDegree,
+        aTolerance,
+        breakpoints,
+        coefficients
+    );
+
+    return {Eigen::Map<const VectorXd>(breakpoints.data(), breakpoints.getSize()), coefficients};
+}
+
+Index ChebyshevSeries::findSegmentIndex(const double& aQueryValue) const
+{
+    const double lowerBound = breakpoints_(0);
+    const double upperBound = breakpoints_(breakpoints_.size() - 1);
+
+    if (!((aQueryValue >= lowerBound) && (aQueryValue <= upperBound)))
+    {
+        throw ostk::core::error::RuntimeError(
+            "x value [{}] out of bounds [{} - {}].", aQueryValue, lowerBound, upperBound
+        );
+    }
+
+    const Index upperBoundIndex =
+        std::distance(breakpoints_.begin(), std::upper_bound(breakpoints_.begin(), breakpoints_.end(), aQueryValue));
+
+    return std::min(upperBoundIndex, Index(breakpoints_.size() - 1)) - 1;
+}
+
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
@@ -1,11 +1,17 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/BarycentricRational.hpp>
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/CubicSpline.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Lagrange.hpp>
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Linear.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/NonUniformCubicSpline.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Streaming.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/ThreadPool.hpp>
 
 namespace ostk
 {
@@ -16,7 +22,11 @@ namespace curvefitting
 
 using ostk::mathematics::curvefitting::interpolator::BarycentricRational;
 using ostk::mathematics::curvefitting::interpolator::CubicSpline;
+using ostk::mathematics::curvefitting::interpolator::Lagrange;
 using ostk::mathematics::curvefitting::interpolator::Linear;
+using ostk::mathematics::curvefitting::interpolator::NonUniformCubicSpline;
+using ostk::mathematics::curvefitting::interpolator::Streaming;
+using ostk::mathematics::utility::ThreadPool;
 
 Interpolator::Interpolator(const Type& aType)
     : type_(aType)
@@ -30,6 +40,104 @@ Interpolator::Type Interpolator::getInterpolationType() const
     return type_;
 }
 
+void Interpolator::evaluate(const Eigen::Ref<const VectorXd>& aQueryVector, Eigen::Ref<VectorXd> aValueVector) const
+{
+    if (aValueVector.size() != aQueryVector.size())
+    {
+        throw ostk::core::error::runtime::Wrong("Value vector");
+    }
+
+    for (Eigen::Index i = 0; i < aQueryVector.size(); ++i)
+    {
+        aValueVector(i) = evaluate(aQueryVector(i));
+    }
+}
+
+VectorXd Interpolator::evaluateParallel(const VectorXd& aQueryVector, const Size& aThreadCount) const
+{
+    VectorXd yOutput(aQueryVector.size());
+
+    evaluateParallel(aQueryVector, yOutput, aThreadCount);
+
+    return yOutput;
+}
+
+void Interpolator::evaluateParallel(
+    const VectorXd& aQueryVector, Eigen::Ref<VectorXd> aValueVector, const Size& aThreadCount
+) const
+{
+    if (aValueVector.size() != aQueryVector.size())
+    {
+        throw ostk::core::error::runtime::Wrong("Value vector");
+    }
+
+    const Size queryCount = aQueryVector.size();
+    const Size chunkCount = (queryCount + ParallelEvaluationChunkSize - 1) / ParallelEvaluationChunkSize;
+
+    const Size threadCount =
+        std::min(chunkCount, (aThreadCount == 0) ? ThreadPool::DefaultThreadCount() : aThreadCount);
+
+    if ((queryCount < ParallelEvaluationThreshold) || (threadCount <= 1))
+    {
+        evaluate(aQueryVector, aValueVector);
+        return;
+    }
+
+    // Chunks are pulled from a shared counter, and each one is evaluated (as views on the query and value vectors) by
+    // the serial vector evaluation
+
+    ThreadPool threadPool(threadCount);
+
+    threadPool.run(
+        chunkCount,
+        [&](const Size& aChunkIndex, const Size&) -> void
+        {
+            const Size startIndex = aChunkIndex * ParallelEvaluationChunkSize;
+            const Size chunkSize = std::min(ParallelEvaluationChunkSize, queryCount - startIndex);
+
+            evaluate(aQueryVector.segment(startIndex, chunkSize), aValueVector.segment(startIndex, chunkSize));
+        }
+    );
+}
+
+VectorXd Interpolator::evaluateDerivative(const VectorXd& aQueryVector, const Size& anOrder) const
+{
+    VectorXd derivatives(aQueryVector.size());
+
+    for (Eigen::Index i = 0; i < aQueryVector.size(); ++i)
+    {
+        derivatives(i) = evaluateDerivative(aQueryVector(i), anOrder);
+    }
+
+    return derivatives;
+}
+
+MatrixXd Interpolator::evaluateWithDerivatives(const VectorXd& aQueryVector, const Size& aMaximumOrder) const
+{
+    MatrixXd valuesAndDerivatives(aQueryVector.size(), aMaximumOrder + 1);
+
+    for (Eigen::Index i = 0; i < aQueryVector.size(); ++i)
+    {
+        valuesAndDerivatives.row(i) = evaluateWithDerivatives(aQueryVector(i), aMaximumOrder).transpose();
+    }
+
+    return valuesAndDerivatives;
+}
+
+VectorXd Interpolator::evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const
+{
+    VectorXd valueAndDerivatives(aMaximumOrder + 1);
+
+    valueAndDerivatives(0) = evaluate(aQueryValue);
+
+    for (Size order = 1; order <= aMaximumOrder; ++order)
+    {
+        valueAndDerivatives(order) = evaluateDerivative(aQueryValue, order);
+    }
+
+    return valueAndDerivatives;
+}
+
 const Shared<const Interpolator> Interpolator::GenerateInterpolator(
     const Type& aType, const VectorXd& anXVector, const VectorXd& aYVector
 )
@@ -40,8 +148,14 @@ const Shared<const Interpolator> Interpolator::GenerateInterpolator(
             return std::make_shared<BarycentricRational>(anXVector, aYVector);
         case Type::CubicSpline:
             return std::make_shared<CubicSpline>(anXVector, aYVector);
+        case Type::Lagrange:
+            return std::make_shared<Lagrange>(anXVector, aYVector, std::min(Size(8), Size(anXVector.size())));
         case Type::Linear:
             return std::make_shared<Linear>(anXVector, aYVector);
+        case Type::NonUniformCubicSpline:
+            return std::make_shared<NonUniformCubicSpline>(anXVector, aYVector);
+        case Type::Streaming:
+            return std::make_shared<Streaming>(anXVector, aYVector);
         default:
             throw ostk::core::error::runtime::Wrong("Invalid interpolation type.");
     }
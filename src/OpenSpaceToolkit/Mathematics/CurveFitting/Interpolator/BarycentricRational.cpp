@@ -42,6 +42,21 @@ double BarycentricRational::evaluate(const double& aQueryValue) const
     return interpolator_(aQueryValue);
 }
 
+double BarycentricRational::evaluateDerivative(const double& aQueryValue, const Size& anOrder) const
+{
+    switch (anOrder)
+    {
+        case 0:
+            return interpolator_(aQueryValue);
+
+        case 1:
+            return interpolator_.prime(aQueryValue);
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Derivative order", anOrder);
+    }
+}
+
 }  // namespace interpolator
 }  // namespace curvefitting
 }  // namespace mathematics
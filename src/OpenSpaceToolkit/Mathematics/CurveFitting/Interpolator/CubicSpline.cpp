@@ -70,6 +70,24 @@ double CubicSpline::evaluate(const double& aQueryValue) const
     return interpolator_(aQueryValue);
 }
 
+double CubicSpline::evaluateDerivative(const double& aQueryValue, const Size& anOrder) const
+{
+    switch (anOrder)
+    {
+        case 0:
+            return interpolator_(aQueryValue);
+
+        case 1:
+            return interpolator_.prime(aQueryValue);
+
+        case 2:
+            return interpolator_.double_prime(aQueryValue);
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Derivative order", anOrder);
+    }
+}
+
 }  // namespace interpolator
 }  // namespace curvefitting
 }  // namespace mathematics
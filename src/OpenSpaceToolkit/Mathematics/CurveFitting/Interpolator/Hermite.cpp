@@ -0,0 +1,167 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Hermite.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Utility.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+namespace
+{
+
+// Validate the x values against the y values and their derivatives, and return the x steps
+
+VectorXd ComputeSteps(const VectorXd& anXVector, const VectorXd& aYVector, const VectorXd& aDerivativeVector)
+{
+    const Eigen::Index n = anXVector.size();
+
+    if ((n != aYVector.size()) || (n != aDerivativeVector.size()))
+    {
+        throw ostk::core::error::runtime::Wrong("x, y and dy/dx");
+    }
+
+    if (n < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("y");
+    }
+
+    const VectorXd dx = anXVector.tail(n - 1) - anXVector.head(n - 1);
+
+    if (!(dx.array() > 0.0).all())
+    {
+        throw ostk::core::error::runtime::Wrong("x must be strictly increasing");
+    }
+
+    return dx;
+}
+
+}  // namespace
+
+Hermite::Hermite(const VectorXd& anXVector, const VectorXd& aYVector, const VectorXd& aDerivativeVector)
+    : Interpolator(Interpolator::Type::Hermite),
+      x_(anXVector),
+      coefficients_()
+{
+    const VectorXd dx = ComputeSteps(anXVector, aYVector, aDerivativeVector);
+
+    coefficients_.resize(dx.size(), 4);
+
+    for (Eigen::Index i = 0; i < dx.size(); ++i)
+    {
+        const double h = dx(i);
+        const double slope = (aYVector(i + 1) - aYVector(i)) / h;
+
+        coefficients_(i, 0) = aYVector(i);
+        coefficients_(i, 1) = aDerivativeVector(i);
+        coefficients_(i, 2) = (3.0 * slope - 2.0 * aDerivativeVector(i) - aDerivativeVector(i + 1)) / h;
+        coefficients_(i, 3) = (aDerivativeVector(i) + aDerivativeVector(i + 1) - 2.0 * slope) / (h * h);
+    }
+}
+
+Hermite::Hermite(
+    const VectorXd& anXVector,
+    const VectorXd& aYVector,
+    const VectorXd& aDerivativeVector,
+    const VectorXd& aSecondDerivativeVector
+)
+    : Interpolator(Interpolator::Type::Hermite),
+      x_(anXVector),
+      coefficients_()
+{
+    const VectorXd dx = ComputeSteps(anXVector, aYVector, aDerivativeVector);
+
+    if (aSecondDerivativeVector.size() != anXVector.size())
+    {
+        throw ostk::core::error::runtime::Wrong("x and d2y/dx2");
+    }
+
+    coefficients_.resize(dx.size(), 6);
+
+    for (Eigen::Index i = 0; i < dx.size(); ++i)
+    {
+        const double h = dx(i);
+
+        const double y = aYVector(i);
+        const double dydx = aDerivativeVector(i);
+        const double d2ydx2 = aSecondDerivativeVector(i);
+
+        // Residuals at the end of the piece of the second order Taylor expansion at its start
+
+        const double r0 = aYVector(i + 1) - (y + h * (dydx + 0.5 * h * d2ydx2));
+        const double r1 = h * (aDerivativeVector(i + 1) - (dydx + h * d2ydx2));
+        const double r2 = h * h * (aSecondDerivativeVector(i + 1) - d2ydx2);
+
+        coefficients_(i, 0) = y;
+        coefficients_(i, 1) = dydx;
+        coefficients_(i, 2) = 0.5 * d2ydx2;
+        coefficients_(i, 3) = (10.0 * r0 - 4.0 * r1 + 0.5 * r2) / (h * h * h);
+        coefficients_(i, 4) = (-15.0 * r0 + 7.0 * r1 - r2) / (h * h * h * h);
+        coefficients_(i, 5) = (6.0 * r0 - 3.0 * r1 + 0.5 * r2) / (h * h * h * h * h);
+    }
+}
+
+Hermite::~Hermite() {}
+
+Size Hermite::getDegree() const
+{
+    return coefficients_.cols() - 1;
+}
+
+VectorXd Hermite::evaluate(const VectorXd& aQueryVector) const
+{
+    VectorXd yOutput(aQueryVector.size());
+
+    for (int i = 0; i < aQueryVector.size(); ++i)
+    {
+        yOutput(i) = evaluate(aQueryVector(i));
+    }
+
+    return yOutput;
+}
+
+double Hermite::evaluate(const double& aQueryValue) const
+{
+    const Index pieceIndex = findPieceIndex(aQueryValue);
+
+    const auto coefficients = coefficients_.row(pieceIndex);
+    const double t = aQueryValue - x_(pieceIndex);
+
+    double value = coefficients(coefficients.size() - 1);
+
+    for (Eigen::Index k = coefficients.size() - 2; k >= 0; --k)
+    {
+        value = value * t + coefficients(k);
+    }
+
+    return value;
+}
+
+double Hermite::evaluateDerivative(const double& aQueryValue, const Size& anOrder) const
+{
+    return evaluateWithDerivatives(aQueryValue, anOrder)(anOrder);
+}
+
+VectorXd Hermite::evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const
+{
+    const Index pieceIndex = findPieceIndex(aQueryValue);
+
+    return utility::EvaluatePolynomial(coefficients_.row(pieceIndex), aQueryValue - x_(pieceIndex), aMaximumOrder);
+}
+
+Index Hermite::findPieceIndex(const double& aQueryValue) const
+{
+    return utility::FindIntervalIndex(x_, aQueryValue);
+}
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,176 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Lagrange.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Utility.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+Lagrange::Lagrange(const VectorXd& anXVector, const VectorXd& aYVector, const Size& aPointCount)
+    : Interpolator(Interpolator::Type::Lagrange),
+      x_(anXVector),
+      y_(aYVector),
+      pointCount_(aPointCount)
+{
+    const Eigen::Index n = anXVector.size();
+
+    if (n != aYVector.size())
+    {
+        throw ostk::core::error::runtime::Wrong("x and y");
+    }
+
+    if ((pointCount_ < 2) || (pointCount_ > Size(n)))
+    {
+        throw ostk::core::error::runtime::Wrong("Point count");
+    }
+
+    if (!((anXVector.tail(n - 1) - anXVector.head(n - 1)).array() > 0.0).all())
+    {
+        throw ostk::core::error::runtime::Wrong("x must be strictly increasing");
+    }
+}
+
+Lagrange::~Lagrange() {}
+
+Size Lagrange::getPointCount() const
+{
+    return pointCount_;
+}
+
+VectorXd Lagrange::evaluate(const VectorXd& aQueryVector) const
+{
+    VectorXd yOutput(aQueryVector.size());
+
+    evaluate(aQueryVector, yOutput);
+
+    return yOutput;
+}
+
+void Lagrange::evaluate(const Eigen::Ref<const VectorXd>& aQueryVector, Eigen::Ref<VectorXd> aValueVector) const
+{
+    if (aValueVector.size() != aQueryVector.size())
+    {
+        throw ostk::core::error::runtime::Wrong("Value vector");
+    }
+
+    // Weights of the last window, reused as long as the queries stay in it
+
+    VectorXd weights(pointCount_);
+    Index windowStartIndex = x_.size();
+
+    for (int i = 0; i < aQueryVector.size(); ++i)
+    {
+        const Index queryWindowStartIndex = findWindowStartIndex(aQueryVector(i));
+
+        if (queryWindowStartIndex != windowStartIndex)
+        {
+            windowStartIndex = queryWindowStartIndex;
+            computeWeights(windowStartIndex, weights);
+        }
+
+        aValueVector(i) = interpolate(aQueryVector(i), windowStartIndex, weights);
+    }
+}
+
+double Lagrange::evaluate(const double& aQueryValue) const
+{
+    const Index windowStartIndex = findWindowStartIndex(aQueryValue);
+
+    VectorXd weights(pointCount_);
+    computeWeights(windowStartIndex, weights);
+
+    return interpolate(aQueryValue, windowStartIndex, weights);
+}
+
+double Lagrange::evaluateDerivative(const double& aQueryValue, const Size& anOrder) const
+{
+    return evaluateWithDerivatives(aQueryValue, anOrder)(anOrder);
+}
+
+VectorXd Lagrange::evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const
+{
+    return computeValueAndDerivatives(aQueryValue, findWindowStartIndex(aQueryValue), aMaximumOrder);
+}
+
+Index Lagrange::findWindowStartIndex(const double& aQueryValue) const
+{
+    return utility::FindWindowStartIndex(x_, aQueryValue, pointCount_);
+}
+
+VectorXd Lagrange::computeValueAndDerivatives(
+    const double& aQueryValue, const Index& aWindowStartIndex, const Size& aMaximumOrder
+) const
+{
+    // Newton form of the polynomial through the window, from its divided differences
+
+    const VectorXd nodes = x_.segment(aWindowStartIndex, pointCount_);
+    VectorXd coefficients = y_.segment(aWindowStartIndex, pointCount_);
+
+    for (Index level = 1; level < pointCount_; ++level)
+    {
+        for (Index i = pointCount_ - 1; i >= level; --i)
+        {
+            coefficients(i) = (coefficients(i) - coefficients(i - 1)) / (nodes(i) - nodes(i - level));
+        }
+    }
+
+    return utility::EvaluateNewtonPolynomial(coefficients, nodes, aQueryValue, aMaximumOrder);
+}
+
+void Lagrange::computeWeights(const Index& aWindowStartIndex, VectorXd& aWeightVector) const
+{
+    const auto x = x_.segment(aWindowStartIndex, pointCount_);
+
+    for (Index j = 0; j < pointCount_; ++j)
+    {
+        double product = 1.0;
+
+        for (Index k = 0; k < pointCount_; ++k)
+        {
+            if (k != j)
+            {
+                product *= x(j) - x(k);
+            }
+        }
+
+        aWeightVector(j) = 1.0 / product;
+    }
+}
+
+double Lagrange::interpolate(const double& aQueryValue, const Index& aWindowStartIndex, const VectorXd& aWeightVector)
+    const
+{
+    double numerator = 0.0;
+    double denominator = 0.0;
+
+    for (Index j = 0; j < pointCount_; ++j)
+    {
+        const Index index = aWindowStartIndex + j;
+        const double difference = aQueryValue - x_(index);
+
+        if (difference == 0.0)
+        {
+            return y_(index);
+        }
+
+        const double term = aWeightVector(j) / difference;
+
+        numerator += term * y_(index);
+        denominator += term;
+    }
+
+    return numerator / denominator;
+}
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,147 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/LagrangeHermite.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Utility.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+LagrangeHermite::LagrangeHermite(
+    const VectorXd& anXVector, const VectorXd& aYVector, const VectorXd& aDerivativeVector, const Size& aPointCount
+)
+    : Interpolator(Interpolator::Type::LagrangeHermite),
+      x_(anXVector),
+      y_(aYVector),
+      derivatives_(aDerivativeVector),
+      pointCount_(aPointCount)
+{
+    const Eigen::Index n = anXVector.size();
+
+    if ((n != aYVector.size()) || (n != aDerivativeVector.size()))
+    {
+        throw ostk::core::error::runtime::Wrong("x, y and dy/dx");
+    }
+
+    if ((pointCount_ < 2) || (pointCount_ > Size(n)))
+    {
+        throw ostk::core::error::runtime::Wrong("Point count");
+    }
+
+    if (!((anXVector.tail(n - 1) - anXVector.head(n - 1)).array() > 0.0).all())
+    {
+        throw ostk::core::error::runtime::Wrong("x must be strictly increasing");
+    }
+}
+
+LagrangeHermite::~LagrangeHermite() {}
+
+Size LagrangeHermite::getPointCount() const
+{
+    return pointCount_;
+}
+
+VectorXd LagrangeHermite::evaluate(const VectorXd& aQueryVector) const
+{
+    VectorXd yOutput(aQueryVector.size());
+
+    for (int i = 0; i < aQueryVector.size(); ++i)
+    {
+        yOutput(i) = evaluate(aQueryVector(i));
+    }
+
+    return yOutput;
+}
+
+double LagrangeHermite::evaluate(const double& aQueryValue) const
+{
+    const Index startIndex = findWindowStartIndex(aQueryValue);
+    const Index endIndex = startIndex + pointCount_;
+
+    double value = 0.0;
+
+    for (Index j = startIndex; j < endIndex; ++j)
+    {
+        const double xj = x_(j);
+
+        // Lagrange basis polynomial of the window at the query, and its derivative at its own node
+
+        double basis = 1.0;
+        double basisDerivative = 0.0;
+
+        for (Index k = startIndex; k < endIndex; ++k)
+        {
+            if (k != j)
+            {
+                basis *= (aQueryValue - x_(k)) / (xj - x_(k));
+                basisDerivative += 1.0 / (xj - x_(k));
+            }
+        }
+
+        value += (y_(j) + (aQueryValue - xj) * (derivatives_(j) - 2.0 * y_(j) * basisDerivative)) * basis * basis;
+    }
+
+    return value;
+}
+
+double LagrangeHermite::evaluateDerivative(const double& aQueryValue, const Size& anOrder) const
+{
+    return evaluateWithDerivatives(aQueryValue, anOrder)(anOrder);
+}
+
+VectorXd LagrangeHermite::evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const
+{
+    return computeValueAndDerivatives(aQueryValue, findWindowStartIndex(aQueryValue), aMaximumOrder);
+}
+
+Index LagrangeHermite::findWindowStartIndex(const double& aQueryValue) const
+{
+    return utility::FindWindowStartIndex(x_, aQueryValue, pointCount_);
+}
+
+VectorXd LagrangeHermite::computeValueAndDerivatives(
+    const double& aQueryValue, const Index& aWindowStartIndex, const Size& aMaximumOrder
+) const
+{
+    // Newton form of the Hermite polynomial of the window, from its divided differences on doubled x values, the first
+    // order differences on a doubled x value being the corresponding derivative
+
+    const Index nodeCount = 2 * pointCount_;
+
+    VectorXd nodes(nodeCount);
+    VectorXd coefficients(nodeCount);
+
+    for (Index j = 0; j < pointCount_; ++j)
+    {
+        nodes(2 * j) = nodes(2 * j + 1) = x_(aWindowStartIndex + j);
+        coefficients(2 * j) = coefficients(2 * j + 1) = y_(aWindowStartIndex + j);
+    }
+
+    for (Index i = nodeCount - 1; i >= 1; --i)
+    {
+        coefficients(i) = ((i % 2) == 1) ? derivatives_(aWindowStartIndex + (i - 1) / 2)
+                                         : (coefficients(i) - coefficients(i - 1)) / (nodes(i) - nodes(i - 1));
+    }
+
+    for (Index level = 2; level < nodeCount; ++level)
+    {
+        for (Index i = nodeCount - 1; i >= level; --i)
+        {
+            coefficients(i) = (coefficients(i) - coefficients(i - 1)) / (nodes(i) - nodes(i - level));
+        }
+    }
+
+    return utility::EvaluateNewtonPolynomial(coefficients, nodes, aQueryValue, aMaximumOrder);
+}
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Linear.hpp>
@@ -35,51 +37,138 @@ VectorXd Linear::evaluate(const VectorXd& aQueryVector) const
 {
     VectorXd yOutput(aQueryVector.size());
 
+    evaluate(aQueryVector, yOutput);
+
+    return yOutput;
+}
+
+void Linear::evaluate(const Eigen::Ref<const VectorXd>& aQueryVector, Eigen::Ref<VectorXd> aValueVector) const
+{
+    if (std::is_sorted(aQueryVector.begin(), aQueryVector.end()))
+    {
+        evaluateSorted(aQueryVector, aValueVector);
+        return;
+    }
+
+    if (aValueVector.size() != aQueryVector.size())
+    {
+        throw ostk::core::error::runtime::Wrong("Value vector");
+    }
+
     for (int i = 0; i < aQueryVector.size(); ++i)
     {
-        yOutput(i) = evaluate(aQueryVector(i));
+        aValueVector(i) = evaluate(aQueryVector(i));
     }
+}
 
-    return yOutput;
+void Linear::evaluateSorted(const Eigen::Ref<const VectorXd>& aQueryVector, Eigen::Ref<VectorXd> aValueVector) const
+{
+    if (aValueVector.size() != aQueryVector.size())
+    {
+        throw ostk::core::error::runtime::Wrong("Value vector");
+    }
+
+    // Cursor on the first x value not less than the current query value, only moving forward: it gallops (by doubling
+    // strides) past the x values less than the query, then the last stride is bisected, so that moving it by d costs
+    // O(log(d)), and the queries O(m log(n / m)) at worst
+
+    const Index xCount = x_.size();
+
+    Index lowerBoundIndex = 0;
+
+    for (int i = 0; i < aQueryVector.size(); ++i)
+    {
+        const double queryValue = aQueryVector(i);
+
+        Index upperIndex = lowerBoundIndex;
+        Index stride = 1;
+
+        while ((upperIndex < xCount) && (x_(upperIndex) < queryValue))
+        {
+            lowerBoundIndex = upperIndex + 1;
+            upperIndex += stride;
+            stride *= 2;
+        }
+
+        upperIndex = std::min(upperIndex, xCount);
+
+        lowerBoundIndex = std::distance(
+            x_.begin(), std::lower_bound(x_.begin() + lowerBoundIndex, x_.begin() + upperIndex, queryValue)
+        );
+
+        aValueVector(i) = interpolate(queryValue, getIndexRange(lowerBoundIndex));
+    }
 }
 
 double Linear::evaluate(const double& aQueryValue) const
+{
+    return interpolate(aQueryValue, findIndexRange(aQueryValue));
+}
+
+double Linear::evaluateDerivative(const double& aQueryValue, const Size& anOrder) const
 {
     using ostk::core::container::Unpack;
 
+    if (anOrder == 0)
+    {
+        return evaluate(aQueryValue);
+    }
+
     Index previousIndex;
     Index nextIndex;
 
     Unpack(previousIndex, nextIndex) = findIndexRange(aQueryValue);
 
-    if (previousIndex == nextIndex)
+    // Outside of the x range, the interpolator is constant
+
+    if ((anOrder > 1) || (previousIndex == nextIndex))
     {
-        return y_(previousIndex);
+        return 0.0;
     }
 
-    const double previousY = y_(previousIndex);
-    const double nextY = y_(nextIndex);
-
-    const Real Ratio = (aQueryValue - x_(previousIndex)) / (x_(nextIndex) - x_(previousIndex));
-
-    return previousY + Ratio * (nextY - previousY);
+    return (y_(nextIndex) - y_(previousIndex)) / (x_(nextIndex) - x_(previousIndex));
 }
 
 Pair<Index, Index> Linear::findIndexRange(const double& aQueryValue) const
 {
-    Index index = std::distance(x_.begin(), std::lower_bound(x_.begin(), x_.end(), aQueryValue));
+    return getIndexRange(std::distance(x_.begin(), std::lower_bound(x_.begin(), x_.end(), aQueryValue)));
+}
 
-    if (index == 0)
+Pair<Index, Index> Linear::getIndexRange(const Index& aLowerBoundIndex) const
+{
+    if (aLowerBoundIndex == 0)
     {
         return {0, 0};
     }
 
-    if (index == Index(x_.size()))
+    if (aLowerBoundIndex == Index(x_.size()))
     {
-        return {index - 1, index - 1};
+        return {aLowerBoundIndex - 1, aLowerBoundIndex - 1};
     }
 
-    return {index - 1, index};
+    return {aLowerBoundIndex - 1, aLowerBoundIndex};
+}
+
+double Linear::interpolate(const double& aQueryValue, const Pair<Index, Index>& anIndexRange) const
+{
+    using ostk::core::container::Unpack;
+
+    Index previousIndex;
+    Index nextIndex;
+
+    Unpack(previousIndex, nextIndex) = anIndexRange;
+
+    if (previousIndex == nextIndex)
+    {
+        return y_(previousIndex);
+    }
+
+    const double previousY = y_(previousIndex);
+    const double nextY = y_(nextIndex);
+
+    const Real Ratio = (aQueryValue - x_(previousIndex)) / (x_(nextIndex) - x_(previousIndex));
+
+    return previousY + Ratio * (nextY - previousY);
 }
 
 }  // namespace interpolator
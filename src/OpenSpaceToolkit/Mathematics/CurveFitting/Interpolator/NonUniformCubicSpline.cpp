@@ -0,0 +1,237 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/NonUniformCubicSpline.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Utility.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+NonUniformCubicSpline::NonUniformCubicSpline(
+    const VectorXd& anXVector, const VectorXd& aYVector, const BoundaryCondition& aBoundaryCondition
+)
+    : Interpolator(Interpolator::Type::NonUniformCubicSpline),
+      boundaryCondition_(aBoundaryCondition),
+      x_(anXVector),
+      coefficients_()
+{
+    computeCoefficients(aYVector, 0.0, 0.0);
+}
+
+NonUniformCubicSpline::NonUniformCubicSpline(
+    const VectorXd& anXVector, const VectorXd& aYVector, const Real& aStartDerivative, const Real& anEndDerivative
+)
+    : Interpolator(Interpolator::Type::NonUniformCubicSpline),
+      boundaryCondition_(BoundaryCondition::Clamped),
+      x_(anXVector),
+      coefficients_()
+{
+    if (!aStartDerivative.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Start derivative");
+    }
+
+    if (!anEndDerivative.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("End derivative");
+    }
+
+    computeCoefficients(aYVector, aStartDerivative, anEndDerivative);
+}
+
+NonUniformCubicSpline::~NonUniformCubicSpline() {}
+
+NonUniformCubicSpline::BoundaryCondition NonUniformCubicSpline::getBoundaryCondition() const
+{
+    return boundaryCondition_;
+}
+
+VectorXd NonUniformCubicSpline::evaluate(const VectorXd& aQueryVector) const
+{
+    VectorXd yOutput(aQueryVector.size());
+
+    for (int i = 0; i < aQueryVector.size(); ++i)
+    {
+        yOutput(i) = evaluate(aQueryVector(i));
+    }
+
+    return yOutput;
+}
+
+double NonUniformCubicSpline::evaluate(const double& aQueryValue) const
+{
+    const Index pieceIndex = findPieceIndex(aQueryValue);
+
+    const auto coefficients = coefficients_.row(pieceIndex);
+    const double t = aQueryValue - x_(pieceIndex);
+
+    return ((coefficients(3) * t + coefficients(2)) * t + coefficients(1)) * t + coefficients(0);
+}
+
+double NonUniformCubicSpline::evaluateDerivative(const double& aQueryValue, const Size& anOrder) const
+{
+    return evaluateWithDerivatives(aQueryValue, anOrder)(anOrder);
+}
+
+VectorXd NonUniformCubicSpline::evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const
+{
+    const Index pieceIndex = findPieceIndex(aQueryValue);
+
+    return utility::EvaluatePolynomial(coefficients_.row(pieceIndex), aQueryValue - x_(pieceIndex), aMaximumOrder);
+}
+
+String NonUniformCubicSpline::StringFromBoundaryCondition(const BoundaryCondition& aBoundaryCondition)
+{
+    switch (aBoundaryCondition)
+    {
+        case BoundaryCondition::Natural:
+            return "Natural";
+
+        case BoundaryCondition::Clamped:
+            return "Clamped";
+
+        case BoundaryCondition::NotAKnot:
+            return "NotAKnot";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Boundary condition");
+    }
+}
+
+void NonUniformCubicSpline::computeCoefficients(
+    const VectorXd& aYVector, const Real& aStartDerivative, const Real& anEndDerivative
+)
+{
+    const Eigen::Index n = x_.size();
+
+    if (n != aYVector.size())
+    {
+        throw ostk::core::error::runtime::Wrong("x and y");
+    }
+
+    if ((n < 2) || ((boundaryCondition_ == BoundaryCondition::NotAKnot) && (n < 4)))
+    {
+        throw ostk::core::error::runtime::Wrong("y");
+    }
+
+    const VectorXd dx = x_.tail(n - 1) - x_.head(n - 1);
+
+    if (!(dx.array() > 0.0).all())
+    {
+        throw ostk::core::error::runtime::Wrong("x must be strictly increasing");
+    }
+
+    const VectorXd slope = (aYVector.tail(n - 1) - aYVector.head(n - 1)).cwiseQuotient(dx);
+
+    // Tridiagonal system on the first derivatives s at the x values, with continuous second derivatives inside
+
+    VectorXd lower = VectorXd::Zero(n);
+    VectorXd diagonal = VectorXd::Zero(n);
+    VectorXd upper = VectorXd::Zero(n);
+    VectorXd rhs = VectorXd::Zero(n);
+
+    for (Eigen::Index i = 1; i < n - 1; ++i)
+    {
+        lower(i) = dx(i);
+        diagonal(i) = 2.0 * (dx(i - 1) + dx(i));
+        upper(i) = dx(i - 1);
+        rhs(i) = 3.0 * (dx(i) * slope(i - 1) + dx(i - 1) * slope(i));
+    }
+
+    switch (boundaryCondition_)
+    {
+        case BoundaryCondition::Natural:
+        {
+            diagonal(0) = 2.0;
+            upper(0) = 1.0;
+            rhs(0) = 3.0 * slope(0);
+
+            lower(n - 1) = 1.0;
+            diagonal(n - 1) = 2.0;
+            rhs(n - 1) = 3.0 * slope(n - 2);
+
+            break;
+        }
+
+        case BoundaryCondition::Clamped:
+        {
+            diagonal(0) = 1.0;
+            rhs(0) = aStartDerivative;
+
+            diagonal(n - 1) = 1.0;
+            rhs(n - 1) = anEndDerivative;
+
+            break;
+        }
+
+        case BoundaryCondition::NotAKnot:
+        {
+            const double startSpan = dx(0) + dx(1);
+
+            diagonal(0) = dx(1);
+            upper(0) = startSpan;
+            rhs(0) = ((dx(0) + 2.0 * startSpan) * dx(1) * slope(0) + dx(0) * dx(0) * slope(1)) / startSpan;
+
+            const double endSpan = dx(n - 3) + dx(n - 2);
+
+            lower(n - 1) = endSpan;
+            diagonal(n - 1) = dx(n - 3);
+            rhs(n - 1) =
+                (dx(n - 2) * dx(n - 2) * slope(n - 3) + (2.0 * endSpan + dx(n - 2)) * dx(n - 3) * slope(n - 2)) /
+                endSpan;
+
+            break;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Boundary condition");
+    }
+
+    // Thomas algorithm: forward elimination, then back substitution
+
+    for (Eigen::Index i = 1; i < n; ++i)
+    {
+        const double factor = lower(i) / diagonal(i - 1);
+
+        diagonal(i) -= factor * upper(i - 1);
+        rhs(i) -= factor * rhs(i - 1);
+    }
+
+    VectorXd derivatives(n);
+
+    derivatives(n - 1) = rhs(n - 1) / diagonal(n - 1);
+
+    for (Eigen::Index i = n - 2; i >= 0; --i)
+    {
+        derivatives(i) = (rhs(i) - upper(i) * derivatives(i + 1)) / diagonal(i);
+    }
+
+    // Polynomial form of each piece
+
+    coefficients_.resize(n - 1, 4);
+
+    for (Eigen::Index i = 0; i < n - 1; ++i)
+    {
+        coefficients_(i, 0) = aYVector(i);
+        coefficients_(i, 1) = derivatives(i);
+        coefficients_(i, 2) = (3.0 * slope(i) - 2.0 * derivatives(i) - derivatives(i + 1)) / dx(i);
+        coefficients_(i, 3) = (derivatives(i) + derivatives(i + 1) - 2.0 * slope(i)) / (dx(i) * dx(i));
+    }
+}
+
+Index NonUniformCubicSpline::findPieceIndex(const double& aQueryValue) const
+{
+    return utility::FindIntervalIndex(x_, aQueryValue);
+}
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,261 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Streaming.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Utility.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+
+namespace
+{
+
+// Coefficients, in increasing powers of (x - x0), of the cubic Hermite piece between two samples
+
+Eigen::RowVector4d ComputeCoefficients(
+    const double& anX0,
+    const double& anX1,
+    const double& aY0,
+    const double& aY1,
+    const double& aDerivative0,
+    const double& aDerivative1
+)
+{
+    const double h = anX1 - anX0;
+    const double slope = (aY1 - aY0) / h;
+
+    return {
+        aY0,
+        aDerivative0,
+        (3.0 * slope - 2.0 * aDerivative0 - aDerivative1) / h,
+        (aDerivative0 + aDerivative1 - 2.0 * slope) / (h * h)
+    };
+}
+
+}  // namespace
+
+Streaming::Streaming(const Size& aCapacity)
+    : Interpolator(Interpolator::Type::Streaming),
+      capacity_(aCapacity),
+      x_(),
+      y_(),
+      dydx_()
+{
+    if (capacity_ == 1)
+    {
+        throw ostk::core::error::runtime::Wrong("Capacity");
+    }
+}
+
+Streaming::Streaming(const VectorXd& anXVector, const VectorXd& aYVector, const Size& aCapacity)
+    : Streaming(aCapacity)
+{
+    append(anXVector, aYVector);
+}
+
+Streaming::~Streaming() {}
+
+bool Streaming::isDefined() const
+{
+    return x_.size() >= 2;
+}
+
+Size Streaming::getSize() const
+{
+    return x_.size();
+}
+
+Size Streaming::getCapacity() const
+{
+    return capacity_;
+}
+
+VectorXd Streaming::getXVector() const
+{
+    VectorXd xVector(x_.size());
+
+    std::copy(x_.begin(), x_.end(), xVector.begin());
+
+    return xVector;
+}
+
+VectorXd Streaming::getYVector() const
+{
+    VectorXd yVector(y_.size());
+
+    std::copy(y_.begin(), y_.end(), yVector.begin());
+
+    return yVector;
+}
+
+void Streaming::append(const double& anXValue, const double& aYValue)
+{
+    if (!x_.empty() && !(anXValue > x_.back()))
+    {
+        throw ostk::core::error::runtime::Wrong("x must be strictly increasing");
+    }
+
+    const bool isFull = (capacity_ != 0) && (x_.size() == capacity_);
+
+    if (isFull)
+    {
+        x_.pop_front();
+        y_.pop_front();
+        dydx_.pop_front();
+    }
+
+    x_.push_back(anXValue);
+    y_.push_back(aYValue);
+    dydx_.push_back(0.0);
+
+    // Only the derivatives at the last samples (and at the first one, if dropped) depend on the changed samples
+
+    const Index n = x_.size();
+
+    for (Index i = (n > 3) ? (n - 2) : 0; i < n; ++i)
+    {
+        updateDerivative(i);
+    }
+
+    if (isFull)
+    {
+        updateDerivative(0);
+    }
+}
+
+void Streaming::append(const VectorXd& anXVector, const VectorXd& aYVector)
+{
+    if (anXVector.size() != aYVector.size())
+    {
+        throw ostk::core::error::runtime::Wrong("x and y");
+    }
+
+    for (Eigen::Index i = 0; i < anXVector.size(); ++i)
+    {
+        append(anXVector(i), aYVector(i));
+    }
+}
+
+void Streaming::clear()
+{
+    x_.clear();
+    y_.clear();
+    dydx_.clear();
+}
+
+VectorXd Streaming::evaluate(const VectorXd& aQueryVector) const
+{
+    VectorXd yOutput(aQueryVector.size());
+
+    for (int i = 0; i < aQueryVector.size(); ++i)
+    {
+        yOutput(i) = evaluate(aQueryVector(i));
+    }
+
+    return yOutput;
+}
+
+double Streaming::evaluate(const double& aQueryValue) const
+{
+    const Index pieceIndex = findPieceIndex(aQueryValue);
+
+    const Eigen::RowVector4d coefficients = ComputeCoefficients(
+        x_[pieceIndex],
+        x_[pieceIndex + 1],
+        y_[pieceIndex],
+        y_[pieceIndex + 1],
+        dydx_[pieceIndex],
+        dydx_[pieceIndex + 1]
+    );
+
+    const double t = aQueryValue - x_[pieceIndex];
+
+    return coefficients(0) + t * (coefficients(1) + t * (coefficients(2) + t * coefficients(3)));
+}
+
+double Streaming::evaluateDerivative(const double& aQueryValue, const Size& anOrder) const
+{
+    return evaluateWithDerivatives(aQueryValue, anOrder)(anOrder);
+}
+
+VectorXd Streaming::evaluateWithDerivatives(const double& aQueryValue, const Size& aMaximumOrder) const
+{
+    const Index pieceIndex = findPieceIndex(aQueryValue);
+
+    const Eigen::RowVector4d coefficients = ComputeCoefficients(
+        x_[pieceIndex],
+        x_[pieceIndex + 1],
+        y_[pieceIndex],
+        y_[pieceIndex + 1],
+        dydx_[pieceIndex],
+        dydx_[pieceIndex + 1]
+    );
+
+    return utility::EvaluatePolynomial(coefficients, aQueryValue - x_[pieceIndex], aMaximumOrder);
+}
+
+void Streaming::updateDerivative(const Index& anIndex)
+{
+    const Index n = x_.size();
+
+    if (n == 1)
+    {
+        dydx_[anIndex] = 0.0;
+        return;
+    }
+
+    if (n == 2)
+    {
+        dydx_[anIndex] = (y_[1] - y_[0]) / (x_[1] - x_[0]);
+        return;
+    }
+
+    // Parabola through three consecutive samples, centered on the sample where possible
+
+    const Index middleIndex = std::min(std::max(anIndex, Index(1)), n - 2);
+
+    const double h0 = x_[middleIndex] - x_[middleIndex - 1];
+    const double h1 = x_[middleIndex + 1] - x_[middleIndex];
+
+    const double s0 = (y_[middleIndex] - y_[middleIndex - 1]) / h0;
+    const double s1 = (y_[middleIndex + 1] - y_[middleIndex]) / h1;
+
+    const double curvature = (s1 - s0) / (h0 + h1);
+
+    if (anIndex < middleIndex)
+    {
+        dydx_[anIndex] = s0 - curvature * h0;
+    }
+    else if (anIndex > middleIndex)
+    {
+        dydx_[anIndex] = s1 + curvature * h1;
+    }
+    else
+    {
+        dydx_[anIndex] = (h1 * s0 + h0 * s1) / (h0 + h1);
+    }
+}
+
+Index Streaming::findPieceIndex(const double& aQueryValue) const
+{
+    if (!isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Streaming");
+    }
+
+    return utility::FindIntervalIndex(x_, aQueryValue);
+}
+
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
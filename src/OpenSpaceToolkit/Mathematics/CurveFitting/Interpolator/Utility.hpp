@@ -0,0 +1,122 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Interpolator_Utility__
+#define __OpenSpaceToolkit_Mathematics_Interpolator_Utility__
+
+#include <algorithm>
+#include <iterator>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+// Helpers shared by the interpolator implementations (not installed)
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+namespace interpolator
+{
+namespace utility
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::VectorXd;
+
+/// @brief Value and derivatives, up to a maximum order, of a polynomial given by its coefficients in increasing
+/// powers of t
+inline VectorXd EvaluatePolynomial(
+    const Eigen::Ref<const Eigen::RowVectorXd>& aCoefficients, const double& t, const Size& aMaximumOrder
+)
+{
+    VectorXd valueAndDerivatives = VectorXd::Zero(aMaximumOrder + 1);
+
+    const Eigen::Index highestOrder = std::min(Eigen::Index(aMaximumOrder), Eigen::Index(aCoefficients.size() - 1));
+
+    for (Eigen::Index k = aCoefficients.size() - 1; k >= 0; --k)
+    {
+        for (Eigen::Index j = highestOrder; j > 0; --j)
+        {
+            valueAndDerivatives(j) = valueAndDerivatives(j) * t + double(j) * valueAndDerivatives(j - 1);
+        }
+
+        valueAndDerivatives(0) = valueAndDerivatives(0) * t + aCoefficients(k);
+    }
+
+    return valueAndDerivatives;
+}
+
+/// @brief Value and derivatives, up to a maximum order, of a polynomial in Newton form, given by its coefficients
+/// (divided differences) and nodes
+inline VectorXd EvaluateNewtonPolynomial(
+    const VectorXd& aCoefficientVector,
+    const VectorXd& aNodeVector,
+    const double& aQueryValue,
+    const Size& aMaximumOrder
+)
+{
+    VectorXd valueAndDerivatives = VectorXd::Zero(aMaximumOrder + 1);
+
+    const Eigen::Index highestOrder =
+        std::min(Eigen::Index(aMaximumOrder), Eigen::Index(aCoefficientVector.size() - 1));
+
+    for (Eigen::Index k = aCoefficientVector.size() - 1; k >= 0; --k)
+    {
+        const double t = aQueryValue - aNodeVector(k);
+
+        for (Eigen::Index j = highestOrder; j > 0; --j)
+        {
+            valueAndDerivatives(j) = valueAndDerivatives(j) * t + double(j) * valueAndDerivatives(j - 1);
+        }
+
+        valueAndDerivatives(0) = valueAndDerivatives(0) * t + aCoefficientVector(k);
+    }
+
+    return valueAndDerivatives;
+}
+
+/// @brief Index of the interval of ascending x values containing a query, the first and last intervals extending
+/// to extrapolated queries
+///
+/// @param anXContainer A container of at least two x values, in ascending order
+/// @param aQueryValue An x value
+/// @return Index of the lower bound of the interval
+template <class Container>
+Index FindIntervalIndex(const Container& anXContainer, const double& aQueryValue)
+{
+    const Index upperBoundIndex = std::distance(
+        std::begin(anXContainer), std::upper_bound(std::begin(anXContainer), std::end(anXContainer), aQueryValue)
+    );
+
+    return std::min(std::max(upperBoundIndex, Index(1)), Index(anXContainer.size() - 1)) - 1;
+}
+
+/// @brief Start index of a window of consecutive x values, centered on the interval containing a query and shifted
+/// to fit within the x values
+///
+/// @param anXContainer A container of x values, in ascending order, at least as many as the window
+/// @param aQueryValue An x value
+/// @param aPointCount A number of x values in the window, at least two
+/// @return Index of the first x value of the window
+template <class Container>
+Index FindWindowStartIndex(const Container& anXContainer, const double& aQueryValue, const Size& aPointCount)
+{
+    const Index lowerIndex = FindIntervalIndex(anXContainer, aQueryValue);
+    const Index offset = (aPointCount - 1) / 2;
+
+    return std::min(lowerIndex - std::min(lowerIndex, offset), Index(anXContainer.size()) - aPointCount);
+}
+
+}  // namespace utility
+}  // namespace interpolator
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
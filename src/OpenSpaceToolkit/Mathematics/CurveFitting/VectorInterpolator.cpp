@@ -0,0 +1,318 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/VectorInterpolator.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace curvefitting
+{
+
+namespace
+{
+
+// Cubic B-spline basis function, as in boost::math::interpolators::cardinal_cubic_b_spline
+double CubicBSpline(const double aValue)
+{
+    const double absoluteValue = std::abs(aValue);
+
+    if (absoluteValue < 1.0)
+    {
+        const double y = 2.0 - absoluteValue;
+        const double z = 1.0 - absoluteValue;
+
+        return (y * y * y - 4.0 * z * z * z) / 6.0;
+    }
+
+    if (absoluteValue < 2.0)
+    {
+        const double y = 2.0 - absoluteValue;
+
+        return y * y * y / 6.0;
+    }
+
+    return 0.0;
+}
+
+// Endpoint derivative of each column, from five uniformly spaced samples, as estimated (at both ends, from the
+// samples in increasing order) by boost::math::interpolators::cardinal_cubic_b_spline
+RowVectorXd EstimateEndpointDerivative(const Eigen::Ref<const MatrixXd>& aSampleMatrix, const double& anInverseStep)
+{
+    const double third = 1.0 / 3.0;
+
+    const RowVectorXd t0 = 4.0 * (aSampleMatrix.row(1) + third * aSampleMatrix.row(3));
+    const RowVectorXd t1 =
+        -(25.0 * third * aSampleMatrix.row(0) + aSampleMatrix.row(4)) / 4.0 - 3.0 * aSampleMatrix.row(2);
+
+    return anInverseStep * (t0 + t1);
+}
+
+// Floater-Hormann weights, as in boost::math::interpolators::barycentric_rational
+VectorXd BarycentricWeights(const VectorXd& anXVector, const Eigen::Index& anApproximationOrder)
+{
+    const Eigen::Index n = anXVector.size();
+
+    VectorXd weights = VectorXd::Zero(n);
+
+    for (Eigen::Index k = 0; k < n; ++k)
+    {
+        const Eigen::Index iMin = std::max(k - anApproximationOrder, Eigen::Index(0));
+        const Eigen::Index iMax = (k >= n - anApproximationOrder) ? (n - anApproximationOrder - 1) : k;
+
+        for (Eigen::Index i = iMin; i <= iMax; ++i)
+        {
+            double inverseProduct = 1.0;
+
+            for (Eigen::Index j = i; j <= std::min(i + anApproximationOrder, n - 1); ++j)
+            {
+                if (j != k)
+                {
+                    inverseProduct *= anXVector(k) - anXVector(j);
+                }
+            }
+
+            weights(k) += ((i % 2) == 0) ? (1.0 / inverseProduct) : (-1.0 / inverseProduct);
+        }
+    }
+
+    return weights;
+}
+
+}  // namespace
+
+VectorInterpolator::VectorInterpolator(
+    const Interpolator::Type& aType, const VectorXd& anXVector, const MatrixXd& aYMatrix
+)
+    : type_(aType),
+      x_(anXVector),
+      y_(aYMatrix),
+      weights_(),
+      average_(),
+      inverseStep_(0.0)
+{
+    if (anXVector.size() != aYMatrix.rows())
+    {
+        throw ostk::core::error::runtime::Wrong("x and y");
+    }
+
+    if (aYMatrix.cols() == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("y");
+    }
+
+    switch (type_)
+    {
+        case Interpolator::Type::Linear:
+        {
+            if (aYMatrix.rows() < 2)
+            {
+                throw ostk::core::error::runtime::Wrong("y");
+            }
+
+            break;
+        }
+
+        case Interpolator::Type::CubicSpline:
+        {
+            if (aYMatrix.rows() < 5)
+            {
+                throw ostk::core::error::runtime::Wrong("y");
+            }
+
+            const double h = anXVector(1) - anXVector(0);
+
+            const VectorXd diff =
+                anXVector.segment(1, anXVector.size() - 1) - anXVector.segment(0, anXVector.size() - 1);
+
+            if (!diff.isConstant(h, 1e-6))
+            {
+                throw ostk::core::error::runtime::Wrong("x must be uniformly spaced");
+            }
+
+            inverseStep_ = 1.0 / h;
+            average_ = aYMatrix.colwise().mean();
+
+            // Endpoint derivatives of all the components, estimated from the first and last five samples
+
+            const RowVectorXd leftDerivative = EstimateEndpointDerivative(aYMatrix.topRows(5), inverseStep_);
+            const RowVectorXd rightDerivative = EstimateEndpointDerivative(aYMatrix.bottomRows(5), inverseStep_);
+
+            // B-spline coefficients of all the components, from a single (almost) tridiagonal solve (Kress, 8.41)
+
+            const Eigen::Index n = aYMatrix.rows() + 2;
+
+            RowMajorMatrixXd rhs(n, aYMatrix.cols());
+            VectorXd superDiagonal(n);
+
+            rhs.row(0) = -2.0 * h * leftDerivative;
+            rhs.row(n - 1) = -2.0 * h * rightDerivative;
+
+            superDiagonal(0) = 0.0;
+
+            for (Eigen::Index i = 1; i < n - 1; ++i)
+            {
+                rhs.row(i) = 6.0 * (aYMatrix.row(i - 1) - average_);
+                superDiagonal(i) = 1.0;
+            }
+
+            superDiagonal(1) = 0.5;
+            rhs.row(1) = (rhs.row(1) - rhs.row(0)) / 4.0;
+
+            for (Eigen::Index i = 2; i < n - 1; ++i)
+            {
+                const double diagonal = 4.0 - superDiagonal(i - 1);
+
+                rhs.row(i) = (rhs.row(i) - rhs.row(i - 1)) / diagonal;
+                superDiagonal(i) /= diagonal;
+            }
+
+            const double finalSubDiagonal = -superDiagonal(n - 3);
+            rhs.row(n - 1) = (rhs.row(n - 1) - rhs.row(n - 3)) / finalSubDiagonal;
+
+            const double finalDiagonal = -1.0 / finalSubDiagonal - superDiagonal(n - 2);
+            rhs.row(n - 1) -= rhs.row(n - 2);
+
+            y_.resize(n, aYMatrix.cols());
+
+            y_.row(n - 1) = rhs.row(n - 1) / finalDiagonal;
+
+            for (Eigen::Index i = n - 2; i > 0; --i)
+            {
+                y_.row(i) = rhs.row(i) - superDiagonal(i) * y_.row(i + 1);
+            }
+
+            y_.row(0) = y_.row(2) + rhs.row(0);
+
+            break;
+        }
+
+        case Interpolator::Type::BarycentricRational:
+        {
+            const Eigen::Index approximationOrder = 3;
+
+            if (aYMatrix.rows() <= approximationOrder)
+            {
+                throw ostk::core::error::runtime::Wrong("y");
+            }
+
+            weights_ = BarycentricWeights(anXVector, approximationOrder);
+
+            break;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Invalid interpolation type.");
+    }
+}
+
+Interpolator::Type VectorInterpolator::getInterpolationType() const
+{
+    return type_;
+}
+
+Size VectorInterpolator::getComponentCount() const
+{
+    return y_.cols();
+}
+
+MatrixXd VectorInterpolator::evaluate(const VectorXd& aQueryVector) const
+{
+    MatrixXd yOutput(aQueryVector.size(), y_.cols());
+
+    for (Eigen::Index i = 0; i < aQueryVector.size(); ++i)
+    {
+        evaluate(aQueryVector(i), yOutput.row(i));
+    }
+
+    return yOutput;
+}
+
+VectorXd VectorInterpolator::evaluate(const double& aQueryValue) const
+{
+    RowVectorXd yOutput(y_.cols());
+
+    evaluate(aQueryValue, yOutput);
+
+    return yOutput.transpose();
+}
+
+void VectorInterpolator::evaluate(const double& aQueryValue, RowVectorRef aRow) const
+{
+    switch (type_)
+    {
+        case Interpolator::Type::Linear:
+            evaluateLinear(aQueryValue, aRow);
+            return;
+
+        case Interpolator::Type::CubicSpline:
+            evaluateCubicSpline(aQueryValue, aRow);
+            return;
+
+        case Interpolator::Type::BarycentricRational:
+            evaluateBarycentricRational(aQueryValue, aRow);
+            return;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Invalid interpolation type.");
+    }
+}
+
+void VectorInterpolator::evaluateLinear(const double& aQueryValue, RowVectorRef aRow) const
+{
+    const Eigen::Index index = std::distance(x_.begin(), std::lower_bound(x_.begin(), x_.end(), aQueryValue));
+
+    if (index == 0)
+    {
+        aRow = y_.row(0);
+        return;
+    }
+
+    if (index == x_.size())
+    {
+        aRow = y_.row(index - 1);
+        return;
+    }
+
+    const double ratio = (aQueryValue - x_(index - 1)) / (x_(index) - x_(index - 1));
+
+    aRow = y_.row(index - 1) + ratio * (y_.row(index) - y_.row(index - 1));
+}
+
+void VectorInterpolator::evaluateCubicSpline(const double& aQueryValue, RowVectorRef aRow) const
+{
+    // Only the (at most 5) B-splines whose support overlaps the query value contribute
+
+    const double t = inverseStep_ * (aQueryValue - x_(0)) + 1.0;
+
+    const long kMin = std::max(0L, long(std::ceil(t - 2.0)));
+    const long kMax = std::min(long(y_.rows()) - 1, long(std::floor(t + 2.0)));
+
+    aRow = average_;
+
+    for (long k = kMin; k <= kMax; ++k)
+    {
+        aRow += CubicBSpline(t - double(k)) * y_.row(k);
+    }
+}
+
+void VectorInterpolator::evaluateBarycentricRational(const double& aQueryValue, RowVectorRef aRow) const
+{
+    const auto nodeIterator = std::lower_bound(x_.begin(), x_.end(), aQueryValue);
+
+    if ((nodeIterator != x_.end()) && (*nodeIterator == aQueryValue))
+    {
+        aRow = y_.row(std::distance(x_.begin(), nodeIterator));
+        return;
+    }
+
+    const VectorXd terms = weights_.array() / (aQueryValue - x_.array());
+
+    aRow = (terms.transpose() * y_) / terms.sum();
+}
+
+}  // namespace curvefitting
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,222 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Solver/DenseTrajectory.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace solver
+{
+
+DenseTrajectory::DenseTrajectory(const VectorXd& aStepTimeVector, const MatrixXd& aNodeStateMatrix)
+    : stepTimes_(aStepTimeVector),
+      nodeStates_(aNodeStateMatrix)
+{
+    if (stepTimes_.size() == 0)
+    {
+        return;
+    }
+
+    if (stepTimes_.size() < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Step times");
+    }
+
+    const double direction = (stepTimes_(1) > stepTimes_(0)) ? 1.0 : -1.0;
+
+    for (Eigen::Index i = 1; i < stepTimes_.size(); ++i)
+    {
+        if (!(direction * (stepTimes_(i) - stepTimes_(i - 1)) > 0.0))
+        {
+            throw ostk::core::error::RuntimeError("Step times must be strictly monotonic.");
+        }
+    }
+
+    if (nodeStates_.cols() != Eigen::Index(NodeIntervalsPerStep * (stepTimes_.size() - 1) + 1))
+    {
+        throw ostk::core::error::runtime::Wrong("Node states");
+    }
+}
+
+bool DenseTrajectory::operator==(const DenseTrajectory& aDenseTrajectory) const
+{
+    if ((!this->isDefined()) || (!aDenseTrajectory.isDefined()))
+    {
+        return false;
+    }
+
+    return (stepTimes_.size() == aDenseTrajectory.stepTimes_.size()) &&
+           (nodeStates_.rows() == aDenseTrajectory.nodeStates_.rows()) &&
+           (nodeStates_.cols() == aDenseTrajectory.nodeStates_.cols()) &&
+           (stepTimes_ == aDenseTrajectory.stepTimes_) && (nodeStates_ == aDenseTrajectory.nodeStates_);
+}
+
+bool DenseTrajectory::operator!=(const DenseTrajectory& aDenseTrajectory) const
+{
+    return !((*this) == aDenseTrajectory);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const DenseTrajectory& aDenseTrajectory)
+{
+    aDenseTrajectory.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool DenseTrajectory::isDefined() const
+{
+    return stepTimes_.size() > 0;
+}
+
+void DenseTrajectory::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Dense Trajectory") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Start time:" << (this->isDefined() ? this->getStartTime().toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "End time:" << (this->isDefined() ? this->getEndTime().toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Step count:" << (this->isDefined() ? std::to_string(this->getStepCount()) : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "State dimension:" << (this->isDefined() ? std::to_string(this->getStateDimension()) : "Undefined");
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+const VectorXd& DenseTrajectory::accessStepTimes() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Dense trajectory");
+    }
+
+    return stepTimes_;
+}
+
+const MatrixXd& DenseTrajectory::accessNodeStates() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Dense trajectory");
+    }
+
+    return nodeStates_;
+}
+
+Size DenseTrajectory::getStepCount() const
+{
+    return this->accessStepTimes().size() - 1;
+}
+
+Size DenseTrajectory::getStateDimension() const
+{
+    return this->accessNodeStates().rows();
+}
+
+Real DenseTrajectory::getStartTime() const
+{
+    return this->accessStepTimes()(0);
+}
+
+Real DenseTrajectory::getEndTime() const
+{
+    return this->accessStepTimes()(stepTimes_.size() - 1);
+}
+
+VectorXd DenseTrajectory::evaluate(const Real& aTime) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Dense trajectory");
+    }
+
+    if (!aTime.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Time");
+    }
+
+    const Size stepIndex = this->findStepIndex(aTime);
+
+    const double stepStartTime = stepTimes_(stepIndex);
+    const double stepEndTime = stepTimes_(stepIndex + 1);
+
+    const double theta = (aTime - stepStartTime) / (stepEndTime - stepStartTime);
+
+    // Lagrange basis over the equispaced nodes theta_k = k / NodeIntervalsPerStep, which reproduces the step
+    // polynomial exactly
+
+    Eigen::Matrix<double, NodeIntervalsPerStep + 1, 1> weights;
+
+    for (Size j = 0; j <= NodeIntervalsPerStep; ++j)
+    {
+        const double thetaJ = double(j) / NodeIntervalsPerStep;
+
+        double weight = 1.0;
+
+        for (Size k = 0; k <= NodeIntervalsPerStep; ++k)
+        {
+            if (k != j)
+            {
+                const double thetaK = double(k) / NodeIntervalsPerStep;
+
+                weight *= (theta - thetaK) / (thetaJ - thetaK);
+            }
+        }
+
+        weights(j) = weight;
+    }
+
+    return nodeStates_.middleCols<NodeIntervalsPerStep + 1>(NodeIntervalsPerStep * stepIndex) * weights;
+}
+
+MatrixXd DenseTrajectory::evaluate(const VectorXd& aTimeVector) const
+{
+    MatrixXd states(this->getStateDimension(), aTimeVector.size());
+
+    for (Eigen::Index i = 0; i < aTimeVector.size(); ++i)
+    {
+        states.col(i) = this->evaluate(aTimeVector(i));
+    }
+
+    return states;
+}
+
+DenseTrajectory DenseTrajectory::Undefined()
+{
+    return {VectorXd(), MatrixXd()};
+}
+
+Size DenseTrajectory::findStepIndex(const double& aTime) const
+{
+    const double startTime = stepTimes_(0);
+    const double endTime = stepTimes_(stepTimes_.size() - 1);
+
+    if ((aTime < std::min(startTime, endTime)) || (aTime > std::max(startTime, endTime)))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Time [{}] is outside of the trajectory interval [{} - {}].", aTime, startTime, endTime
+        );
+    }
+
+    const auto upperBoundIterator = (endTime > startTime)
+                                      ? std::upper_bound(stepTimes_.begin(), stepTimes_.end(), aTime)
+                                      : std::upper_bound(stepTimes_.begin(), stepTimes_.end(), aTime, std::greater<>());
+
+    const Size upperBoundIndex = std::distance(stepTimes_.begin(), upperBoundIterator);
+
+    // Clamp to the last step, so that the trajectory end time belongs to it
+
+    return std::min(std::max(upperBoundIndex, Size(1)), Size(stepTimes_.size() - 1)) - 1;
+}
+
+}  // namespace solver
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,122 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Solver/EventCondition.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace solver
+{
+
+EventCondition::EventCondition(
+    const String& aName, const Criterion& aCriterion, const Evaluator& anEvaluator, const bool isTerminal
+)
+    : name_(aName),
+      criterion_(aCriterion),
+      evaluator_(anEvaluator),
+      terminal_(isTerminal)
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const EventCondition& anEventCondition)
+{
+    anEventCondition.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool EventCondition::isDefined() const
+{
+    return (!name_.isEmpty()) && (evaluator_ != nullptr);
+}
+
+bool EventCondition::isTerminal() const
+{
+    return terminal_;
+}
+
+void EventCondition::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Event Condition") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Name:" << (name_.isEmpty() ? "Undefined" : name_);
+    ostk::core::utils::Print::Line(anOutputStream) << "Criterion:" << EventCondition::StringFromCriterion(criterion_);
+    ostk::core::utils::Print::Line(anOutputStream) << "Terminal:" << (terminal_ ? "True" : "False");
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+String EventCondition::getName() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Event condition");
+    }
+
+    return name_;
+}
+
+EventCondition::Criterion EventCondition::getCriterion() const
+{
+    return criterion_;
+}
+
+double EventCondition::evaluate(const VectorXd& aStateVector, const double aTime) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Event condition");
+    }
+
+    return evaluator_(aStateVector, aTime);
+}
+
+bool EventCondition::isSatisfied(const double aPreviousValue, const double aCurrentValue) const
+{
+    switch (criterion_)
+    {
+        case EventCondition::Criterion::PositiveCrossing:
+            return (aPreviousValue < 0.0) && (aCurrentValue >= 0.0);
+
+        case EventCondition::Criterion::NegativeCrossing:
+            return (aPreviousValue > 0.0) && (aCurrentValue <= 0.0);
+
+        case EventCondition::Criterion::AnyCrossing:
+            return ((aPreviousValue < 0.0) && (aCurrentValue >= 0.0)) ||
+                   ((aPreviousValue > 0.0) && (aCurrentValue <= 0.0));
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Criterion");
+    }
+}
+
+String EventCondition::StringFromCriterion(const EventCondition::Criterion& aCriterion)
+{
+    switch (aCriterion)
+    {
+        case EventCondition::Criterion::PositiveCrossing:
+            return "PositiveCrossing";
+
+        case EventCondition::Criterion::NegativeCrossing:
+            return "NegativeCrossing";
+
+        case EventCondition::Criterion::AnyCrossing:
+            return "AnyCrossing";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Criterion");
+    }
+}
+
+EventCondition EventCondition::Undefined()
+{
+    return {String::Empty(), EventCondition::Criterion::AnyCrossing, nullptr, false};
+}
+
+}  // namespace solver
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,337 @@
+/// Apache License 2.0
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include <boost/numeric/odeint.hpp>
+#include <boost/numeric/odeint/external/eigen/eigen.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Solver/IntegrationSession.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace solver
+{
+
+using namespace boost::numeric::odeint;
+
+namespace
+{
+
+// Steps ending within this fraction of a step from the requested time end exactly at it, rather than leaving a
+// round-off sized step behind
+constexpr double FinalStepSlack = 1e-8;
+
+template <class ControlledStepper>
+std::function<bool(
+    const IntegrationSession::SystemOfEquationsWrapper&, IntegrationSession::StateVector&, double&, double&
+)>
+    makeTryStep(const ControlledStepper& aControlledStepper)
+{
+    return [stepper = aControlledStepper](
+               const IntegrationSession::SystemOfEquationsWrapper& aSystemOfEquations,
+               IntegrationSession::StateVector& x,
+               double& t,
+               double& dt
+           ) mutable -> bool
+    {
+        return stepper.try_step(aSystemOfEquations, x, t, dt) == success;
+    };
+}
+
+}  // namespace
+
+IntegrationSession::IntegrationSession(
+    const NumericalSolver& aNumericalSolver,
+    const StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const SystemOfEquationsWrapper& aSystemOfEquations
+)
+    : stepperType_(NumericalSolver::StepperType::RungeKuttaCashKarp54),
+      relativeTolerance_(Real::Undefined()),
+      absoluteTolerance_(Real::Undefined()),
+      systemOfEquations_(aSystemOfEquations),
+      tryStep_(nullptr),
+      stateVector_(anInitialStateVector),
+      time_(std::numeric_limits<double>::quiet_NaN()),
+      timeStep_(std::numeric_limits<double>::quiet_NaN()),
+      statistics_()
+{
+    if ((!aNumericalSolver.isDefined()) || (!aStartTime.isDefined()))
+    {
+        return;
+    }
+
+    stepperType_ = aNumericalSolver.getStepperType();
+    relativeTolerance_ = aNumericalSolver.getRelativeTolerance();
+    absoluteTolerance_ = aNumericalSolver.getAbsoluteTolerance();
+
+    time_ = aStartTime;
+    timeStep_ = std::abs(aNumericalSolver.getTimeStep());
+
+    this->initializeStepper();
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const IntegrationSession& anIntegrationSession)
+{
+    anIntegrationSession.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool IntegrationSession::isDefined() const
+{
+    return (tryStep_ != nullptr) && (systemOfEquations_ != nullptr) && (stateVector_.size() > 0);
+}
+
+void IntegrationSession::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Integration Session") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Integration stepper type:" << NumericalSolver::StringFromStepperType(stepperType_);
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Time:" << (this->isDefined() ? this->getTime().toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Time step:" << (this->isDefined() ? this->getTimeStep().toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "State dimension:" << (this->isDefined() ? std::to_string(stateVector_.size()) : "Undefined");
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+const IntegrationSession::StateVector& IntegrationSession::accessStateVector() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Integration session");
+    }
+
+    return stateVector_;
+}
+
+Real IntegrationSession::getTime() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Integration session");
+    }
+
+    return time_;
+}
+
+IntegrationSession::Solution IntegrationSession::getSolution() const
+{
+    return {this->accessStateVector(), time_};
+}
+
+Real IntegrationSession::getTimeStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Integration session");
+    }
+
+    return std::abs(timeStep_);
+}
+
+NumericalSolver::Statistics IntegrationSession::getStatistics() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Integration session");
+    }
+
+    return statistics_;
+}
+
+IntegrationSession::Solution IntegrationSession::advanceTo(const Real& aTime)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Integration session");
+    }
+
+    if (!aTime.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Time");
+    }
+
+    const std::chrono::steady_clock::time_point startInstant = std::chrono::steady_clock::now();
+
+    const double endTime = aTime;
+    const double direction = (endTime < time_) ? -1.0 : 1.0;
+
+    // The adapted step size carries over whichever the integration direction, as the FSAL derivative does
+    timeStep_ = direction * std::abs(timeStep_);
+
+    const SystemOfEquationsWrapper countedSystemOfEquations =
+        [this](const StateVector& x, StateVector& dxdt, const double t) -> void
+    {
+        ++statistics_.systemOfEquationsCallCount;
+        systemOfEquations_(x, dxdt, t);
+    };
+
+    failed_step_checker failedStepChecker;  // Throws if step size adjustment fails
+
+    while (direction * (endTime - time_) > 0.0)
+    {
+        // The final step is shortened to end at the requested time, without it shrinking the adapted step size
+
+        const bool isFinalStep = direction * (time_ + timeStep_ * (1.0 + FinalStepSlack) - endTime) >= 0.0;
+
+        double stepSize = isFinalStep ? (endTime - time_) : timeStep_;
+        bool isRejected = false;
+
+        while (true)
+        {
+            const double trialStepSize = stepSize;
+
+            if (tryStep_(countedSystemOfEquations, stateVector_, time_, stepSize))
+            {
+                this->recordStep(trialStepSize, true);
+                break;
+            }
+
+            this->recordStep(trialStepSize, false);
+            isRejected = true;
+
+            failedStepChecker();
+        }
+
+        failedStepChecker.reset();
+
+        if ((!isFinalStep) || isRejected)
+        {
+            timeStep_ = stepSize;
+        }
+        else
+        {
+            time_ = endTime;
+        }
+    }
+
+    const double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startInstant).count();
+
+    statistics_.wallTime = wallTime + (statistics_.wallTime.isDefined() ? (double)statistics_.wallTime : 0.0);
+
+    return {stateVector_, time_};
+}
+
+IntegrationSession::Solution IntegrationSession::advanceBy(const Real& aDurationInSeconds)
+{
+    if (!aDurationInSeconds.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Duration");
+    }
+
+    return this->advanceTo(this->getTime() + aDurationInSeconds);
+}
+
+void IntegrationSession::reset(const StateVector& aStateVector, const Real& aTime)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Integration session");
+    }
+
+    if (!aTime.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Time");
+    }
+
+    stateVector_ = aStateVector;
+    time_ = aTime;
+    statistics_ = {};
+
+    this->initializeStepper();
+}
+
+IntegrationSession IntegrationSession::Undefined()
+{
+    return {NumericalSolver::Undefined(), StateVector(), Real::Undefined(), nullptr};
+}
+
+void IntegrationSession::initializeStepper()
+{
+    const double absoluteTolerance = absoluteTolerance_;
+    const double relativeTolerance = relativeTolerance_;
+
+    switch (stepperType_)
+    {
+        case NumericalSolver::StepperType::RungeKutta4:
+        {
+            tryStep_ = [stepper = runge_kutta4<StateVector>()](
+                           const SystemOfEquationsWrapper& aSystemOfEquations, StateVector& x, double& t, double& dt
+                       ) mutable -> bool
+            {
+                stepper.do_step(aSystemOfEquations, x, t, dt);
+                t += dt;
+
+                return true;
+            };
+
+            break;
+        }
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+            tryStep_ = makeTryStep(
+                make_controlled(absoluteTolerance, relativeTolerance, runge_kutta_cash_karp54<StateVector>())
+            );
+            break;
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+            tryStep_ = makeTryStep(
+                make_controlled(absoluteTolerance, relativeTolerance, runge_kutta_fehlberg78<StateVector>())
+            );
+            break;
+
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+            // Keeps the derivative at the current state between steps (and calls), so that a step costs 6 calls
+            tryStep_ = makeTryStep(
+                make_controlled(absoluteTolerance, relativeTolerance, runge_kutta_dopri5<StateVector>())
+            );
+            break;
+
+        default:
+            throw ostk::core::error::RuntimeError(
+                "Integration sessions are not available with the [{}] stepper type.",
+                NumericalSolver::StringFromStepperType(stepperType_)
+            );
+    }
+}
+
+void IntegrationSession::recordStep(const double aStepSize, const bool isAccepted)
+{
+    if (!isAccepted)
+    {
+        ++statistics_.rejectedStepCount;
+        return;
+    }
+
+    const double stepSize = std::abs(aStepSize);
+
+    if (statistics_.acceptedStepCount++ == 0)
+    {
+        statistics_.minimumStepSize = stepSize;
+        statistics_.maximumStepSize = stepSize;
+        statistics_.meanStepSize = stepSize;
+
+        return;
+    }
+
+    statistics_.minimumStepSize = std::min((double)statistics_.minimumStepSize, stepSize);
+    statistics_.maximumStepSize = std::max((double)statistics_.maximumStepSize, stepSize);
+    statistics_.meanStepSize = (double)statistics_.meanStepSize +
+                               (stepSize - (double)statistics_.meanStepSize) / double(statistics_.acceptedStepCount);
+}
+
+}  // namespace solver
+}  // namespace mathematics
+}  // namespace ostk
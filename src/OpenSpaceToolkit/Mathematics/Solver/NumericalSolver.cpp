@@ -1,5 +1,17 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <boost/math/tools/toms748_solve.hpp>
 #include <boost/numeric/odeint.hpp>
 #include <boost/numeric/odeint/external/eigen/eigen.hpp>
 
@@ -7,6 +19,31 @@
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolverT.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/ThreadPool.hpp>
+
+namespace boost
+{
+namespace numeric
+{
+namespace odeint
+{
+
+// Eigen 3.4 only exposes STL iterators on vectors, so odeint must copy matrix (ensemble) states by assignment rather
+// than as ranges
+
+template <>
+struct copy_impl<ostk::mathematics::object::MatrixXd, ostk::mathematics::object::MatrixXd>
+{
+    static void copy(const ostk::mathematics::object::MatrixXd& from, ostk::mathematics::object::MatrixXd& to)
+    {
+        to = from;
+    }
+};
+
+}  // namespace odeint
+}  // namespace numeric
+}  // namespace boost
 
 namespace ostk
 {
@@ -15,180 +52,2689 @@ namespace mathematics
 namespace solver
 {
 
-using namespace boost::numeric::odeint;
+using namespace boost::numeric::odeint;
+
+using ostk::core::type::Index;
+using ostk::mathematics::utility::ThreadPool;
+
+template <class State = NumericalSolver::StateVector>
+using stepper_type_4 = runge_kutta4<State>;
+template <class State = NumericalSolver::StateVector>
+using error_stepper_type_54 = runge_kutta_cash_karp54<State>;
+template <class State = NumericalSolver::StateVector>
+using error_stepper_type_78 = runge_kutta_fehlberg78<State>;
+template <class State = NumericalSolver::StateVector>
+using dense_stepper_type_5 = runge_kutta_dopri5<State>;
+template <class State = NumericalSolver::StateVector>
+using multistep_stepper_type_8 = adams_bashforth_moulton<
+    8,
+    State,
+    double,
+    State,
+    double,
+    typename algebra_dispatcher<State>::algebra_type,
+    typename operations_dispatcher<State>::operations_type,
+    initially_resizer,
+    error_stepper_type_78<State>>;  // Started with RKF78 steps, to match its order
+
+namespace
+{
+
+// Symplectic composition of velocity Verlet (kick-drift-kick) steps, for states made of positions followed by the
+// velocities of the same dimension, the position derivatives being these velocities (the position part of the system
+// of equations output is not used). The acceleration at the end of a step is reused at the start of the next one, so
+// that each Verlet substep costs a single call to the system of equations. That acceleration is evaluated before the
+// last velocity half-kick: accelerations must depend on positions and time only (not on velocities, as drag or
+// damping do), for continued and restarted steps to agree.
+
+template <class State = NumericalSolver::StateVector>
+class SymplecticStepper
+{
+   public:
+    typedef State state_type;
+    typedef State deriv_type;
+    typedef double value_type;
+    typedef double time_type;
+    typedef unsigned short order_type;
+    typedef stepper_tag stepper_category;
+
+    SymplecticStepper(const std::vector<double>& aWeightArray, const order_type anOrder)
+        : weights_(aWeightArray),
+          order_(anOrder)
+    {
+    }
+
+    static SymplecticStepper VelocityVerlet()
+    {
+        return {{1.0}, 2};
+    }
+
+    // Yoshida, Construction of higher order symplectic integrators (1990)
+    static SymplecticStepper Yoshida4()
+    {
+        const double weight = 1.0 / (2.0 - std::cbrt(2.0));
+
+        return {{weight, 1.0 - 2.0 * weight, weight}, 4};
+    }
+
+    static SymplecticStepper FromStepperType(const NumericalSolver::StepperType& aStepperType)
+    {
+        return (aStepperType == NumericalSolver::StepperType::VelocityVerlet) ? VelocityVerlet() : Yoshida4();
+    }
+
+    order_type order() const
+    {
+        return order_;
+    }
+
+    template <class System>
+    void do_step(System aSystemOfEquations, State& aState, const double aTime, const double aTimeStep)
+    {
+        if ((aState.rows() % 2) != 0)
+        {
+            throw ostk::core::error::RuntimeError(
+                "Symplectic steppers require a state of positions followed by velocities, not of dimension [{}].",
+                aState.rows()
+            );
+        }
+
+        const Eigen::Index dimension = aState.rows() / 2;
+
+        // Reuse the derivative at the end of the last step when continuing from it (up to the rounding of the time)
+        const bool isContinued = isDerivativeDefined_ && (derivative_.size() == aState.size()) &&
+                                 (std::abs(aTime - time_) <= 1e-14 * std::max(1.0, std::abs(aTime))) &&
+                                 (aState == state_);
+
+        if (!isContinued)
+        {
+            derivative_.resizeLike(aState);
+            aSystemOfEquations(aState, derivative_, aTime);
+        }
+
+        double time = aTime;
+
+        for (std::size_t i = 0; i < weights_.size(); ++i)
+        {
+            const double timeStep = weights_[i] * aTimeStep;
+
+            aState.bottomRows(dimension) += (0.5 * timeStep) * derivative_.bottomRows(dimension);
+            aState.topRows(dimension) += timeStep * aState.bottomRows(dimension);
+
+            time = (i + 1 == weights_.size()) ? (aTime + aTimeStep) : (time + timeStep);
+
+            aSystemOfEquations(aState, derivative_, time);
+
+            aState.bottomRows(dimension) += (0.5 * timeStep) * derivative_.bottomRows(dimension);
+        }
+
+        state_ = aState;
+        time_ = time;
+        isDerivativeDefined_ = true;
+    }
+
+   private:
+    std::vector<double> weights_;
+    order_type order_;
+
+    State state_;
+    State derivative_;
+    double time_ = 0.0;
+    bool isDerivativeDefined_ = false;
+};
+
+// Finite difference Jacobian of the system of equations, by forward differences around a state whose derivative is
+// already known
+
+void computeFiniteDifferenceJacobian(
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const NumericalSolver::StateVector& aState,
+    const NumericalSolver::StateVector& aStateDerivative,
+    const double aTime,
+    MatrixXd& aJacobian,
+    NumericalSolver::StateVector& aPerturbedState,
+    NumericalSolver::StateVector& aPerturbedStateDerivative
+)
+{
+    static const double relativePerturbation = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    aJacobian.resize(aState.size(), aState.size());
+    aPerturbedState = aState;
+    aPerturbedStateDerivative.resize(aState.size());
+
+    for (Eigen::Index j = 0; j < aState.size(); ++j)
+    {
+        aPerturbedState[j] = aState[j] + relativePerturbation * std::max(1.0, std::abs(aState[j]));
+
+        const double perturbation = aPerturbedState[j] - aState[j];  // Exactly representable perturbation
+
+        aSystemOfEquations(aPerturbedState, aPerturbedStateDerivative, aTime);
+
+        aJacobian.col(j) = (aPerturbedStateDerivative - aStateDerivative) / perturbation;
+
+        aPerturbedState[j] = aState[j];
+    }
+}
+
+// Linearly implicit Rosenbrock method of order 4 (embedded order 3), with the coefficients, step size controller and
+// continuous extension of odeint's rosenbrock4 (Hairer & Wanner, Solving ODEs II, 1996). odeint only implements it
+// on uBLAS containers: it is ported here to Eigen state vectors, which also allows to cache the Jacobian evaluated at
+// a step start across the retries of a rejected step.
+
+class Rosenbrock4Stepper
+{
+   public:
+    Rosenbrock4Stepper(
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        const NumericalSolver::JacobianWrapper& aJacobian,
+        const double anAbsoluteTolerance,
+        const double aRelativeTolerance,
+        const NumericalSolver::StepTraceHook& aStepRecorder
+    )
+        : systemOfEquations_(aSystemOfEquations),
+          jacobian_(aJacobian),
+          absoluteTolerance_(anAbsoluteTolerance),
+          relativeTolerance_(aRelativeTolerance),
+          stepRecorder_(aStepRecorder)
+    {
+    }
+
+    void initialize(const NumericalSolver::StateVector& aState, const double aTime, const double aTimeStep)
+    {
+        const Eigen::Index size = aState.size();
+
+        state_ = aState;
+        previousState_ = aState;
+        time_ = aTime;
+        previousTime_ = aTime;
+        timeStep_ = aTimeStep;
+        isFirstStep_ = true;
+        isLastStepRejected_ = false;
+
+        stateDerivative_.resize(size);
+        stageState_.resize(size);
+        stageStateDerivative_.resize(size);
+        stages_.resize(size, StageCount);
+        jacobianMatrix_.resize(size, size);
+        timeDerivative_.resize(size);
+    }
+
+    void do_step(const double aBoundTime)
+    {
+        // Do not step past the bound time
+        if ((timeStep_ > 0.0) ? (time_ + timeStep_ > aBoundTime) : (time_ + timeStep_ < aBoundTime))
+        {
+            timeStep_ = aBoundTime - time_;
+        }
+
+        // The derivative and Jacobian at the step start are shared by all trials of the step
+        systemOfEquations_(state_, stateDerivative_, time_);
+        this->evaluateJacobian();
+
+        Size failedTrialCount = 0;
+
+        while (!this->tryStep())
+        {
+            if (++failedTrialCount >= 500)
+            {
+                throw ostk::core::error::RuntimeError("Rosenbrock4 step size adjustment failed at time [{}].", time_);
+            }
+        }
+    }
+
+    double previous_time() const
+    {
+        return previousTime_;
+    }
+
+    double current_time() const
+    {
+        return time_;
+    }
+
+    const NumericalSolver::StateVector& current_state() const
+    {
+        return state_;
+    }
+
+    // Third order continuous extension of the last step
+    void calc_state(const double aTime, NumericalSolver::StateVector& aState) const
+    {
+        const double s = (aTime - previousTime_) / (time_ - previousTime_);
+        const double s1 = 1.0 - s;
+
+        aState = previousState_ * s1 + s * (state_ + s1 * (denseCoefficients_.col(0) + s * denseCoefficients_.col(1)));
+    }
+
+   private:
+    static constexpr Index StageCount = 6;  // Last stage yields the error estimate
+    static constexpr double Gamma = 0.25;
+    static constexpr double Safety = 0.9;
+    static constexpr double MaximumDivisor = 5.0;
+    static constexpr double MinimumDivisor = 1.0 / 6.0;
+
+    static constexpr std::array<double, StageCount> C = {0.0, 0.386, 0.21, 0.63, 1.0, 1.0};
+    static constexpr std::array<double, StageCount> D = {0.25, -0.1043, 0.1035, 0.3620000000000023e-01, 0.0, 0.0};
+    static constexpr std::array<std::array<double, StageCount - 1>, StageCount> A = {{
+        {0.0, 0.0, 0.0, 0.0, 0.0},
+        {0.1544000000000000e+01, 0.0, 0.0, 0.0, 0.0},
+        {0.9466785280815826e+00, 0.2557011698983284e+00, 0.0, 0.0, 0.0},
+        {0.3314825187068521e+01, 0.2896124015972201e+01, 0.9986419139977817e+00, 0.0, 0.0},
+        {0.1221224509226641e+01, 0.6019134481288629e+01, 0.1253708332932087e+02, -0.6878860361058950e+00, 0.0},
+        {0.1221224509226641e+01, 0.6019134481288629e+01, 0.1253708332932087e+02, -0.6878860361058950e+00, 1.0},
+    }};
+    static constexpr std::array<std::array<double, StageCount - 1>, StageCount> Gammas = {{
+        {0.0, 0.0, 0.0, 0.0, 0.0},
+        {-0.5668800000000000e+01, 0.0, 0.0, 0.0, 0.0},
+        {-0.2430093356833875e+01, -0.2063599157091915e+00, 0.0, 0.0, 0.0},
+        {-0.1073529058151375e+00, -0.9594562251023355e+01, -0.2047028614809616e+02, 0.0, 0.0},
+        {0.7496443313967647e+01, -0.1024680431464352e+02, -0.3399990352819905e+02, 0.1170890893206160e+02, 0.0},
+        {0.8083246795921522e+01,
+         -0.7981132988064893e+01,
+         -0.3152159432874371e+02,
+         0.1631930543123136e+02,
+         -0.6058818238834054e+01},
+    }};
+    static constexpr std::array<std::array<double, StageCount - 1>, 2> DenseOutput = {{
+        {0.1012623508344586e+02,
+         -0.7487995877610167e+01,
+         -0.3480091861555747e+02,
+         -0.7992771707568823e+01,
+         0.1025137723295662e+01},
+        {-0.6762803392801253e+00,
+         0.6087714651680015e+01,
+         0.1643084320892478e+02,
+         0.2476722511418386e+02,
+         -0.6594389125716872e+01},
+    }};
+
+    const NumericalSolver::SystemOfEquationsWrapper& systemOfEquations_;
+    const NumericalSolver::JacobianWrapper& jacobian_;
+    const double absoluteTolerance_;
+    const double relativeTolerance_;
+    const NumericalSolver::StepTraceHook stepRecorder_;
+
+    NumericalSolver::StateVector state_;
+    NumericalSolver::StateVector previousState_;
+    double time_ = 0.0;
+    double previousTime_ = 0.0;
+    double timeStep_ = 0.0;
+    bool isFirstStep_ = true;
+    bool isLastStepRejected_ = false;
+    double previousError_ = 0.0;
+    double previousTimeStep_ = 0.0;
+
+    NumericalSolver::StateVector stateDerivative_;
+    NumericalSolver::StateVector stageState_;
+    NumericalSolver::StateVector stageStateDerivative_;
+    MatrixXd stages_;
+    MatrixXd denseCoefficients_;
+    MatrixXd jacobianMatrix_;
+    NumericalSolver::StateVector timeDerivative_;
+    NumericalSolver::StateVector perturbedState_;
+    NumericalSolver::StateVector perturbedStateDerivative_;
+    Eigen::PartialPivLU<MatrixXd> iterationMatrix_;
+
+    void evaluateJacobian()
+    {
+        if (jacobian_ != nullptr)
+        {
+            jacobian_(state_, jacobianMatrix_, timeDerivative_, time_);
+            return;
+        }
+
+        computeFiniteDifferenceJacobian(
+            systemOfEquations_,
+            state_,
+            stateDerivative_,
+            time_,
+            jacobianMatrix_,
+            perturbedState_,
+            perturbedStateDerivative_
+        );
+
+        const double timePerturbation =
+            std::sqrt(std::numeric_limits<double>::epsilon()) * std::max(1.0, std::abs(time_));
+
+        systemOfEquations_(state_, perturbedStateDerivative_, time_ + timePerturbation);
+
+        timeDerivative_ = (perturbedStateDerivative_ - stateDerivative_) / timePerturbation;
+    }
+
+    // Attempt a step of the current time step, returns true if accepted. The time step is adapted in any case.
+    bool tryStep()
+    {
+        const double dt = timeStep_;
+
+        iterationMatrix_.compute(MatrixXd::Identity(state_.size(), state_.size()) / (Gamma * dt) - jacobianMatrix_);
+
+        for (Index i = 0; i < StageCount; ++i)
+        {
+            if (i == 0)
+            {
+                stageStateDerivative_ = stateDerivative_;
+            }
+            else
+            {
+                stageState_ = state_;
+
+                for (Index j = 0; j < i; ++j)
+                {
+                    stageState_ += A[i][j] * stages_.col(j);
+                }
+
+                systemOfEquations_(stageState_, stageStateDerivative_, time_ + C[i] * dt);
+            }
+
+            stageStateDerivative_ += (dt * D[i]) * timeDerivative_;
+
+            for (Index j = 0; j < i; ++j)
+            {
+                stageStateDerivative_ += (Gammas[i][j] / dt) * stages_.col(j);
+            }
+
+            stages_.col(i) = iterationMatrix_.solve(stageStateDerivative_);
+        }
+
+        const auto stateError = stages_.col(StageCount - 1);
+
+        stageState_ += stateError;  // New state
+
+        const double error = std::sqrt(
+            (stateError.array() /
+             (absoluteTolerance_ + relativeTolerance_ * state_.array().abs().max(stageState_.array().abs())))
+                .square()
+                .mean()
+        );
+
+        double divisor = std::max(MinimumDivisor, std::min(MaximumDivisor, std::pow(error, 0.25) / Safety));
+
+        if (!(error <= 1.0))  // Also rejects a non finite error
+        {
+            timeStep_ = std::isfinite(error) ? (dt / divisor) : (dt / MaximumDivisor);
+            isLastStepRejected_ = true;
+
+            stepRecorder_(time_, dt, false);
+
+            return false;
+        }
+
+        // Predictive step size control (Gustafsson)
+        if (isFirstStep_)
+        {
+            isFirstStep_ = false;
+        }
+        else
+        {
+            const double predictedDivisor =
+                (previousTimeStep_ / dt) * std::pow(error * error / previousError_, 0.25) / Safety;
+
+            divisor = std::max(divisor, std::max(MinimumDivisor, std::min(MaximumDivisor, predictedDivisor)));
+        }
+
+        previousTimeStep_ = dt;
+        previousError_ = std::max(0.01, error);
+
+        timeStep_ = isLastStepRejected_ ? ((dt >= 0.0) ? std::min(dt / divisor, dt) : std::max(dt / divisor, dt))
+                                        : (dt / divisor);
+        isLastStepRejected_ = false;
+
+        denseCoefficients_ = stages_.leftCols(StageCount - 1) *
+                             Eigen::Map<const Eigen::Matrix<double, StageCount - 1, 2>>(&DenseOutput[0][0]);
+
+        stepRecorder_(time_, dt, true);
+
+        previousState_ = state_;
+        previousTime_ = time_;
+        state_ = stageState_;
+        time_ += dt;
+
+        return true;
+    }
+};
+
+// Variable order, variable step size backward differentiation formula (orders 1 to 5), in the quasi-constant step
+// size Nordsieck-like difference formulation of Shampine & Reichelt (The MATLAB ODE Suite, 1997), with the NDF
+// kappa coefficients. The Newton iteration matrix is only refactorized when the step size or order changes, and the
+// Jacobian only reevaluated when the iteration does not converge.
+
+class BackwardDifferentiationFormulaStepper
+{
+   public:
+    BackwardDifferentiationFormulaStepper(
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        const NumericalSolver::JacobianWrapper& aJacobian,
+        const double anAbsoluteTolerance,
+        const double aRelativeTolerance,
+        const NumericalSolver::StepTraceHook& aStepRecorder
+    )
+        : systemOfEquations_(aSystemOfEquations),
+          jacobian_(aJacobian),
+          absoluteTolerance_(anAbsoluteTolerance),
+          relativeTolerance_(aRelativeTolerance),
+          newtonTolerance_(std::max(
+              10.0 * std::numeric_limits<double>::epsilon() / aRelativeTolerance,
+              std::min(0.03, std::sqrt(aRelativeTolerance))
+          )),
+          stepRecorder_(aStepRecorder)
+    {
+        for (Size k = 1; k <= MaximumOrder + 1; ++k)
+        {
+            gamma_[k] = gamma_[k - 1] + 1.0 / double(k);
+        }
+
+        for (Size k = 0; k <= MaximumOrder + 1; ++k)
+        {
+            alpha_[k] = (1.0 - Kappa[k]) * gamma_[k];
+            errorConstant_[k] = Kappa[k] * gamma_[k] + 1.0 / double(k + 1);
+        }
+    }
+
+    void initialize(const NumericalSolver::StateVector& aState, const double aTime, const double aTimeStep)
+    {
+        const Eigen::Index size = aState.size();
+
+        time_ = aTime;
+        previousTime_ = aTime;
+        direction_ = (aTimeStep >= 0.0) ? 1.0 : -1.0;
+        stepSize_ = std::abs(aTimeStep);
+        order_ = 1;
+        equalStepCount_ = 0;
+        isFactorized_ = false;
+
+        state_ = aState;
+        stateDerivative_.resize(size);
+        systemOfEquations_(state_, stateDerivative_, time_);
+
+        differences_ = MatrixXd::Zero(size, MaximumOrder + 3);
+        differences_.col(0) = state_;
+        differences_.col(1) = stateDerivative_ * stepSize_ * direction_;
+
+        this->evaluateJacobian(state_, stateDerivative_, time_);
+    }
+
+    void do_step(const double aBoundTime)
+    {
+        const double minimumStepSize = 10.0 * std::numeric_limits<double>::epsilon() * std::abs(time_);
+
+        if (stepSize_ < minimumStepSize)
+        {
+            this->rescaleDifferences(minimumStepSize / stepSize_);
+            stepSize_ = minimumStepSize;
+        }
+
+        double newTime = time_;
+        double errorNormScale = 0.0;
+        Size newtonIterationCount = 0;
+
+        while (true)
+        {
+            if (stepSize_ < minimumStepSize)
+            {
+                throw ostk::core::error::RuntimeError("BDF step size became too small at time [{}].", time_);
+            }
+
+            newTime = time_ + direction_ * stepSize_;
+
+            // Do not step past the bound time
+            if (direction_ * (newTime - aBoundTime) > 0.0)
+            {
+                newTime = aBoundTime;
+                this->rescaleDifferences(std::abs(newTime - time_) / stepSize_);
+                stepSize_ = std::abs(newTime - time_);
+                equalStepCount_ = 0;
+                isFactorized_ = false;
+            }
+
+            const double stepSize = newTime - time_;
+
+            predictedState_ = differences_.leftCols(order_ + 1).rowwise().sum();
+            scale_ = absoluteTolerance_ + relativeTolerance_ * predictedState_.array().abs();
+
+            psi_ = differences_.middleCols(1, order_) * Eigen::Map<const VectorXd>(gamma_.data() + 1, order_) /
+                   alpha_[order_];
+
+            const double c = stepSize / alpha_[order_];
+
+            bool isConverged = false;
+            bool isJacobianCurrent = false;
+
+            while (true)
+            {
+                if (!isFactorized_)
+                {
+                    iterationMatrix_.compute(MatrixXd::Identity(state_.size(), state_.size()) - c * jacobianMatrix_);
+                    isFactorized_ = true;
+                }
+
+                isConverged = this->solveImplicitSystem(newTime, c, newtonIterationCount);
+
+                if (isConverged || isJacobianCurrent)
+                {
+                    break;
+                }
+
+                systemOfEquations_(predictedState_, trialStateDerivative_, newTime);
+                this->evaluateJacobian(predictedState_, trialStateDerivative_, newTime);
+                isFactorized_ = false;
+                isJacobianCurrent = true;
+            }
+
+            if (!isConverged)
+            {
+                stepRecorder_(time_, stepSize, false);
+
+                this->rescaleDifferences(0.5);
+                stepSize_ *= 0.5;
+                equalStepCount_ = 0;
+                isFactorized_ = false;
+
+                continue;
+            }
+
+            errorNormScale = 0.9 * (2.0 * NewtonMaximumIterationCount + 1.0) /
+                             (2.0 * NewtonMaximumIterationCount + double(newtonIterationCount));
+
+            scale_ = absoluteTolerance_ + relativeTolerance_ * trialState_.array().abs();
+
+            const double errorNorm = RootMeanSquare(errorConstant_[order_] * correction_, scale_);
+
+            if (!(errorNorm <= 1.0))  // Also rejects a non finite error norm
+            {
+                stepRecorder_(time_, stepSize, false);
+
+                const double factor =
+                    std::max(MinimumFactor, errorNormScale * std::pow(errorNorm, -1.0 / double(order_ + 1)));
+
+                this->rescaleDifferences(factor);
+                stepSize_ *= factor;
+                equalStepCount_ = 0;
+                isFactorized_ = false;
+
+                continue;
+            }
+
+            break;
+        }
+
+        stepRecorder_(time_, newTime - time_, true);
+
+        ++equalStepCount_;
+
+        previousTime_ = time_;
+        time_ = newTime;
+        state_ = trialState_;
+
+        differences_.col(order_ + 2) = correction_ - differences_.col(order_ + 1);
+        differences_.col(order_ + 1) = correction_;
+
+        for (Index i = order_ + 1; i-- > 0;)
+        {
+            differences_.col(i) += differences_.col(i + 1);
+        }
+
+        if (equalStepCount_ < order_ + 1)
+        {
+            return;
+        }
+
+        // Order and step size selection, from the error estimates of the neighbouring orders
+
+        const double lowerErrorNorm = (order_ > 1)
+                                        ? RootMeanSquare(errorConstant_[order_ - 1] * differences_.col(order_), scale_)
+                                        : std::numeric_limits<double>::infinity();
+        const double errorNorm = RootMeanSquare(errorConstant_[order_] * correction_, scale_);
+        const double upperErrorNorm =
+            (order_ < MaximumOrder) ? RootMeanSquare(errorConstant_[order_ + 1] * differences_.col(order_ + 2), scale_)
+                                    : std::numeric_limits<double>::infinity();
+
+        const std::array<double, 3> factors = {
+            std::pow(lowerErrorNorm, -1.0 / double(order_)),
+            std::pow(errorNorm, -1.0 / double(order_ + 1)),
+            std::pow(upperErrorNorm, -1.0 / double(order_ + 2)),
+        };
+
+        const Index bestIndex = std::distance(factors.begin(), std::max_element(factors.begin(), factors.end()));
+
+        order_ = order_ + bestIndex - 1;
+
+        const double factor = std::min(MaximumFactor, errorNormScale * factors[bestIndex]);
+
+        this->rescaleDifferences(factor);
+        stepSize_ *= factor;
+        equalStepCount_ = 0;
+        isFactorized_ = false;
+    }
+
+    double previous_time() const
+    {
+        return previousTime_;
+    }
+
+    double current_time() const
+    {
+        return time_;
+    }
+
+    const NumericalSolver::StateVector& current_state() const
+    {
+        return state_;
+    }
+
+    // Interpolating polynomial of the last step, from the backward differences
+    void calc_state(const double aTime, NumericalSolver::StateVector& aState) const
+    {
+        const double stepSize = direction_ * stepSize_;
+
+        aState = differences_.col(0);
+
+        double product = 1.0;
+
+        for (Index k = 0; k < order_; ++k)
+        {
+            product *= (aTime - (time_ - stepSize * double(k))) / (stepSize * double(k + 1));
+            aState += product * differences_.col(k + 1);
+        }
+    }
+
+   private:
+    static constexpr Index MaximumOrder = 5;
+    static constexpr Size NewtonMaximumIterationCount = 4;
+    static constexpr double MinimumFactor = 0.2;
+    static constexpr double MaximumFactor = 10.0;
+    static constexpr std::array<double, MaximumOrder + 2> Kappa = {
+        0.0, -0.1850, -1.0 / 9.0, -0.0823, -0.0415, 0.0, 0.0
+    };
+
+    const NumericalSolver::SystemOfEquationsWrapper& systemOfEquations_;
+    const NumericalSolver::JacobianWrapper& jacobian_;
+    const double absoluteTolerance_;
+    const double relativeTolerance_;
+    const double newtonTolerance_;
+    const NumericalSolver::StepTraceHook stepRecorder_;
+
+    std::array<double, MaximumOrder + 2> gamma_ = {};
+    std::array<double, MaximumOrder + 2> alpha_ = {};
+    std::array<double, MaximumOrder + 2> errorConstant_ = {};
+
+    double time_ = 0.0;
+    double previousTime_ = 0.0;
+    double direction_ = 1.0;
+    double stepSize_ = 0.0;
+    Index order_ = 1;
+    Size equalStepCount_ = 0;
+
+    NumericalSolver::StateVector state_;
+    NumericalSolver::StateVector stateDerivative_;
+    MatrixXd differences_;  // Backward differences, one per column, scaled to the current step size
+
+    MatrixXd jacobianMatrix_;
+    NumericalSolver::StateVector timeDerivative_;
+    Eigen::PartialPivLU<MatrixXd> iterationMatrix_;
+    bool isFactorized_ = false;
+
+    NumericalSolver::StateVector predictedState_;
+    NumericalSolver::StateVector psi_;
+    NumericalSolver::StateVector scale_;
+    NumericalSolver::StateVector trialState_;
+    NumericalSolver::StateVector trialStateDerivative_;
+    NumericalSolver::StateVector correction_;
+    NumericalSolver::StateVector newtonStep_;
+    NumericalSolver::StateVector perturbedState_;
+    NumericalSolver::StateVector perturbedStateDerivative_;
+
+    void evaluateJacobian(
+        const NumericalSolver::StateVector& aState, const NumericalSolver::StateVector& aStateDerivative, const double t
+    )
+    {
+        if (jacobian_ != nullptr)
+        {
+            jacobianMatrix_.resize(aState.size(), aState.size());
+            timeDerivative_.resize(aState.size());
+            jacobian_(aState, jacobianMatrix_, timeDerivative_, t);
+            return;
+        }
+
+        computeFiniteDifferenceJacobian(
+            systemOfEquations_, aState, aStateDerivative, t, jacobianMatrix_, perturbedState_, perturbedStateDerivative_
+        );
+    }
+
+    // Simplified Newton iteration on the implicit BDF equation, returns true if converged
+    bool solveImplicitSystem(const double aTime, const double c, Size& anIterationCount)
+    {
+        trialState_ = predictedState_;
+        correction_.setZero(state_.size());
+        trialStateDerivative_.resize(state_.size());
+
+        double previousStepNorm = -1.0;
+
+        for (Size k = 0; k < NewtonMaximumIterationCount; ++k)
+        {
+            anIterationCount = k + 1;
+
+            systemOfEquations_(trialState_, trialStateDerivative_, aTime);
+
+            if (!trialStateDerivative_.allFinite())
+            {
+                return false;
+            }
+
+            newtonStep_ = iterationMatrix_.solve(c * trialStateDerivative_ - psi_ - correction_);
+
+            const double stepNorm = RootMeanSquare(newtonStep_, scale_);
+            const double rate = (previousStepNorm > 0.0) ? (stepNorm / previousStepNorm) : -1.0;
+
+            if ((rate >= 0.0) &&
+                ((rate >= 1.0) ||
+                 ((std::pow(rate, double(NewtonMaximumIterationCount - k)) / (1.0 - rate) * stepNorm) > newtonTolerance_
+                 )))
+            {
+                return false;
+            }
+
+            trialState_ += newtonStep_;
+            correction_ += newtonStep_;
+
+            if ((stepNorm == 0.0) || ((rate >= 0.0) && ((rate / (1.0 - rate) * stepNorm) < newtonTolerance_)))
+            {
+                return true;
+            }
+
+            previousStepNorm = stepNorm;
+        }
+
+        return false;
+    }
+
+    // Rescale the backward differences to a step size multiplied by a factor
+    void rescaleDifferences(const double aFactor)
+    {
+        const MatrixXd transformation = ComputeTransformation(order_, aFactor) * ComputeTransformation(order_, 1.0);
+
+        differences_.leftCols(order_ + 1) = differences_.leftCols(order_ + 1) * transformation;
+    }
+
+    static MatrixXd ComputeTransformation(const Index anOrder, const double aFactor)
+    {
+        MatrixXd transformation = MatrixXd::Zero(anOrder + 1, anOrder + 1);
+
+        transformation.row(0).setOnes();
+
+        for (Index i = 1; i <= anOrder; ++i)
+        {
+            for (Index j = 1; j <= anOrder; ++j)
+            {
+                transformation(i, j) =
+                    transformation(i - 1, j) * (double(i) - 1.0 - aFactor * double(j)) / double(i);
+            }
+        }
+
+        return transformation;
+    }
+
+    static double RootMeanSquare(
+        const NumericalSolver::StateVector& aVector, const NumericalSolver::StateVector& aScale
+    )
+    {
+        return std::sqrt((aVector.array() / aScale.array()).square().mean());
+    }
+};
+
+// Wrap a system of equations so that its calls are counted
+
+template <class SystemOfEquations>
+auto countSystemOfEquationsCalls(const SystemOfEquations& aSystemOfEquations, Size& aCallCount)
+{
+    return [&aSystemOfEquations, &aCallCount](const auto& x, auto& dxdt, const double t) -> void
+    {
+        ++aCallCount;
+        aSystemOfEquations(x, dxdt, t);
+    };
+}
+
+// Forward the steps of an odeint stepper (do_step) or controlled stepper (try_step), reporting each step trial start
+// time, signed size and acceptance to a recorder
+
+template <class Stepper, class StepRecorder>
+class StepRecordingStepper
+{
+   public:
+    typedef typename Stepper::state_type state_type;
+    typedef typename Stepper::deriv_type deriv_type;
+    typedef typename Stepper::value_type value_type;
+    typedef typename Stepper::time_type time_type;
+    typedef typename Stepper::stepper_category stepper_category;
+
+    StepRecordingStepper(const Stepper& aStepper, const StepRecorder& aStepRecorder)
+        : stepper_(aStepper),
+          stepRecorder_(aStepRecorder)
+    {
+    }
+
+    template <class System, class State>
+    void do_step(System aSystemOfEquations, State& aState, const time_type aTime, const time_type aTimeStep)
+    {
+        stepper_.do_step(aSystemOfEquations, aState, aTime, aTimeStep);
+        stepRecorder_(aTime, aTimeStep, true);
+    }
+
+    template <class System, class State>
+    controlled_step_result try_step(System aSystemOfEquations, State& aState, time_type& aTime, time_type& aTimeStep)
+    {
+        const time_type time = aTime;
+        const time_type timeStep = aTimeStep;
+
+        const controlled_step_result result = stepper_.try_step(aSystemOfEquations, aState, aTime, aTimeStep);
+
+        stepRecorder_(time, (result == success) ? (aTime - time) : timeStep, result == success);
+
+        return result;
+    }
+
+   private:
+    Stepper stepper_;
+    StepRecorder stepRecorder_;
+};
+
+template <class Stepper, class StepRecorder>
+StepRecordingStepper<Stepper, StepRecorder> recordSteps(const Stepper& aStepper, const StepRecorder& aStepRecorder)
+{
+    return {aStepper, aStepRecorder};
+}
+
+// Explicit Runge-Kutta integration of a state type, independent of the stepper type
+
+template <class State>
+class ExplicitStateSolver
+{
+   public:
+    typedef std::function<void(const State&, State&, const double)> SystemOfEquations;
+    typedef std::function<void(const State&, const double)> Observer;
+
+    virtual ~ExplicitStateSolver() = default;
+
+    virtual void integrateState(
+        State& aState,
+        const double aStartTime,
+        const double anEndTime,
+        const SystemOfEquations& aSystemOfEquations,
+        Size& aCallCount,
+        const Observer& anObserver,
+        const NumericalSolver::StepTraceHook& aStepRecorder
+    ) const = 0;
+};
+
+// Reset the statistics of an integration, and measure its wall time whichever way the integration returns
+
+class IntegrationTimer
+{
+   public:
+    explicit IntegrationTimer(NumericalSolver::Statistics& aStatistics)
+        : statistics_(aStatistics),
+          startTime_(std::chrono::steady_clock::now())
+    {
+        statistics_ = {};
+    }
+
+    ~IntegrationTimer()
+    {
+        statistics_.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime_).count();
+    }
+
+   private:
+    NumericalSolver::Statistics& statistics_;
+    const std::chrono::steady_clock::time_point startTime_;
+};
+
+// Add the counts and step sizes of another integration to statistics (the wall time is left unchanged)
+
+void accumulateStatistics(
+    NumericalSolver::Statistics& aStatistics, const NumericalSolver::Statistics& anotherStatistics
+)
+{
+    aStatistics.systemOfEquationsCallCount += anotherStatistics.systemOfEquationsCallCount;
+    aStatistics.rejectedStepCount += anotherStatistics.rejectedStepCount;
+
+    if (anotherStatistics.acceptedStepCount == 0)
+    {
+        return;
+    }
+
+    if (aStatistics.acceptedStepCount == 0)
+    {
+        aStatistics.minimumStepSize = anotherStatistics.minimumStepSize;
+        aStatistics.maximumStepSize = anotherStatistics.maximumStepSize;
+        aStatistics.meanStepSize = anotherStatistics.meanStepSize;
+    }
+    else
+    {
+        const double acceptedStepCount = double(aStatistics.acceptedStepCount);
+        const double anotherAcceptedStepCount = double(anotherStatistics.acceptedStepCount);
+
+        aStatistics.minimumStepSize = std::min(aStatistics.minimumStepSize, anotherStatistics.minimumStepSize);
+        aStatistics.maximumStepSize = std::max(aStatistics.maximumStepSize, anotherStatistics.maximumStepSize);
+        aStatistics.meanStepSize = ((double)aStatistics.meanStepSize * acceptedStepCount +
+                                    (double)anotherStatistics.meanStepSize * anotherAcceptedStepCount) /
+                                   (acceptedStepCount + anotherAcceptedStepCount);
+    }
+
+    aStatistics.acceptedStepCount += anotherStatistics.acceptedStepCount;
+}
+
+// Step size control error of a state followed by its state transition matrix: odeint's default error (with unit
+// state and derivative factors), the state transition matrix components being weighted
+
+class VariationalErrorChecker
+{
+   public:
+    typedef double value_type;
+
+    VariationalErrorChecker(
+        const double anAbsoluteTolerance,
+        const double aRelativeTolerance,
+        const Eigen::Index aStateDimension,
+        const double aStateTransitionMatrixWeight
+    )
+        : absoluteTolerance_(anAbsoluteTolerance),
+          relativeTolerance_(aRelativeTolerance),
+          stateDimension_(aStateDimension),
+          stateTransitionMatrixWeight_(aStateTransitionMatrixWeight)
+    {
+    }
+
+    template <class Algebra, class State, class Deriv, class Err, class Time>
+    double error(Algebra&, const State& aState, const Deriv& aStateDerivative, Err& aStateError, Time aTimeStep) const
+    {
+        const auto segmentError = [&](const Eigen::Index aStart, const Eigen::Index aSize) -> double
+        {
+            const auto stateMagnitude = aState.segment(aStart, aSize).array().abs() +
+                                        std::abs(aTimeStep) * aStateDerivative.segment(aStart, aSize).array().abs();
+
+            return (aStateError.segment(aStart, aSize).array().abs() /
+                    (absoluteTolerance_ + relativeTolerance_ * stateMagnitude))
+                .maxCoeff();
+        };
+
+        const double stateError = segmentError(0, stateDimension_);
+
+        if (stateTransitionMatrixWeight_ == 0.0)
+        {
+            return stateError;
+        }
+
+        return std::max(
+            stateError,
+            stateTransitionMatrixWeight_ * segmentError(stateDimension_, aStateError.size() - stateDimension_)
+        );
+    }
+
+   private:
+    double absoluteTolerance_;
+    double relativeTolerance_;
+    Eigen::Index stateDimension_;
+    double stateTransitionMatrixWeight_;
+};
+
+}  // namespace
+
+// One compile-time configured solver per state type integrated by NumericalSolver (the fixed sizes being those
+// explicitly instantiated below)
+
+class NumericalSolver::ExplicitSolver : public ExplicitStateSolver<NumericalSolver::StateVector>,
+                                        public ExplicitStateSolver<NumericalSolver::EnsembleState>,
+                                        public ExplicitStateSolver<NumericalSolver::FixedStateVector<6>>,
+                                        public ExplicitStateSolver<NumericalSolver::FixedStateVector<7>>,
+                                        public ExplicitStateSolver<NumericalSolver::FixedStateVector<13>>,
+                                        public ExplicitStateSolver<NumericalSolver::FixedStateVector<42>>
+{
+   public:
+    static std::shared_ptr<const NumericalSolver::ExplicitSolver> FromNumericalSolver(
+        const NumericalSolver& aNumericalSolver
+    );
+
+   private:
+    template <NumericalSolver::StepperType Type, class... States>
+    class ExplicitSolverT;
+
+    template <NumericalSolver::StepperType Type>
+    static std::shared_ptr<const NumericalSolver::ExplicitSolver> Make(const NumericalSolver& aNumericalSolver);
+};
+
+template <NumericalSolver::StepperType Type>
+class NumericalSolver::ExplicitSolver::ExplicitSolverT<Type> : public NumericalSolver::ExplicitSolver
+{
+   public:
+    explicit ExplicitSolverT(const NumericalSolver&) {}
+};
+
+template <NumericalSolver::StepperType Type, class State, class... States>
+class NumericalSolver::ExplicitSolver::ExplicitSolverT<Type, State, States...>
+    : public NumericalSolver::ExplicitSolver::ExplicitSolverT<Type, States...>
+{
+   public:
+    explicit ExplicitSolverT(const NumericalSolver& aNumericalSolver)
+        : ExplicitSolverT<Type, States...>(aNumericalSolver),
+          numericalSolver_(NumericalSolverT<Type, State>::FromNumericalSolver(aNumericalSolver))
+    {
+    }
+
+    void integrateState(
+        State& aState,
+        const double aStartTime,
+        const double anEndTime,
+        const typename ExplicitStateSolver<State>::SystemOfEquations& aSystemOfEquations,
+        Size& aCallCount,
+        const typename ExplicitStateSolver<State>::Observer& anObserver,
+        const NumericalSolver::StepTraceHook& aStepRecorder
+    ) const override
+    {
+        numericalSolver_.integrateState(
+            aState,
+            aStartTime,
+            anEndTime,
+            countSystemOfEquationsCalls(aSystemOfEquations, aCallCount),
+            anObserver,
+            [&aStepRecorder](const auto& aStepper)
+            {
+                return recordSteps(aStepper, std::cref(aStepRecorder));
+            }
+        );
+    }
+
+   private:
+    NumericalSolverT<Type, State> numericalSolver_;
+};
+
+template <NumericalSolver::StepperType Type>
+std::shared_ptr<const NumericalSolver::ExplicitSolver> NumericalSolver::ExplicitSolver::Make(
+    const NumericalSolver& aNumericalSolver
+)
+{
+    return std::make_shared<const ExplicitSolverT<
+        Type,
+        NumericalSolver::StateVector,
+        NumericalSolver::EnsembleState,
+        NumericalSolver::FixedStateVector<6>,
+        NumericalSolver::FixedStateVector<7>,
+        NumericalSolver::FixedStateVector<13>,
+        NumericalSolver::FixedStateVector<42>>>(aNumericalSolver);
+}
+
+std::shared_ptr<const NumericalSolver::ExplicitSolver> NumericalSolver::ExplicitSolver::FromNumericalSolver(
+    const NumericalSolver& aNumericalSolver
+)
+{
+    if (!aNumericalSolver.isDefined())
+    {
+        return nullptr;
+    }
+
+    switch (aNumericalSolver.getStepperType())
+    {
+        case NumericalSolver::StepperType::RungeKutta4:
+            return Make<NumericalSolver::StepperType::RungeKutta4>(aNumericalSolver);
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+            return Make<NumericalSolver::StepperType::RungeKuttaCashKarp54>(aNumericalSolver);
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+            return Make<NumericalSolver::StepperType::RungeKuttaFehlberg78>(aNumericalSolver);
+
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+            return Make<NumericalSolver::StepperType::RungeKuttaDopri5>(aNumericalSolver);
+
+        default:
+            return nullptr;
+    }
+}
+
+NumericalSolver::NumericalSolver(
+    const NumericalSolver::LogType& aLogType,
+    const NumericalSolver::StepperType& aStepperType,
+    const Real& aTimeStep,
+    const Real& aRelativeTolerance,
+    const Real& anAbsoluteTolerance
+)
+    : logType_(aLogType),
+      stepperType_(aStepperType),
+      timeStep_(aTimeStep),
+      relativeTolerance_(aRelativeTolerance),
+      absoluteTolerance_(anAbsoluteTolerance),
+      observedStateVectors_(),
+      stateObserver_(nullptr),
+      observationStepInterval_(1),
+      observationMinimumTimeSeparation_(Real::Undefined()),
+      observationStepCount_(0),
+      lastObservationTime_(Real::Undefined()),
+      jacobian_(nullptr),
+      statistics_(),
+      stepTraceHook_(nullptr),
+      explicitSolver_(nullptr)
+{
+}
+
+bool NumericalSolver::operator==(const NumericalSolver& aNumericalSolver) const
+{
+    if ((!this->isDefined()) || (!aNumericalSolver.isDefined()))
+    {
+        return false;
+    }
+
+    return (logType_ == aNumericalSolver.logType_) && (stepperType_ == aNumericalSolver.stepperType_) &&
+           (timeStep_ == aNumericalSolver.timeStep_) && (relativeTolerance_ == aNumericalSolver.relativeTolerance_) &&
+           (absoluteTolerance_ == aNumericalSolver.absoluteTolerance_);
+}
+
+bool NumericalSolver::operator!=(const NumericalSolver& aNumericalSolver) const
+{
+    return !((*this) == aNumericalSolver);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const NumericalSolver& aNumericalSolver)
+{
+    aNumericalSolver.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool NumericalSolver::isDefined() const
+{
+    return timeStep_.isDefined() && relativeTolerance_.isDefined() && absoluteTolerance_.isDefined();
+}
+
+void NumericalSolver::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Numerical Solver") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Integration logging type:" << NumericalSolver::StringFromLogType(logType_);
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Integration stepper type:" << NumericalSolver::StringFromStepperType(stepperType_);
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Integration time step:" << (timeStep_.isDefined() ? timeStep_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Integration relative tolerance:"
+        << (relativeTolerance_.isDefined() ? relativeTolerance_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Integration absolute tolerance:"
+        << (absoluteTolerance_.isDefined() ? absoluteTolerance_.toString() : "Undefined");
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+const Array<NumericalSolver::Solution>& NumericalSolver::accessObservedStateVectors() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return this->observedStateVectors_;
+}
+
+NumericalSolver::LogType NumericalSolver::getLogType() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return this->logType_;
+}
+
+NumericalSolver::StepperType NumericalSolver::getStepperType() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return this->stepperType_;
+}
+
+Real NumericalSolver::getTimeStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return this->timeStep_;
+}
+
+Real NumericalSolver::getRelativeTolerance() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return this->relativeTolerance_;
+}
+
+Real NumericalSolver::getAbsoluteTolerance() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return this->absoluteTolerance_;
+}
+
+Array<NumericalSolver::Solution> NumericalSolver::getObservedStateVectors() const
+{
+    return this->accessObservedStateVectors();
+}
+
+Size NumericalSolver::getObservationStepInterval() const
+{
+    return observationStepInterval_;
+}
+
+Real NumericalSolver::getObservationMinimumTimeSeparation() const
+{
+    return observationMinimumTimeSeparation_;
+}
+
+NumericalSolver::Statistics NumericalSolver::getStatistics() const
+{
+    return statistics_;
+}
+
+void NumericalSolver::setStateObserver(const NumericalSolver::StateObserver& aStateObserver)
+{
+    stateObserver_ = aStateObserver;
+}
+
+void NumericalSolver::setJacobian(const NumericalSolver::JacobianWrapper& aJacobian)
+{
+    jacobian_ = aJacobian;
+}
+
+void NumericalSolver::setStepTraceHook(const NumericalSolver::StepTraceHook& aStepTraceHook)
+{
+    stepTraceHook_ = aStepTraceHook;
+}
+
+void NumericalSolver::setObservationDecimation(const Size& aStepInterval, const Real& aMinimumTimeSeparation)
+{
+    if (aStepInterval == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Step interval");
+    }
+
+    if (aMinimumTimeSeparation.isDefined() && (aMinimumTimeSeparation < 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Minimum time separation");
+    }
+
+    observationStepInterval_ = aStepInterval;
+    observationMinimumTimeSeparation_ = aMinimumTimeSeparation;
+}
+
+Array<NumericalSolver::Solution> NumericalSolver::integrateTime(
+    const StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const Array<Real>& aTimeArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    this->resetObservedStateVectors();
+
+    const IntegrationTimer integrationTimer(statistics_);
+
+    NumericalSolver::StateVector aStateVector = anInitialStateVector;
+
+    // Check if time array has zero length
+    if (aTimeArray.size() == 0)
+    {
+        throw ostk::core::error::RuntimeError("Time Array is empty");
+    }
+
+    // Check if the incoming time array is the same as the start time if it has length 1
+    if ((aTimeArray.size() == 1) && (aTimeArray[0] == aStartTime))
+    {
+        return {
+            {anInitialStateVector, aStartTime},
+        };
+    }
+
+    // Add start time to the start of array
+    Array<double> durationArray(aTimeArray.begin(), aTimeArray.end());
+    durationArray.insert(durationArray.begin(), aStartTime);
+
+    // Solutions at the requested times are collected here, independently of the observation decimation and sink, the
+    // first observation (the start state) being skipped
+    Array<NumericalSolver::Solution> solutions = Array<NumericalSolver::Solution>::Empty();
+    solutions.reserve(aTimeArray.size());
+
+    Size observationCount = 0;
+
+    const auto observer = [this, &solutions, &observationCount](const NumericalSolver::StateVector& x, double t) -> void
+    {
+        if (observationCount++ > 0)
+        {
+            solutions.add({x, t});
+        }
+
+        this->observeNumericalIntegration(x, t);
+    };
+
+    // Ensure integration starts in the correct direction with the initial time step guess
+    this->integrateStateTimes(
+        aStateVector, durationArray, getSignedTimeStep(aTimeArray.accessLast()), aSystemOfEquations, observer
+    );
+
+    return solutions;
+}
+
+MatrixXd NumericalSolver::integrateTime(
+    const StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const VectorXd& aTimeVector,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    MatrixXd stateMatrix(anInitialStateVector.size(), aTimeVector.size());
+
+    this->integrateTime(anInitialStateVector, aStartTime, aTimeVector, aSystemOfEquations, stateMatrix);
+
+    return stateMatrix;
+}
+
+void NumericalSolver::integrateTime(
+    const StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const VectorXd& aTimeVector,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    Eigen::Ref<MatrixXd> aStateMatrix
+)
+{
+    this->resetObservedStateVectors();
+
+    const IntegrationTimer integrationTimer(statistics_);
+
+    if (aTimeVector.size() == 0)
+    {
+        throw ostk::core::error::RuntimeError("Time Array is empty");
+    }
+
+    if ((aStateMatrix.rows() != anInitialStateVector.size()) || (aStateMatrix.cols() != aTimeVector.size()))
+    {
+        throw ostk::core::error::runtime::Wrong("State matrix");
+    }
+
+    if ((aTimeVector.size() == 1) && (aTimeVector(0) == aStartTime))
+    {
+        aStateMatrix.col(0) = anInitialStateVector;
+        return;
+    }
+
+    NumericalSolver::StateVector stateVector = anInitialStateVector;
+
+    Array<double> durationArray = Array<double>::Empty();
+    durationArray.reserve(aTimeVector.size() + 1);
+    durationArray.add(aStartTime);
+    durationArray.insert(durationArray.end(), aTimeVector.begin(), aTimeVector.end());
+
+    // States at the requested times are written in place, one column per time, the start state being skipped
+
+    Eigen::Index observationIndex = -1;
+
+    const auto observer =
+        [this, &aStateMatrix, &observationIndex](const NumericalSolver::StateVector& x, double t) -> void
+    {
+        if ((observationIndex >= 0) && (observationIndex < aStateMatrix.cols()))
+        {
+            aStateMatrix.col(observationIndex) = x;
+        }
+
+        ++observationIndex;
+
+        this->observeNumericalIntegration(x, t);
+    };
+
+    this->integrateStateTimes(
+        stateVector, durationArray, getSignedTimeStep(aTimeVector(aTimeVector.size() - 1)), aSystemOfEquations, observer
+    );
+}
+
+NumericalSolver::Solution NumericalSolver::integrateDuration(
+    const StateVector& anInitialStateVector,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    NumericalSolver::StateVector aStateVector = anInitialStateVector;
+
+    this->resetObservedStateVectors();
+
+    const IntegrationTimer integrationTimer(statistics_);
+
+    if (aDurationInSeconds.isZero())  // If integration duration is zero seconds long, skip integration
+    {
+        return {anInitialStateVector, 0.0};
+    }
+
+    const auto observer = [this](const NumericalSolver::StateVector& x, double t) -> void
+    {
+        this->observeNumericalIntegration(x, t);
+    };
+
+    this->integrateStateDuration(aStateVector, aDurationInSeconds, aSystemOfEquations, observer);
+
+    return {aStateVector, aDurationInSeconds};
+}
+
+NumericalSolver::Solution NumericalSolver::integrateTime(
+    const StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    return this->integrateDuration(anInitialStateVector, (anEndTime - aStartTime), aSystemOfEquations);
+}
+
+NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Array<EventCondition>& anEventConditionArray
+)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Numerical solver");
+    }
+
+    for (const EventCondition& eventCondition : anEventConditionArray)
+    {
+        if (!eventCondition.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Event condition");
+        }
+    }
+
+    this->resetObservedStateVectors();
+
+    const IntegrationTimer integrationTimer(statistics_);
+
+    const double startTime = aStartTime;
+    const double endTime = anEndTime;
+
+    NumericalSolver::ConditionSolution conditionSolution = {
+        {anInitialStateVector, startTime}, Array<NumericalSolver::EventSolution>::Empty(), false
+    };
+
+    if (endTime == startTime)  // If integration duration is zero seconds long, skip integration
+    {
+        return conditionSolution;
+    }
+
+    const double direction = (endTime > startTime) ? 1.0 : -1.0;
+
+    // Time tolerance under which the end time is considered reached, and to which event times are located
+    const double timeTolerance = 1e-12 * std::max({1.0, std::abs(startTime), std::abs(endTime)});
+
+    this->observeNumericalIntegration(anInitialStateVector, startTime);
+
+    Array<double> previousValues = Array<double>::Empty();
+
+    for (const EventCondition& eventCondition : anEventConditionArray)
+    {
+        previousValues.add(eventCondition.evaluate(anInitialStateVector, startTime));
+    }
+
+    Array<double> currentValues = previousValues;
+
+    NumericalSolver::StateVector interpolatedState(anInitialStateVector.size());
+
+    // Check the event conditions at the end of an accepted step, and locate their crossings within the step on the
+    // step interpolant. Returns true if a terminal condition is met, the solution then holding the state it is met at.
+
+    const auto checkEventConditions = [&](const double aPreviousTime,
+                                          const double aCurrentTime,
+                                          const NumericalSolver::StateVector& aCurrentState,
+                                          const auto& anInterpolant) -> bool
+    {
+        const bool isForward = direction > 0.0;
+
+        Array<Pair<double, Index>> crossings = Array<Pair<double, Index>>::Empty();
+
+        for (Index i = 0; i < anEventConditionArray.size(); ++i)
+        {
+            const EventCondition& eventCondition = anEventConditionArray[i];
+
+            currentValues[i] = eventCondition.evaluate(aCurrentState, aCurrentTime);
+
+            if (!eventCondition.isSatisfied(previousValues[i], currentValues[i]))
+            {
+                continue;
+            }
+
+            const auto conditionFunction = [&eventCondition, &anInterpolant](const double aTime) -> double
+            {
+                return eventCondition.evaluate(anInterpolant(aTime), aTime);
+            };
+
+            const auto isConverged = [timeTolerance](const double aLowerTime, const double anUpperTime) -> bool
+            {
+                return (anUpperTime - aLowerTime) <= timeTolerance;
+            };
+
+            boost::uintmax_t iterationCount = 100;
+
+            const std::pair<double, double> bracket = boost::math::tools::toms748_solve(
+                conditionFunction,
+                isForward ? aPreviousTime : aCurrentTime,
+                isForward ? aCurrentTime : aPreviousTime,
+                isForward ? previousValues[i] : currentValues[i],
+                isForward ? currentValues[i] : previousValues[i],
+                isConverged,
+                iterationCount
+            );
+
+            // Keep the side of the bracket past the crossing, where the condition is met
+            crossings.add({isForward ? bracket.second : bracket.first, i});
+        }
+
+        std::swap(previousValues, currentValues);
+
+        std::sort(
+            crossings.begin(),
+            crossings.end(),
+            [direction](const Pair<double, Index>& aCrossing, const Pair<double, Index>& anotherCrossing) -> bool
+            {
+                return (direction * aCrossing.first) < (direction * anotherCrossing.first);
+            }
+        );
+
+        for (const Pair<double, Index>& crossing : crossings)
+        {
+            const NumericalSolver::Solution eventSolution = {anInterpolant(crossing.first), crossing.first};
+
+            conditionSolution.eventSolutions.add({crossing.second, eventSolution});
+
+            if (anEventConditionArray[crossing.second].isTerminal())
+            {
+                conditionSolution.solution = eventSolution;
+                conditionSolution.conditionIsSatisfied = true;
+
+                this->observeNumericalIntegration(eventSolution.first, eventSolution.second);
+
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    const auto systemOfEquations =
+        countSystemOfEquationsCalls(aSystemOfEquations, statistics_.systemOfEquationsCallCount);
+
+    switch (stepperType_)
+    {
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+        {
+            auto stepper = make_dense_output(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5<>());
+
+            stepper.initialize(anInitialStateVector, startTime, getSignedTimeStep(anEndTime - aStartTime));
+
+            // Continuous extension of the last step, which requires no call to the system of equations
+            const auto interpolant = [&stepper, &interpolatedState](const double aTime
+                                     ) -> const NumericalSolver::StateVector&
+            {
+                stepper.calc_state(aTime, interpolatedState);
+                return interpolatedState;
+            };
+
+            while (direction * (endTime - stepper.current_time()) > timeTolerance)
+            {
+                // Do not step past the end time
+                if (direction * (stepper.current_time() + stepper.current_time_step() - endTime) > 0.0)
+                {
+                    stepper.initialize(
+                        stepper.current_state(), stepper.current_time(), endTime - stepper.current_time()
+                    );
+                }
+
+                const Size callCount = statistics_.systemOfEquationsCallCount;
+
+                stepper.do_step(systemOfEquations);
+
+                this->recordDenseOutputStep(
+                    stepper.previous_time(), stepper.current_time(), statistics_.systemOfEquationsCallCount - callCount
+                );
+
+                if (checkEventConditions(
+                        stepper.previous_time(), stepper.current_time(), stepper.current_state(), interpolant
+                    ))
+                {
+                    return conditionSolution;
+                }
+
+                this->observeNumericalIntegration(stepper.current_state(), stepper.current_time());
+            }
+
+            conditionSolution.solution = {stepper.current_state(), endTime};
+
+            return conditionSolution;
+        }
+
+        case NumericalSolver::StepperType::Rosenbrock4:
+        case NumericalSolver::StepperType::BackwardDifferentiationFormula:
+        {
+            const auto integrateImplicitSteps = [&](auto&& aStepper) -> void
+            {
+                aStepper.initialize(anInitialStateVector, startTime, getSignedTimeStep(anEndTime - aStartTime));
+
+                // Continuous extension of the last step, which requires no call to the system of equations
+                const auto interpolant = [&aStepper, &interpolatedState](const double aTime
+                                         ) -> const NumericalSolver::StateVector&
+                {
+                    aStepper.calc_state(aTime, interpolatedState);
+                    return interpolatedState;
+                };
+
+                while (direction * (endTime - aStepper.current_time()) > timeTolerance)
+                {
+                    aStepper.do_step(endTime);
+
+                    if (checkEventConditions(
+                            aStepper.previous_time(), aStepper.current_time(), aStepper.current_state(), interpolant
+                        ))
+                    {
+                        return;
+                    }
+
+                    this->observeNumericalIntegration(aStepper.current_state(), aStepper.current_time());
+                }
+
+                conditionSolution.solution = {aStepper.current_state(), endTime};
+            };
+
+            const NumericalSolver::SystemOfEquationsWrapper countedSystemOfEquations = systemOfEquations;
+
+            const NumericalSolver::StepTraceHook stepRecorder =
+                [this](const double aTime, const double aStepSize, const bool isAccepted) -> void
+            {
+                this->recordStep(aTime, aStepSize, isAccepted);
+            };
+
+            if (stepperType_ == NumericalSolver::StepperType::Rosenbrock4)
+            {
+                integrateImplicitSteps(Rosenbrock4Stepper(
+                    countedSystemOfEquations, jacobian_, absoluteTolerance_, relativeTolerance_, stepRecorder
+                ));
+            }
+            else
+            {
+                integrateImplicitSteps(BackwardDifferentiationFormulaStepper(
+                    countedSystemOfEquations, jacobian_, absoluteTolerance_, relativeTolerance_, stepRecorder
+                ));
+            }
+
+            return conditionSolution;
+        }
+
+        case NumericalSolver::StepperType::RungeKutta4:
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+        case NumericalSolver::StepperType::VelocityVerlet:
+        case NumericalSolver::StepperType::Yoshida4:
+        case NumericalSolver::StepperType::AdamsBashforthMoulton8:
+        {
+            NumericalSolver::StateVector state = anInitialStateVector;
+            double time = startTime;
+            double timeStep = getSignedTimeStep(anEndTime - aStartTime);
+
+            NumericalSolver::StateVector previousState = state;
+            double previousTime = time;
+
+            // Steppers without continuous extension are interpolated by a partial step of the same method from the
+            // start of the last step, which keeps the method order (at the cost of one step per root evaluation)
+            const auto integrateSteps = [&](auto& aStepper, const auto& aStepFunction) -> void
+            {
+                const auto interpolant = [&](const double aTime) -> const NumericalSolver::StateVector&
+                {
+                    interpolatedState = previousState;
+                    aStepper.do_step(systemOfEquations, interpolatedState, previousTime, aTime - previousTime);
+
+                    return interpolatedState;
+                };
+
+                while (direction * (endTime - time) > timeTolerance)
+                {
+                    // Do not step past the end time
+                    if (direction * (time + timeStep - endTime) > 0.0)
+                    {
+                        timeStep = endTime - time;
+                    }
+
+                    previousState = state;
+                    previousTime = time;
+
+                    aStepFunction();
+
+                    if (checkEventConditions(previousTime, time, state, interpolant))
+                    {
+                        return;
+                    }
+
+                    this->observeNumericalIntegration(state, time);
+                }
+
+                conditionSolution.solution = {state, endTime};
+            };
+
+            const auto integrateControlledSteps = [&](auto anErrorStepper) -> void
+            {
+                auto controlledStepper = recordSteps(
+                    make_controlled(absoluteTolerance_, relativeTolerance_, anErrorStepper),
+                    [this](const double aTime, const double aStepSize, const bool isAccepted) -> void
+                    {
+                        this->recordStep(aTime, aStepSize, isAccepted);
+                    }
+                );
+
+                integrateSteps(
+                    anErrorStepper,
+                    [&]() -> void
+                    {
+                        Size failedTrialCount = 0;
+
+                        while (controlledStepper.try_step(systemOfEquations, state, time, timeStep) == fail)
+                        {
+                            if (++failedTrialCount >= 500)
+                            {
+                                throw ostk::core::error::RuntimeError(
+                                    "Step size adjustment failed at time [{}].", previousTime
+                                );
+                            }
+                        }
+                    }
+                );
+            };
+
+            if (stepperType_ == NumericalSolver::StepperType::RungeKutta4)
+            {
+                stepper_type_4<> stepper;
+
+                integrateSteps(
+                    stepper,
+                    [&]() -> void
+                    {
+                        stepper.do_step(systemOfEquations, state, time, timeStep);
+                        this->recordStep(time, timeStep, true);
+                        time += timeStep;
+                    }
+                );
+            }
+            else if ((stepperType_ == NumericalSolver::StepperType::VelocityVerlet) ||
+                     (stepperType_ == NumericalSolver::StepperType::Yoshida4))
+            {
+                SymplecticStepper<> stepper = SymplecticStepper<>::FromStepperType(stepperType_);
+
+                integrateSteps(
+                    stepper,
+                    [&]() -> void
+                    {
+                        stepper.do_step(systemOfEquations, state, time, timeStep);
+                        this->recordStep(time, timeStep, true);
+                        time += timeStep;
+                    }
+                );
+            }
+            else if (stepperType_ == NumericalSolver::StepperType::AdamsBashforthMoulton8)
+            {
+                // The multistep history requires a constant time step: the shortened last step, and the interpolation
+                // within steps, use RKF78 steps instead
+                multistep_stepper_type_8<> multistepStepper;
+                error_stepper_type_78<> partialStepper;
+
+                const double nominalTimeStep = timeStep;
+
+                integrateSteps(
+                    partialStepper,
+                    [&]() -> void
+                    {
+                        if (timeStep == nominalTimeStep)
+                        {
+                            multistepStepper.do_step(systemOfEquations, state, time, timeStep);
+                        }
+                        else
+                        {
+                            partialStepper.do_step(systemOfEquations, state, time, timeStep);
+                        }
+
+                        this->recordStep(time, timeStep, true);
+                        time += timeStep;
+                    }
+                );
+            }
+            else if (stepperType_ == NumericalSolver::StepperType::RungeKuttaCashKarp54)
+            {
+                integrateControlledSteps(error_stepper_type_54<>());
+            }
+            else
+            {
+                integrateControlledSteps(error_stepper_type_78<>());
+            }
+
+            return conditionSolution;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type");
+    }
+}
+
+NumericalSolver::ConditionSolution NumericalSolver::integrateDuration(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Array<EventCondition>& anEventConditionArray
+)
+{
+    return this->integrateTime(
+        anInitialStateVector, 0.0, aDurationInSeconds, aSystemOfEquations, anEventConditionArray
+    );
+}
+
+template <int N>
+NumericalSolver::FixedSolution<N> NumericalSolver::integrateDuration(
+    const FixedStateVector<N>& anInitialStateVector,
+    const Real& aDurationInSeconds,
+    const std::enable_if_t<(N > 0), FixedSystemOfEquationsWrapper<N>>& aSystemOfEquations
+)
+{
+    NumericalSolver::FixedStateVector<N> aStateVector = anInitialStateVector;
+
+    this->resetObservedStateVectors();
+
+    const IntegrationTimer integrationTimer(statistics_);
+
+    if (aDurationInSeconds.isZero())  // If integration duration is zero seconds long, skip integration
+    {
+        return {anInitialStateVector, 0.0};
+    }
+
+    // Intermediate states are only observed (as dynamic state vectors) when logging or streaming, to keep the loop
+    // allocation free
+
+    const auto observer = [this](const NumericalSolver::FixedStateVector<N>& x, double t) -> void
+    {
+        if ((logType_ != NumericalSolver::LogType::NoLog) || (stateObserver_ != nullptr))
+        {
+            this->observeNumericalIntegration(x, t);
+        }
+    };
+
+    this->integrateStateDuration(aStateVector, aDurationInSeconds, aSystemOfEquations, observer);
+
+    return {aStateVector, aDurationInSeconds};
+}
+
+template <int N>
+NumericalSolver::FixedSolution<N> NumericalSolver::integrateTime(
+    const FixedStateVector<N>& anInitialStateVector,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const std::enable_if_t<(N > 0), FixedSystemOfEquationsWrapper<N>>& aSystemOfEquations
+)
+{
+    return this->integrateDuration<N>(anInitialStateVector, (anEndTime - aStartTime), aSystemOfEquations);
+}
+
+Array<NumericalSolver::Solution> NumericalSolver::integrateDuration(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Array<Real>& aDurationArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    return integrateTime(anInitialStateVector, 0.0, aDurationArray, aSystemOfEquations);
+}
+
+Array<NumericalSolver::Solution> NumericalSolver::integrateDuration(
+    const Array<NumericalSolver::StateVector>& anInitialStateVectorArray,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Size& aThreadCount
+)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    const IntegrationTimer integrationTimer(statistics_);
+
+    const Size trajectoryCount = anInitialStateVectorArray.size();
+
+    if (trajectoryCount == 0)
+    {
+        return {};
+    }
+
+    const Size threadCount =
+        std::min(trajectoryCount, (aThreadCount == 0) ? ThreadPool::DefaultThreadCount() : aThreadCount);
+
+    // Each thread owns a copy of the solver (and thus its own observer buffer), without its observer and trace hook,
+    // and trajectories are pulled from a shared counter: every trajectory is integrated by the exact same sequential
+    // code path whatever the thread count. The explicit solver is built beforehand, to be shared by the copies, which
+    // do not log (so that logs of concurrent trajectories do not interleave).
+
+    this->accessExplicitSolver();
+
+    NumericalSolver workerNumericalSolver = *this;
+    workerNumericalSolver.logType_ = NumericalSolver::LogType::NoLog;
+    workerNumericalSolver.setStateObserver(nullptr);
+    workerNumericalSolver.setStepTraceHook(nullptr);
+
+    std::vector<NumericalSolver> workerNumericalSolvers(threadCount, workerNumericalSolver);
+    std::vector<NumericalSolver::Statistics> workerStatistics(threadCount);
+
+    Array<NumericalSolver::Solution> solutions(trajectoryCount, {NumericalSolver::StateVector(), 0.0});
+
+    ThreadPool threadPool(threadCount);
+
+    // The failure of the first failing trajectory is rethrown once the statistics of all trajectories are gathered
+
+    std::exception_ptr exception = nullptr;
+
+    try
+    {
+        threadPool.run(
+            trajectoryCount,
+            [&](const Size& aTrajectoryIndex, const Size& aThreadIndex) -> void
+            {
+                NumericalSolver& numericalSolver = workerNumericalSolvers[aThreadIndex];
+
+                solutions[aTrajectoryIndex] = numericalSolver.integrateDuration(
+                    anInitialStateVectorArray[aTrajectoryIndex], aDurationInSeconds, aSystemOfEquations
+                );
+
+                accumulateStatistics(workerStatistics[aThreadIndex], numericalSolver.getStatistics());
+            }
+        );
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+
+    for (const NumericalSolver::Statistics& someStatistics : workerStatistics)
+    {
+        accumulateStatistics(statistics_, someStatistics);
+    }
+
+    if (exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    return solutions;
+}
+
+Array<NumericalSolver::Solution> NumericalSolver::integrateTime(
+    const Array<NumericalSolver::StateVector>& anInitialStateVectorArray,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Size& aThreadCount
+)
+{
+    Array<NumericalSolver::Solution> solutions =
+        this->integrateDuration(anInitialStateVectorArray, (anEndTime - aStartTime), aSystemOfEquations, aThreadCount);
+
+    for (NumericalSolver::Solution& solution : solutions)
+    {
+        solution.second = anEndTime;
+    }
+
+    return solutions;
+}
+
+DenseTrajectory NumericalSolver::integrateDenseTime(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    if ((!aStartTime.isDefined()) || (!anEndTime.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Time");
+    }
+
+    if (stepperType_ != NumericalSolver::StepperType::RungeKuttaDopri5)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Dense output is not available with the [{}] stepper type.",
+            NumericalSolver::StringFromStepperType(stepperType_)
+        );
+    }
+
+    if (anEndTime == aStartTime)
+    {
+        throw ostk::core::error::RuntimeError("Dense output requires distinct start and end times.");
+    }
+
+    this->resetObservedStateVectors();
+
+    const IntegrationTimer integrationTimer(statistics_);
+
+    const auto systemOfEquations =
+        countSystemOfEquationsCalls(aSystemOfEquations, statistics_.systemOfEquationsCallCount);
+
+    const double startTime = aStartTime;
+    const double endTime = anEndTime;
+    const double direction = (endTime > startTime) ? 1.0 : -1.0;
+
+    // Time tolerance under which the end time is considered reached
+    const double timeTolerance = 1e-12 * std::max(1.0, std::abs(endTime));
+
+    auto stepper = make_dense_output(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5<>());
+
+    stepper.initialize(anInitialStateVector, startTime, getSignedTimeStep(anEndTime - aStartTime));
+
+    this->observeNumericalIntegration(anInitialStateVector, startTime);
+
+    Array<double> stepTimes = {startTime};
+    Array<NumericalSolver::StateVector> nodeStates = {anInitialStateVector};
+
+    NumericalSolver::StateVector nodeState(anInitialStateVector.size());
+
+    while (direction * (endTime - stepper.current_time()) > timeTolerance)
+    {
+        // Do not step past the end time
+        if (direction * (stepper.current_time() + stepper.current_time_step() - endTime) > 0.0)
+        {
+            stepper.initialize(stepper.current_state(), stepper.current_time(), endTime - stepper.current_time());
+        }
+
+        const Size callCount = statistics_.systemOfEquationsCallCount;
+
+        stepper.do_step(systemOfEquations);
+
+        // Sample the continuous extension of the step: this requires no call to the system of equations
+        const double previousTime = stepper.previous_time();
+        const double currentTime = stepper.current_time();
+
+        this->recordDenseOutputStep(previousTime, currentTime, statistics_.systemOfEquationsCallCount - callCount);
+
+        for (Size k = 1; k < DenseTrajectory::NodeIntervalsPerStep; ++k)
+        {
+            stepper.calc_state(
+                previousTime + (currentTime - previousTime) * double(k) / DenseTrajectory::NodeIntervalsPerStep,
+                nodeState
+            );
+
+            nodeStates.add(nodeState);
+        }
+
+        nodeStates.add(stepper.current_state());
+        stepTimes.add(currentTime);
+
+        this->observeNumericalIntegration(stepper.current_state(), currentTime);
+    }
+
+    stepTimes.accessLast() = endTime;
+
+    VectorXd stepTimeVector(stepTimes.size());
+    MatrixXd nodeStateMatrix(anInitialStateVector.size(), nodeStates.size());
+
+    for (Size i = 0; i < stepTimes.size(); ++i)
+    {
+        stepTimeVector(i) = stepTimes[i];
+    }
+
+    for (Size i = 0; i < nodeStates.size(); ++i)
+    {
+        nodeStateMatrix.col(i) = nodeStates[i];
+    }
+
+    return {stepTimeVector, nodeStateMatrix};
+}
+
+DenseTrajectory NumericalSolver::integrateDenseDuration(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    return this->integrateDenseTime(anInitialStateVector, 0.0, aDurationInSeconds, aSystemOfEquations);
+}
+
+NumericalSolver::EnsembleSolution NumericalSolver::integrateEnsembleDuration(
+    const NumericalSolver::EnsembleState& anInitialEnsembleState,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::EnsembleSystemOfEquationsWrapper& anEnsembleSystemOfEquations,
+    const NumericalSolver::EnsembleStepControl& anEnsembleStepControl
+)
+{
+    if (anInitialEnsembleState.cols() == 0)
+    {
+        throw ostk::core::error::RuntimeError("Ensemble is empty.");
+    }
+
+    this->resetObservedStateVectors();
+
+    const IntegrationTimer integrationTimer(statistics_);
+
+    NumericalSolver::EnsembleState anEnsembleState = anInitialEnsembleState;
+
+    if (aDurationInSeconds.isZero())  // If integration duration is zero seconds long, skip integration
+    {
+        return {anEnsembleState, 0.0};
+    }
+
+    const auto observer = [this](const NumericalSolver::EnsembleState& x, double t) -> void
+    {
+        if ((logType_ == NumericalSolver::LogType::LogConstant) || (logType_ == NumericalSolver::LogType::LogAdaptive))
+        {
+            std::cout.precision(3);
+            std::cout.setf(std::ios::fixed, std::ios::floatfield);
+
+            std::cout << std::left << std::setw(15) << t << "[" << x.cols() << " members]" << std::endl;
+        }
+    };
+
+    switch (anEnsembleStepControl)
+    {
+        case NumericalSolver::EnsembleStepControl::Shared:
+        {
+            // A single matrix state: the stepper error norm is the max over all members, so they share step sizes
+            this->integrateStateDuration(anEnsembleState, aDurationInSeconds, anEnsembleSystemOfEquations, observer);
+            break;
+        }
+
+        case NumericalSolver::EnsembleStepControl::PerMember:
+        {
+            // Each member is an n x 1 matrix driven through the same ensemble dynamics, with its own controller
+            // (members are stepped sequentially, so the dynamics are not vectorized across members)
+            for (Index memberIndex = 0; memberIndex < Index(anEnsembleState.cols()); ++memberIndex)
+            {
+                NumericalSolver::EnsembleState aMemberState = anEnsembleState.col(memberIndex);
+
+                this->integrateStateDuration(aMemberState, aDurationInSeconds, anEnsembleSystemOfEquations, observer);
+
+                anEnsembleState.col(memberIndex) = aMemberState;
+            }
+            break;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Ensemble step control");
+    }
+
+    return {anEnsembleState, aDurationInSeconds};
+}
+
+NumericalSolver::EnsembleSolution NumericalSolver::integrateEnsembleTime(
+    const NumericalSolver::EnsembleState& anInitialEnsembleState,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const NumericalSolver::EnsembleSystemOfEquationsWrapper& anEnsembleSystemOfEquations,
+    const NumericalSolver::EnsembleStepControl& anEnsembleStepControl
+)
+{
+    const NumericalSolver::EnsembleSolution ensembleSolution = this->integrateEnsembleDuration(
+        anInitialEnsembleState, (anEndTime - aStartTime), anEnsembleSystemOfEquations, anEnsembleStepControl
+    );
+
+    return {ensembleSolution.first, anEndTime};
+}
+
+NumericalSolver::VariationalSolution NumericalSolver::integrateVariationalTime(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Real& aStateTransitionMatrixErrorWeight
+)
+{
+    const NumericalSolver::SystemOfEquationsWrapper countedSystemOfEquations =
+        countSystemOfEquationsCalls(aSystemOfEquations, statistics_.systemOfEquationsCallCount);
+
+    NumericalSolver::StateVector timeDerivative;
+    NumericalSolver::StateVector perturbedState;
+    NumericalSolver::StateVector perturbedStateDerivative;
+
+    const auto variationalSystemOfEquations = [&](const NumericalSolver::StateVector& x,
+                                                  NumericalSolver::StateVector& dxdt,
+                                                  MatrixXd& dfdx,
+                                                  const double t) -> void
+    {
+        countedSystemOfEquations(x, dxdt, t);
+
+        if (jacobian_ != nullptr)
+        {
+            timeDerivative.resize(x.size());
+            jacobian_(x, dfdx, timeDerivative, t);
+            return;
+        }
+
+        computeFiniteDifferenceJacobian(
+            countedSystemOfEquations, x, dxdt, t, dfdx, perturbedState, perturbedStateDerivative
+        );
+    };
+
+    return this->integrateVariationalState(
+        anInitialStateVector, aStartTime, anEndTime, variationalSystemOfEquations, aStateTransitionMatrixErrorWeight
+    );
+}
+
+NumericalSolver::VariationalSolution NumericalSolver::integrateVariationalDuration(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Real& aStateTransitionMatrixErrorWeight
+)
+{
+    return this->integrateVariationalTime(
+        anInitialStateVector, 0.0, aDurationInSeconds, aSystemOfEquations, aStateTransitionMatrixErrorWeight
+    );
+}
+
+NumericalSolver::VariationalSolution NumericalSolver::integrateVariationalTime(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const NumericalSolver::DualSystemOfEquationsWrapper& aDualSystemOfEquations,
+    const Real& aStateTransitionMatrixErrorWeight
+)
+{
+    NumericalSolver::DualStateVector dualState;
+    NumericalSolver::DualStateVector dualStateDerivative;
+
+    // Each state component is seeded with its unit derivative, so that the derivatives of the dynamics are the rows of
+    // their Jacobian
 
-using ostk::core::type::Index;
+    const auto variationalSystemOfEquations = [&](const NumericalSolver::StateVector& x,
+                                                  NumericalSolver::StateVector& dxdt,
+                                                  MatrixXd& dfdx,
+                                                  const double t) -> void
+    {
+        const Eigen::Index stateDimension = x.size();
 
-typedef runge_kutta4<NumericalSolver::StateVector> stepper_type_4;
-typedef runge_kutta_cash_karp54<NumericalSolver::StateVector> error_stepper_type_54;
-typedef runge_kutta_fehlberg78<NumericalSolver::StateVector> error_stepper_type_78;
-typedef runge_kutta_dopri5<NumericalSolver::StateVector> dense_stepper_type_5;
+        dualState.resize(stateDimension);
+        dualStateDerivative.resize(stateDimension);
 
-NumericalSolver::NumericalSolver(
-    const NumericalSolver::LogType& aLogType,
-    const NumericalSolver::StepperType& aStepperType,
-    const Real& aTimeStep,
-    const Real& aRelativeTolerance,
-    const Real& anAbsoluteTolerance
+        for (Eigen::Index i = 0; i < stateDimension; ++i)
+        {
+            dualState(i) = NumericalSolver::Dual(x(i), stateDimension, i);
+        }
+
+        ++statistics_.systemOfEquationsCallCount;
+
+        aDualSystemOfEquations(dualState, dualStateDerivative, t);
+
+        for (Eigen::Index i = 0; i < stateDimension; ++i)
+        {
+            dxdt(i) = dualStateDerivative(i).value();
+
+            // Components independent of the state carry no derivatives
+            if (dualStateDerivative(i).derivatives().size() == 0)
+            {
+                dfdx.row(i).setZero();
+            }
+            else
+            {
+                dfdx.row(i) = dualStateDerivative(i).derivatives().transpose();
+            }
+        }
+    };
+
+    return this->integrateVariationalState(
+        anInitialStateVector, aStartTime, anEndTime, variationalSystemOfEquations, aStateTransitionMatrixErrorWeight
+    );
+}
+
+NumericalSolver::VariationalSolution NumericalSolver::integrateVariationalDuration(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::DualSystemOfEquationsWrapper& aDualSystemOfEquations,
+    const Real& aStateTransitionMatrixErrorWeight
 )
-    : logType_(aLogType),
-      stepperType_(aStepperType),
-      timeStep_(aTimeStep),
-      relativeTolerance_(aRelativeTolerance),
-      absoluteTolerance_(anAbsoluteTolerance),
-      observedStateVectors_()
 {
+    return this->integrateVariationalTime(
+        anInitialStateVector, 0.0, aDurationInSeconds, aDualSystemOfEquations, aStateTransitionMatrixErrorWeight
+    );
 }
 
-bool NumericalSolver::operator==(const NumericalSolver& aNumericalSolver) const
+String NumericalSolver::StringFromLogType(const NumericalSolver::LogType& aLogType)
 {
-    if ((!this->isDefined()) || (!aNumericalSolver.isDefined()))
+    switch (aLogType)
     {
-        return false;
-    }
+        case NumericalSolver::LogType::NoLog:
+            return "NoLog";
 
-    return (logType_ == aNumericalSolver.logType_) && (stepperType_ == aNumericalSolver.stepperType_) &&
-           (timeStep_ == aNumericalSolver.timeStep_) && (relativeTolerance_ == aNumericalSolver.relativeTolerance_) &&
-           (absoluteTolerance_ == aNumericalSolver.absoluteTolerance_);
+        case NumericalSolver::LogType::LogConstant:
+            return "LogConstant";
+
+        case NumericalSolver::LogType::LogAdaptive:
+            return "LogAdaptive";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Log Type");
+    }
 }
 
-bool NumericalSolver::operator!=(const NumericalSolver& aNumericalSolver) const
+String NumericalSolver::StringFromStepperType(const NumericalSolver::StepperType& aStepperType)
 {
-    return !((*this) == aNumericalSolver);
+    switch (aStepperType)
+    {
+        case NumericalSolver::StepperType::RungeKutta4:
+            return "RungeKutta4";
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+            return "RungeKuttaCashKarp54";
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+            return "RungeKuttaFehlberg78";
+
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+            return "RungeKuttaDopri5";
+
+        case NumericalSolver::StepperType::Rosenbrock4:
+            return "Rosenbrock4";
+
+        case NumericalSolver::StepperType::BackwardDifferentiationFormula:
+            return "BackwardDifferentiationFormula";
+
+        case NumericalSolver::StepperType::VelocityVerlet:
+            return "VelocityVerlet";
+
+        case NumericalSolver::StepperType::Yoshida4:
+            return "Yoshida4";
+
+        case NumericalSolver::StepperType::AdamsBashforthMoulton8:
+            return "AdamsBashforthMoulton8";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper Type");
+    }
 }
 
-std::ostream& operator<<(std::ostream& anOutputStream, const NumericalSolver& aNumericalSolver)
+String NumericalSolver::StringFromEnsembleStepControl(const NumericalSolver::EnsembleStepControl& anEnsembleStepControl)
 {
-    aNumericalSolver.print(anOutputStream);
+    switch (anEnsembleStepControl)
+    {
+        case NumericalSolver::EnsembleStepControl::Shared:
+            return "Shared";
 
-    return anOutputStream;
+        case NumericalSolver::EnsembleStepControl::PerMember:
+            return "PerMember";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Ensemble Step Control");
+    }
 }
 
-bool NumericalSolver::isDefined() const
+NumericalSolver NumericalSolver::Undefined()
 {
-    return timeStep_.isDefined() && relativeTolerance_.isDefined() && absoluteTolerance_.isDefined();
+    return {
+        LogType::NoLog,
+        StepperType::RungeKuttaCashKarp54,
+        Real::Undefined(),
+        Real::Undefined(),
+        Real::Undefined(),
+    };
 }
 
-void NumericalSolver::print(std::ostream& anOutputStream, bool displayDecorator) const
+NumericalSolver NumericalSolver::Default()
 {
-    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Numerical Solver") : void();
-
-    ostk::core::utils::Print::Line(anOutputStream)
-        << "Integration logging type:" << NumericalSolver::StringFromLogType(logType_);
-    ostk::core::utils::Print::Line(anOutputStream)
-        << "Integration stepper type:" << NumericalSolver::StringFromStepperType(stepperType_);
-    ostk::core::utils::Print::Line(anOutputStream)
-        << "Integration time step:" << (timeStep_.isDefined() ? timeStep_.toString() : "Undefined");
-    ostk::core::utils::Print::Line(anOutputStream)
-        << "Integration relative tolerance:"
-        << (relativeTolerance_.isDefined() ? relativeTolerance_.toString() : "Undefined");
-    ostk::core::utils::Print::Line(anOutputStream)
-        << "Integration absolute tolerance:"
-        << (absoluteTolerance_.isDefined() ? absoluteTolerance_.toString() : "Undefined");
+    return {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+}
 
-    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+void NumericalSolver::resetObservedStateVectors()
+{
+    observedStateVectors_.clear();
+    observationStepCount_ = 0;
+    lastObservationTime_ = Real::Undefined();
 }
 
-const Array<NumericalSolver::Solution>& NumericalSolver::accessObservedStateVectors() const
+void NumericalSolver::observeNumericalIntegration(const NumericalSolver::StateVector& x, const double t)
 {
-    if (!this->isDefined())
+    const bool isStepObserved = (observationStepCount_++ % observationStepInterval_) == 0;
+    const bool isTimeObserved =
+        (!observationMinimumTimeSeparation_.isDefined()) || (!lastObservationTime_.isDefined()) ||
+        (std::abs(t - (double)lastObservationTime_) >= (double)observationMinimumTimeSeparation_);
+
+    if (!(isStepObserved && isTimeObserved))
     {
-        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+        return;
     }
 
-    return this->observedStateVectors_;
-}
+    lastObservationTime_ = t;
 
-NumericalSolver::LogType NumericalSolver::getLogType() const
-{
-    if (!this->isDefined())
+    if (stateObserver_ != nullptr)
     {
-        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+        stateObserver_(x, t);
+    }
+    else
+    {
+        observedStateVectors_.add({x, t});
     }
 
-    return this->logType_;
+    switch (logType_)
+    {
+        case NumericalSolver::LogType::LogAdaptive:
+        case NumericalSolver::LogType::LogConstant:
+        {
+            std::cout.precision(3);
+            std::cout.setf(std::ios::fixed, std::ios::floatfield);
+
+            std::cout << std::left << std::setw(15) << t;
+
+            std::cout.precision(10);
+            std::cout.setf(std::ios::scientific, std::ios::floatfield);
+            for (Size i = 0; i < (Size)x.size(); i++)
+            {
+                std::cout << std::internal << std::setw(16) << x[i] << "     ";
+            }
+            std::cout << std::endl;
+
+            std::cout.setf(std::ios::fixed, std::ios::floatfield);
+
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
 }
 
-NumericalSolver::StepperType NumericalSolver::getStepperType() const
+void NumericalSolver::recordStep(const double aTime, const double aStepSize, const bool isAccepted)
 {
-    if (!this->isDefined())
+    if (stepTraceHook_ != nullptr)
     {
-        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+        stepTraceHook_(aTime, aStepSize, isAccepted);
     }
 
-    return this->stepperType_;
-}
-
-Real NumericalSolver::getTimeStep() const
-{
-    if (!this->isDefined())
+    if (!isAccepted)
     {
-        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+        ++statistics_.rejectedStepCount;
+        return;
     }
 
-    return this->timeStep_;
-}
+    const double stepSize = std::abs(aStepSize);
 
-Real NumericalSolver::getRelativeTolerance() const
-{
-    if (!this->isDefined())
+    if (statistics_.acceptedStepCount++ == 0)
     {
-        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+        statistics_.minimumStepSize = stepSize;
+        statistics_.maximumStepSize = stepSize;
+        statistics_.meanStepSize = stepSize;
+
+        return;
     }
 
-    return this->relativeTolerance_;
+    statistics_.minimumStepSize = std::min((double)statistics_.minimumStepSize, stepSize);
+    statistics_.maximumStepSize = std::max((double)statistics_.maximumStepSize, stepSize);
+    statistics_.meanStepSize = (double)statistics_.meanStepSize +
+                               (stepSize - (double)statistics_.meanStepSize) / double(statistics_.acceptedStepCount);
 }
 
-Real NumericalSolver::getAbsoluteTolerance() const
+void NumericalSolver::recordDenseOutputStep(
+    const double aPreviousTime, const double aCurrentTime, const Size& aCallCount
+)
 {
-    if (!this->isDefined())
+    // Each Dopri5 trial makes 6 calls to the system of equations (the first stage derivative being reused from the
+    // previous step), the dense output stepper retrying rejected trials internally
+    static constexpr Size CallCountPerTrial = 6;
+
+    for (Size trialIndex = 1; trialIndex < (aCallCount / CallCountPerTrial); ++trialIndex)
     {
-        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+        this->recordStep(aPreviousTime, std::numeric_limits<double>::quiet_NaN(), false);
     }
 
-    return this->absoluteTolerance_;
+    this->recordStep(aPreviousTime, aCurrentTime - aPreviousTime, true);
 }
 
-Array<NumericalSolver::Solution> NumericalSolver::getObservedStateVectors() const
+double NumericalSolver::getSignedTimeStep(const Real& aReal) const
 {
-    return this->accessObservedStateVectors();
+    const Real durationSign = (aReal > 0.0) - (aReal < 0.0);
+    return timeStep_ * durationSign;
 }
 
-Array<NumericalSolver::Solution> NumericalSolver::integrateTime(
-    const StateVector& anInitialStateVector,
-    const Real& aStartTime,
-    const Array<Real>& aTimeArray,
-    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
-)
+bool NumericalSolver::isImplicit() const
 {
-    observedStateVectors_.clear();
+    return (stepperType_ == NumericalSolver::StepperType::Rosenbrock4) ||
+           (stepperType_ == NumericalSolver::StepperType::BackwardDifferentiationFormula);
+}
 
-    NumericalSolver::StateVector aStateVector = anInitialStateVector;
+const NumericalSolver::ExplicitSolver* NumericalSolver::accessExplicitSolver()
+{
+    // Built at the first integration of an explicit Runge-Kutta stepper type only, and then shared by the copies of
+    // this solver (the settings it is built from being immutable)
 
-    // Check if time array has zero length
-    if (aTimeArray.size() == 0)
+    if (explicitSolver_ == nullptr)
     {
-        throw ostk::core::error::RuntimeError("Time Array is empty");
+        explicitSolver_ = NumericalSolver::ExplicitSolver::FromNumericalSolver(*this);
     }
 
-    // Check if the incoming time array is the same as the start time if it has length 1
-    if ((aTimeArray.size() == 1) && (aTimeArray[0] == aStartTime))
+    return explicitSolver_.get();
+}
+
+void NumericalSolver::integrateImplicitTime(
+    NumericalSolver::StateVector& aState,
+    const double aStartTime,
+    const double anEndTime,
+    const Array<double>& anOutputTimeArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const std::function<void(const NumericalSolver::StateVector&, const double)>& anObserver
+)
+{
+    const double direction = (anEndTime >= aStartTime) ? 1.0 : -1.0;
+
+    const NumericalSolver::StepTraceHook stepRecorder =
+        [this](const double aTime, const double aStepSize, const bool isAccepted) -> void
     {
-        return {
-            {anInitialStateVector, aStartTime},
-        };
-    }
+        this->recordStep(aTime, aStepSize, isAccepted);
+    };
 
-    // Ensure integration starts in the correct direction with the initial time step guess
-    const double adjustedTimeStep = getSignedTimeStep(aTimeArray.accessLast());
+    // Observe every accepted step if no output times are given, otherwise the step interpolant at each output time
 
-    // Add start time to the start of array
-    Array<double> durationArray(aTimeArray.begin(), aTimeArray.end());
-    durationArray.insert(durationArray.begin(), aStartTime);
+    const auto integrate = [&](auto&& aStepper) -> void
+    {
+        aStepper.initialize(aState, aStartTime, getSignedTimeStep(anEndTime - aStartTime));
+
+        auto outputTimeIterator = anOutputTimeArray.begin();
+
+        while ((outputTimeIterator != anOutputTimeArray.end()) && (*outputTimeIterator == aStartTime))
+        {
+            anObserver(aState, aStartTime);
+            ++outputTimeIterator;
+        }
+
+        if (anOutputTimeArray.isEmpty())
+        {
+            anObserver(aState, aStartTime);
+        }
+
+        NumericalSolver::StateVector outputState(aState.size());
+
+        while (direction * (anEndTime - aStepper.current_time()) > 0.0)
+        {
+            aStepper.do_step(anEndTime);
+
+            if (anOutputTimeArray.isEmpty())
+            {
+                anObserver(aStepper.current_state(), aStepper.current_time());
+                continue;
+            }
+
+            while ((outputTimeIterator != anOutputTimeArray.end()) &&
+                   (direction * (*outputTimeIterator - aStepper.current_time()) <= 0.0))
+            {
+                if (*outputTimeIterator == aStepper.current_time())
+                {
+                    anObserver(aStepper.current_state(), *outputTimeIterator);
+                }
+                else
+                {
+                    aStepper.calc_state(*outputTimeIterator, outputState);
+                    anObserver(outputState, *outputTimeIterator);
+                }
+
+                ++outputTimeIterator;
+            }
+        }
+
+        aState = aStepper.current_state();
+    };
+
+    switch (stepperType_)
+    {
+        case NumericalSolver::StepperType::Rosenbrock4:
+            integrate(Rosenbrock4Stepper(
+                aSystemOfEquations, jacobian_, absoluteTolerance_, relativeTolerance_, stepRecorder
+            ));
+            return;
+
+        case NumericalSolver::StepperType::BackwardDifferentiationFormula:
+            integrate(BackwardDifferentiationFormulaStepper(
+                aSystemOfEquations, jacobian_, absoluteTolerance_, relativeTolerance_, stepRecorder
+            ));
+            return;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type");
+    }
+}
 
-    const auto observer = [this](const NumericalSolver::StateVector& x, double t) -> void
+template <class Observer>
+void NumericalSolver::integrateStateTimes(
+    NumericalSolver::StateVector& aState,
+    const Array<double>& aTimeArray,
+    const double aTimeStep,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Observer& anObserver
+)
+{
+    const auto systemOfEquations =
+        countSystemOfEquationsCalls(aSystemOfEquations, statistics_.systemOfEquationsCallCount);
+
+    const auto stepRecorder = [this](const double aTime, const double aStepSize, const bool isAccepted) -> void
     {
-        this->observeNumericalIntegration(x, t);
+        this->recordStep(aTime, aStepSize, isAccepted);
     };
 
     switch (stepperType_)
@@ -196,20 +2742,77 @@ Array<NumericalSolver::Solution> NumericalSolver::integrateTime(
         case NumericalSolver::StepperType::RungeKutta4:
         {
             integrate_times(
-                stepper_type_4(), aSystemOfEquations, aStateVector, durationArray, adjustedTimeStep, observer
+                recordSteps(stepper_type_4<>(), stepRecorder),
+                systemOfEquations,
+                aState,
+                aTimeArray,
+                aTimeStep,
+                anObserver
+            );
+            break;
+        }
+
+        case NumericalSolver::StepperType::VelocityVerlet:
+        case NumericalSolver::StepperType::Yoshida4:
+        {
+            integrate_times(
+                recordSteps(SymplecticStepper<>::FromStepperType(stepperType_), stepRecorder),
+                systemOfEquations,
+                aState,
+                aTimeArray,
+                aTimeStep,
+                anObserver
             );
             break;
         }
 
+        case NumericalSolver::StepperType::AdamsBashforthMoulton8:
+        {
+            // The multistep history requires a constant time step: steps are kept on a fixed grid, the states at the
+            // requested times being reached by a partial RKF78 step from the last grid step
+            auto multistepStepper = recordSteps(multistep_stepper_type_8<>(), stepRecorder);
+            error_stepper_type_78<> partialStepper;
+
+            const double startTime = aTimeArray.accessFirst();
+
+            Size stepCount = 0;
+            double time = startTime;
+
+            NumericalSolver::StateVector outputState;
+
+            for (const double outputTime : aTimeArray)
+            {
+                while (aTimeStep * (outputTime - (startTime + double(stepCount + 1) * aTimeStep)) >= 0.0)
+                {
+                    multistepStepper.do_step(systemOfEquations, aState, time, aTimeStep);
+                    time = startTime + double(++stepCount) * aTimeStep;
+                }
+
+                if (outputTime == time)
+                {
+                    anObserver(aState, time);
+                    continue;
+                }
+
+                outputState = aState;
+                partialStepper.do_step(systemOfEquations, outputState, time, outputTime - time);
+                anObserver(outputState, outputTime);
+            }
+
+            break;
+        }
+
         case NumericalSolver::StepperType::RungeKuttaCashKarp54:
         {
             integrate_times(
-                make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_54()),
-                aSystemOfEquations,
-                aStateVector,
-                durationArray,
-                adjustedTimeStep,
-                observer
+                recordSteps(
+                    make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_54<>()), stepRecorder
+                ),
+                systemOfEquations,
+                aState,
+                aTimeArray,
+                aTimeStep,
+                anObserver
             );
             break;
         }
@@ -217,12 +2820,14 @@ Array<NumericalSolver::Solution> NumericalSolver::integrateTime(
         case NumericalSolver::StepperType::RungeKuttaFehlberg78:
         {
             integrate_times(
-                make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_78()),
-                aSystemOfEquations,
-                aStateVector,
-                durationArray,
-                adjustedTimeStep,
-                observer
+                recordSteps(
+                    make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_78<>()), stepRecorder
+                ),
+                systemOfEquations,
+                aState,
+                aTimeArray,
+                aTimeStep,
+                anObserver
             );
             break;
         }
@@ -230,12 +2835,23 @@ Array<NumericalSolver::Solution> NumericalSolver::integrateTime(
         case NumericalSolver::StepperType::RungeKuttaDopri5:
         {
             integrate_times(
-                make_controlled(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5()),
-                aSystemOfEquations,
-                aStateVector,
-                durationArray,
-                adjustedTimeStep,
-                observer
+                recordSteps(
+                    make_controlled(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5<>()), stepRecorder
+                ),
+                systemOfEquations,
+                aState,
+                aTimeArray,
+                aTimeStep,
+                anObserver
+            );
+            break;
+        }
+
+        case NumericalSolver::StepperType::Rosenbrock4:
+        case NumericalSolver::StepperType::BackwardDifferentiationFormula:
+        {
+            this->integrateImplicitTime(
+                aState, aTimeArray.accessFirst(), aTimeArray.accessLast(), aTimeArray, systemOfEquations, anObserver
             );
             break;
         }
@@ -243,303 +2859,304 @@ Array<NumericalSolver::Solution> NumericalSolver::integrateTime(
         default:
             throw ostk::core::error::runtime::Wrong("Stepper type");
     }
-
-    // Return array of StateVectors excluding first element which is a repeat of the startState
-    return Array<NumericalSolver::Solution>(observedStateVectors_.begin() + 1, observedStateVectors_.end());
 }
 
-NumericalSolver::Solution NumericalSolver::integrateDuration(
-    const StateVector& anInitialStateVector,
-    const Real& aDurationInSeconds,
-    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+template <class VariationalSystemOfEquations>
+NumericalSolver::VariationalSolution NumericalSolver::integrateVariationalState(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const VariationalSystemOfEquations& aVariationalSystemOfEquations,
+    const Real& aStateTransitionMatrixErrorWeight
 )
 {
-    NumericalSolver::StateVector aStateVector = anInitialStateVector;
-
-    observedStateVectors_.clear();
-
-    if (aDurationInSeconds.isZero())  // If integration duration is zero seconds long, skip integration
+    if (!this->isDefined())
     {
-        return {anInitialStateVector, 0.0};
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
     }
 
-    // Ensure integration starts in the correct direction with the initial time step guess
-    const double adjustedTimeStep = getSignedTimeStep(aDurationInSeconds);
-
-    const auto observer = [this](const NumericalSolver::StateVector& x, double t) -> void
+    if ((!aStateTransitionMatrixErrorWeight.isDefined()) || (aStateTransitionMatrixErrorWeight < 0.0))
     {
-        this->observeNumericalIntegration(x, t);
-    };
+        throw ostk::core::error::runtime::Wrong("State transition matrix error weight");
+    }
 
     switch (stepperType_)
     {
         case NumericalSolver::StepperType::RungeKutta4:
-        {
-            // Integrate_adaptive uses constant step size under the hood
-            // for a stepper without error control like RK4.
-            // Therefore, just use integrate_const for simplicity.
-            switch (logType_)
-            {
-                case NumericalSolver::LogType::NoLog:
-                case NumericalSolver::LogType::LogAdaptive:
-                case NumericalSolver::LogType::LogConstant:
-                {
-                    integrate_const(
-                        stepper_type_4(),
-                        aSystemOfEquations,
-                        aStateVector,
-                        (0.0),
-                        (double)aDurationInSeconds,
-                        adjustedTimeStep,
-                        observer
-                    );
-                    return {aStateVector, aDurationInSeconds};
-                }
-                default:
-                    throw ostk::core::error::runtime::Wrong("Log type");
-            }
-        }
-
         case NumericalSolver::StepperType::RungeKuttaCashKarp54:
-        {
-            switch (logType_)
-            {
-                case NumericalSolver::LogType::NoLog:
-                case NumericalSolver::LogType::LogAdaptive:
-                {
-                    integrate_adaptive(
-                        make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_54()),
-                        aSystemOfEquations,
-                        aStateVector,
-                        (0.0),
-                        (double)aDurationInSeconds,
-                        adjustedTimeStep,
-                        observer
-                    );
-                    return {aStateVector, aDurationInSeconds};
-                }
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+            break;
 
-                case NumericalSolver::LogType::LogConstant:
-                {
-                    integrate_const(
-                        make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_54()),
-                        aSystemOfEquations,
-                        aStateVector,
-                        (0.0),
-                        (double)aDurationInSeconds,
-                        adjustedTimeStep,
-                        observer
-                    );
-                    return {aStateVector, aDurationInSeconds};
-                }
-                default:
-                    throw ostk::core::error::runtime::Wrong("Log type");
-            }
-        }
+        default:
+            throw ostk::core::error::RuntimeError(
+                "Variational integration is not available with the [{}] stepper type.",
+                NumericalSolver::StringFromStepperType(stepperType_)
+            );
+    }
 
-        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
-        {
-            switch (logType_)
-            {
-                case NumericalSolver::LogType::NoLog:
-                case NumericalSolver::LogType::LogAdaptive:
-                {
-                    integrate_adaptive(
-                        make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_78()),
-                        aSystemOfEquations,
-                        aStateVector,
-                        (0.0),
-                        (double)aDurationInSeconds,
-                        adjustedTimeStep,
-                        observer
-                    );
-                    return {aStateVector, aDurationInSeconds};
-                }
+    this->resetObservedStateVectors();
 
-                case NumericalSolver::LogType::LogConstant:
-                {
-                    integrate_const(
-                        make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_78()),
-                        aSystemOfEquations,
-                        aStateVector,
-                        (0.0),
-                        (double)aDurationInSeconds,
-                        adjustedTimeStep,
-                        observer
-                    );
-                    return {aStateVector, aDurationInSeconds};
-                }
-                default:
-                    throw ostk::core::error::runtime::Wrong("Log type");
-            }
-        }
+    const IntegrationTimer integrationTimer(statistics_);
 
-        case NumericalSolver::StepperType::RungeKuttaDopri5:
-        {
-            switch (logType_)
-            {
-                case NumericalSolver::LogType::NoLog:
-                case NumericalSolver::LogType::LogAdaptive:
-                {
-                    integrate_adaptive(
-                        make_controlled(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5()),
-                        aSystemOfEquations,
-                        aStateVector,
-                        (0.0),
-                        (double)aDurationInSeconds,
-                        adjustedTimeStep,
-                        observer
-                    );
-                    return {aStateVector, aDurationInSeconds};
-                }
+    const Eigen::Index stateDimension = anInitialStateVector.size();
 
-                case NumericalSolver::LogType::LogConstant:
-                {
-                    integrate_const(
-                        make_controlled(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5()),
-                        aSystemOfEquations,
-                        aStateVector,
-                        (0.0),
-                        (double)aDurationInSeconds,
-                        adjustedTimeStep,
-                        observer
-                    );
-                    return {aStateVector, aDurationInSeconds};
-                }
-                default:
-                    throw ostk::core::error::runtime::Wrong("Log type");
-            }
-        }
+    const double startTime = aStartTime;
+    const double endTime = anEndTime;
 
-        default:
-            throw ostk::core::error::runtime::Wrong("Stepper type");
+    if (endTime == startTime)  // If integration duration is zero seconds long, skip integration
+    {
+        return {anInitialStateVector, MatrixXd::Identity(stateDimension, stateDimension), startTime};
     }
 
-    throw ostk::core::error::RuntimeError("No State Vector returned from Odeint.");
+    // The state transition matrix is stored column-major right after the state, in a single contiguous state vector
 
-    return {anInitialStateVector, 0.0};
-}
+    NumericalSolver::StateVector augmentedState(stateDimension * (stateDimension + 1));
 
-NumericalSolver::Solution NumericalSolver::integrateTime(
-    const StateVector& anInitialStateVector,
-    const Real& aStartTime,
-    const Real& anEndTime,
-    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
-)
-{
-    return this->integrateDuration(anInitialStateVector, (anEndTime - aStartTime), aSystemOfEquations);
-}
+    augmentedState.head(stateDimension) = anInitialStateVector;
+    Eigen::Map<MatrixXd>(augmentedState.data() + stateDimension, stateDimension, stateDimension).setIdentity();
 
-Array<NumericalSolver::Solution> NumericalSolver::integrateDuration(
-    const NumericalSolver::StateVector& anInitialStateVector,
-    const Array<Real>& aDurationArray,
-    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
-)
-{
-    return integrateTime(anInitialStateVector, 0.0, aDurationArray, aSystemOfEquations);
-}
+    NumericalSolver::StateVector state(stateDimension);
+    NumericalSolver::StateVector stateDerivative(stateDimension);
+    MatrixXd jacobian(stateDimension, stateDimension);
 
-String NumericalSolver::StringFromLogType(const NumericalSolver::LogType& aLogType)
-{
-    switch (aLogType)
+    // State derivative, followed by the variational equations dPhi/dt = df/dx Phi
+    const auto augmentedSystemOfEquations = [&](const NumericalSolver::StateVector& x,
+                                                NumericalSolver::StateVector& dxdt,
+                                                const double t) -> void
     {
-        case NumericalSolver::LogType::NoLog:
-            return "NoLog";
+        state = x.head(stateDimension);
 
-        case NumericalSolver::LogType::LogConstant:
-            return "LogConstant";
+        aVariationalSystemOfEquations(state, stateDerivative, jacobian, t);
 
-        case NumericalSolver::LogType::LogAdaptive:
-            return "LogAdaptive";
+        dxdt.head(stateDimension) = stateDerivative;
+        Eigen::Map<MatrixXd>(dxdt.data() + stateDimension, stateDimension, stateDimension).noalias() =
+            jacobian * Eigen::Map<const MatrixXd>(x.data() + stateDimension, stateDimension, stateDimension);
+    };
 
-        default:
-            throw ostk::core::error::runtime::Wrong("Log Type");
-    }
-}
+    const auto observer = [this, stateDimension](const NumericalSolver::StateVector& x, const double t) -> void
+    {
+        this->observeNumericalIntegration(x.head(stateDimension), t);
+    };
 
-String NumericalSolver::StringFromStepperType(const NumericalSolver::StepperType& aStepperType)
-{
-    switch (aStepperType)
+    const auto stepRecorder = [this](const double aTime, const double aStepSize, const bool isAccepted) -> void
+    {
+        this->recordStep(aTime, aStepSize, isAccepted);
+    };
+
+    const double timeStep = getSignedTimeStep(anEndTime - aStartTime);
+
+    // Integrate_adaptive ends exactly at the end time, also with a fixed step stepper
+    const auto integrate = [&](const auto& aStepper) -> void
+    {
+        if (logType_ == NumericalSolver::LogType::LogConstant)
+        {
+            integrate_const(
+                aStepper, augmentedSystemOfEquations, augmentedState, startTime, endTime, timeStep, observer
+            );
+        }
+        else
+        {
+            integrate_adaptive(
+                aStepper, augmentedSystemOfEquations, augmentedState, startTime, endTime, timeStep, observer
+            );
+        }
+    };
+
+    const auto integrateControlled = [&](const auto& anErrorStepper) -> void
+    {
+        typedef controlled_runge_kutta<std::decay_t<decltype(anErrorStepper)>, VariationalErrorChecker>
+            controlled_stepper_type;
+
+        integrate(recordSteps(
+            controlled_stepper_type(VariationalErrorChecker(
+                absoluteTolerance_, relativeTolerance_, stateDimension, aStateTransitionMatrixErrorWeight
+            )),
+            stepRecorder
+        ));
+    };
+
+    switch (stepperType_)
     {
         case NumericalSolver::StepperType::RungeKutta4:
-            return "RungeKutta4";
+            integrate(recordSteps(stepper_type_4<>(), stepRecorder));
+            break;
 
         case NumericalSolver::StepperType::RungeKuttaCashKarp54:
-            return "RungeKuttaCashKarp54";
+            integrateControlled(error_stepper_type_54<>());
+            break;
 
         case NumericalSolver::StepperType::RungeKuttaFehlberg78:
-            return "RungeKuttaFehlberg78";
-
-        case NumericalSolver::StepperType::RungeKuttaDopri5:
-            return "RungeKuttaDopri5";
+            integrateControlled(error_stepper_type_78<>());
+            break;
 
         default:
-            throw ostk::core::error::runtime::Wrong("Stepper Type");
+            integrateControlled(dense_stepper_type_5<>());
+            break;
     }
-}
 
-NumericalSolver NumericalSolver::Undefined()
-{
     return {
-        LogType::NoLog,
-        StepperType::RungeKuttaCashKarp54,
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
+        augmentedState.head(stateDimension),
+        Eigen::Map<const MatrixXd>(augmentedState.data() + stateDimension, stateDimension, stateDimension),
+        endTime
     };
 }
 
-NumericalSolver NumericalSolver::Default()
+template <class State, class SystemOfEquations, class Observer>
+void NumericalSolver::integrateStateDuration(
+    State& aState,
+    const Real& aDurationInSeconds,
+    const SystemOfEquations& aSystemOfEquations,
+    const Observer& anObserver
+)
 {
-    return {
-        NumericalSolver::LogType::NoLog,
-        NumericalSolver::StepperType::RungeKuttaFehlberg78,
-        5.0,
-        1.0e-12,
-        1.0e-12,
+    // Ensure integration starts in the correct direction with the initial time step guess
+    const double adjustedTimeStep = getSignedTimeStep(aDurationInSeconds);
+
+    const auto systemOfEquations =
+        countSystemOfEquationsCalls(aSystemOfEquations, statistics_.systemOfEquationsCallCount);
+
+    const auto stepRecorder = [this](const double aTime, const double aStepSize, const bool isAccepted) -> void
+    {
+        this->recordStep(aTime, aStepSize, isAccepted);
     };
-}
 
-void NumericalSolver::observeNumericalIntegration(const NumericalSolver::StateVector& x, const double t)
-{
-    observedStateVectors_.add({x, t});
+    if (this->isImplicit())
+    {
+        if constexpr (std::is_same_v<State, NumericalSolver::StateVector>)
+        {
+            Array<double> outputTimes = Array<double>::Empty();
 
-    switch (logType_)
+            if (logType_ == NumericalSolver::LogType::LogConstant)
+            {
+                // Observe at multiples of the time step, as integrate_const does
+                const Size outputCount = Size(std::floor(aDurationInSeconds / adjustedTimeStep + 1e-12)) + 1;
+
+                for (Size i = 0; i < outputCount; ++i)
+                {
+                    outputTimes.add(double(i) * adjustedTimeStep);
+                }
+            }
+
+            this->integrateImplicitTime(
+                aState, 0.0, (double)aDurationInSeconds, outputTimes, systemOfEquations, anObserver
+            );
+
+            return;
+        }
+        else
+        {
+            throw ostk::core::error::RuntimeError(
+                "The [{}] stepper type only integrates dynamic size state vectors.",
+                NumericalSolver::StringFromStepperType(stepperType_)
+            );
+        }
+    }
+
+    // Explicit Runge-Kutta steppers are forwarded to their compile-time configured solver, with steps recorded
+
+    const NumericalSolver::ExplicitSolver* explicitSolver = this->accessExplicitSolver();
+
+    if (explicitSolver != nullptr)
     {
-        case NumericalSolver::LogType::LogAdaptive:
-        case NumericalSolver::LogType::LogConstant:
+        const ExplicitStateSolver<State>& explicitStateSolver = *explicitSolver;
+
+        explicitStateSolver.integrateState(
+            aState,
+            0.0,
+            (double)aDurationInSeconds,
+            aSystemOfEquations,
+            statistics_.systemOfEquationsCallCount,
+            anObserver,
+            stepRecorder
+        );
+        return;
+    }
+
+    switch (stepperType_)
+    {
+        case NumericalSolver::StepperType::VelocityVerlet:
+        case NumericalSolver::StepperType::Yoshida4:
         {
-            std::cout.precision(3);
-            std::cout.setf(std::ios::fixed, std::ios::floatfield);
+            // Fixed step steppers: whole steps as RK4, then a partial step of the same method to reach the end time,
+            // as integrate_times does
+            const auto stepper = recordSteps(SymplecticStepper<State>::FromStepperType(stepperType_), stepRecorder);
 
-            std::cout << std::left << std::setw(15) << t;
+            const Size stepCount = integrate_const(
+                stepper, systemOfEquations, aState, (0.0), (double)aDurationInSeconds, adjustedTimeStep, anObserver
+            );
 
-            std::cout.precision(10);
-            std::cout.setf(std::ios::scientific, std::ios::floatfield);
-            for (Size i = 0; i < (Size)x.size(); i++)
+            const double time = double(stepCount) * adjustedTimeStep;
+
+            if (adjustedTimeStep * ((double)aDurationInSeconds - time) > 0.0)
             {
-                std::cout << std::internal << std::setw(16) << x[i] << "     ";
+                auto partialStepper = stepper;
+                partialStepper.do_step(systemOfEquations, aState, time, (double)aDurationInSeconds - time);
+                anObserver(aState, (double)aDurationInSeconds);
             }
-            std::cout << std::endl;
-
-            std::cout.setf(std::ios::fixed, std::ios::floatfield);
 
-            break;
+            return;
         }
 
-        default:
+        case NumericalSolver::StepperType::AdamsBashforthMoulton8:
         {
-            break;
+            // The multistep history requires a constant time step: the end time is reached by a partial RKF78 step
+            // from the last grid step, as in integrateStateTimes
+            const Size stepCount = integrate_const(
+                recordSteps(multistep_stepper_type_8<State>(), stepRecorder),
+                systemOfEquations,
+                aState,
+                (0.0),
+                (double)aDurationInSeconds,
+                adjustedTimeStep,
+                anObserver
+            );
+
+            const double time = double(stepCount) * adjustedTimeStep;
+
+            if (adjustedTimeStep * ((double)aDurationInSeconds - time) > 0.0)
+            {
+                error_stepper_type_78<State> partialStepper;
+                partialStepper.do_step(systemOfEquations, aState, time, (double)aDurationInSeconds - time);
+                anObserver(aState, (double)aDurationInSeconds);
+            }
+
+            return;
         }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type");
     }
-}
 
-double NumericalSolver::getSignedTimeStep(const Real& aReal) const
-{
-    const Real durationSign = (aReal > 0.0) - (aReal < 0.0);
-    return timeStep_ * durationSign;
+    throw ostk::core::error::RuntimeError("No State Vector returned from Odeint.");
 }
 
+template NumericalSolver::FixedSolution<6> NumericalSolver::integrateDuration<6>(
+    const FixedStateVector<6>&, const Real&, const FixedSystemOfEquationsWrapper<6>&
+);
+template NumericalSolver::FixedSolution<7> NumericalSolver::integrateDuration<7>(
+    const FixedStateVector<7>&, const Real&, const FixedSystemOfEquationsWrapper<7>&
+);
+template NumericalSolver::FixedSolution<13> NumericalSolver::integrateDuration<13>(
+    const FixedStateVector<13>&, const Real&, const FixedSystemOfEquationsWrapper<13>&
+);
+template NumericalSolver::FixedSolution<42> NumericalSolver::integrateDuration<42>(
+    const FixedStateVector<42>&, const Real&, const FixedSystemOfEquationsWrapper<42>&
+);
+
+template NumericalSolver::FixedSolution<6> NumericalSolver::integrateTime<6>(
+    const FixedStateVector<6>&, const Real&, const Real&, const FixedSystemOfEquationsWrapper<6>&
+);
+template NumericalSolver::FixedSolution<7> NumericalSolver::integrateTime<7>(
+    const FixedStateVector<7>&, const Real&, const Real&, const FixedSystemOfEquationsWrapper<7>&
+);
+template NumericalSolver::FixedSolution<13> NumericalSolver::integrateTime<13>(
+    const FixedStateVector<13>&, const Real&, const Real&, const FixedSystemOfEquationsWrapper<13>&
+);
+template NumericalSolver::FixedSolution<42> NumericalSolver::integrateTime<42>(
+    const FixedStateVector<42>&, const Real&, const Real&, const FixedSystemOfEquationsWrapper<42>&
+);
+
 }  // namespace solver
 }  // namespace mathematics
 }  // namespace ostk
@@ -0,0 +1,312 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Solver/Parareal.hpp>
+#include <OpenSpaceToolkit/Mathematics/Utility/ThreadPool.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace solver
+{
+
+using ostk::mathematics::utility::ThreadPool;
+
+Parareal::Parareal(
+    const NumericalSolver& aCoarseSolver,
+    const NumericalSolver& aFineSolver,
+    const Size& aSliceCount,
+    const Real& aTolerance,
+    const Size& aMaximumIterationCount,
+    const Size& aThreadCount
+)
+    : coarseSolver_(aCoarseSolver),
+      fineSolver_(aFineSolver),
+      sliceCount_(aSliceCount),
+      tolerance_(aTolerance),
+      maximumIterationCount_(aMaximumIterationCount),
+      threadCount_(aThreadCount),
+      statistics_()
+{
+    if (tolerance_.isDefined() && (tolerance_ < 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Parareal& aParareal)
+{
+    aParareal.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool Parareal::isDefined() const
+{
+    return coarseSolver_.isDefined() && fineSolver_.isDefined() && (sliceCount_ > 0) && tolerance_.isDefined() &&
+           (maximumIterationCount_ > 0);
+}
+
+void Parareal::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Parareal") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Coarse stepper type:"
+        << (coarseSolver_.isDefined() ? NumericalSolver::StringFromStepperType(coarseSolver_.getStepperType())
+                                      : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Fine stepper type:"
+        << (fineSolver_.isDefined() ? NumericalSolver::StringFromStepperType(fineSolver_.getStepperType())
+                                    : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Slice count:" << std::to_string(sliceCount_);
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Tolerance:" << (tolerance_.isDefined() ? tolerance_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Maximum iteration count:" << std::to_string(maximumIterationCount_);
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Size Parareal::getSliceCount() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Parareal");
+    }
+
+    return sliceCount_;
+}
+
+Real Parareal::getTolerance() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Parareal");
+    }
+
+    return tolerance_;
+}
+
+Size Parareal::getMaximumIterationCount() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Parareal");
+    }
+
+    return maximumIterationCount_;
+}
+
+Parareal::Statistics Parareal::getStatistics() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Parareal");
+    }
+
+    return statistics_;
+}
+
+NumericalSolver::Solution Parareal::integrateTime(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aStartTime,
+    const Real& anEndTime,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Parareal");
+    }
+
+    if ((!aStartTime.isDefined()) || (!anEndTime.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Time");
+    }
+
+    const std::chrono::steady_clock::time_point startInstant = std::chrono::steady_clock::now();
+
+    statistics_ = {};
+
+    if (anEndTime == aStartTime)
+    {
+        statistics_.isConverged = true;
+        statistics_.wallTime = 0.0;
+
+        return {anInitialStateVector, aStartTime};
+    }
+
+    // Slice boundary times, the last one being exactly the end time
+
+    const double startTime = aStartTime;
+    const double endTime = anEndTime;
+
+    std::vector<double> sliceTimes(sliceCount_ + 1);
+
+    for (Size sliceIndex = 0; sliceIndex < sliceCount_; ++sliceIndex)
+    {
+        sliceTimes[sliceIndex] = startTime + (endTime - startTime) * double(sliceIndex) / double(sliceCount_);
+    }
+
+    sliceTimes[sliceCount_] = endTime;
+
+    // Slices are integrated over their duration, the system of equations being called at the slice times. The time
+    // array path ends on the slice end time with a partial step, whatever the (coarse) time step.
+
+    const auto propagate = [&sliceTimes, &aSystemOfEquations](
+                               NumericalSolver& aNumericalSolver,
+                               const NumericalSolver::StateVector& aStateVector,
+                               const Size aSliceIndex
+                           ) -> NumericalSolver::StateVector
+    {
+        const double sliceStartTime = sliceTimes[aSliceIndex];
+
+        const NumericalSolver::SystemOfEquationsWrapper sliceSystemOfEquations =
+            [&aSystemOfEquations, sliceStartTime](
+                const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+            ) -> void
+        {
+            aSystemOfEquations(x, dxdt, sliceStartTime + t);
+        };
+
+        return aNumericalSolver
+            .integrateTime(
+                aStateVector,
+                0.0,
+                Array<Real>({sliceTimes[aSliceIndex + 1] - sliceStartTime}),
+                sliceSystemOfEquations
+            )
+            .accessFirst()
+            .first;
+    };
+
+    // Slice start states, and coarse and fine propagations of the previous slice start states to the slice ends
+
+    std::vector<NumericalSolver::StateVector> states(sliceCount_ + 1);
+    std::vector<NumericalSolver::StateVector> coarseStates(sliceCount_ + 1);
+    std::vector<NumericalSolver::StateVector> fineStates(sliceCount_ + 1);
+
+    states[0] = anInitialStateVector;
+
+    for (Size sliceIndex = 0; sliceIndex < sliceCount_; ++sliceIndex)
+    {
+        coarseStates[sliceIndex + 1] = propagate(coarseSolver_, states[sliceIndex], sliceIndex);
+        states[sliceIndex + 1] = coarseStates[sliceIndex + 1];
+    }
+
+    // Fine propagation of the slices from a first slice on, in parallel, on threads started once for all iterations:
+    // each thread owns a copy of the fine solver, without its observer and trace hook, and slices are pulled from a
+    // shared counter
+
+    const Size threadCount =
+        std::min(sliceCount_, (threadCount_ == 0) ? ThreadPool::DefaultThreadCount() : threadCount_);
+
+    NumericalSolver workerFineSolver = fineSolver_;
+    workerFineSolver.setStateObserver(nullptr);
+    workerFineSolver.setStepTraceHook(nullptr);
+
+    std::vector<NumericalSolver> workerFineSolvers(threadCount, workerFineSolver);
+    std::vector<double> fineSliceTimes(sliceCount_, 0.0);
+
+    ThreadPool threadPool(threadCount);
+
+    const auto propagateFineSlices = [&](const Size aFirstSliceIndex) -> void
+    {
+        threadPool.run(
+            sliceCount_ - aFirstSliceIndex,
+            [&](const Size& aTaskIndex, const Size& aThreadIndex) -> void
+            {
+                const Size sliceIndex = aFirstSliceIndex + aTaskIndex;
+
+                const std::chrono::steady_clock::time_point sliceStartInstant = std::chrono::steady_clock::now();
+
+                fineStates[sliceIndex + 1] = propagate(workerFineSolvers[aThreadIndex], states[sliceIndex], sliceIndex);
+
+                fineSliceTimes[sliceIndex] =
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - sliceStartInstant).count();
+            }
+        );
+    };
+
+    // After k iterations, the first k slice start states are those of the sequential fine integration, so that only
+    // the following slices are propagated again
+
+    for (Size iterationIndex = 0; iterationIndex < std::min(maximumIterationCount_, sliceCount_); ++iterationIndex)
+    {
+        propagateFineSlices(iterationIndex);
+
+        if (iterationIndex == 0)
+        {
+            double serialFineTime = 0.0;
+
+            for (const double fineSliceTime : fineSliceTimes)
+            {
+                serialFineTime += fineSliceTime;
+            }
+
+            statistics_.serialFineTime = serialFineTime;
+        }
+
+        double correction = 0.0;
+
+        for (Size sliceIndex = iterationIndex; sliceIndex < sliceCount_; ++sliceIndex)
+        {
+            // The first propagated slice starts from an unchanged state, whose coarse propagation is known
+            const NumericalSolver::StateVector coarseState =
+                (sliceIndex == iterationIndex) ? coarseStates[sliceIndex + 1]
+                                               : propagate(coarseSolver_, states[sliceIndex], sliceIndex);
+
+            NumericalSolver::StateVector state =
+                coarseState + fineStates[sliceIndex + 1] - coarseStates[sliceIndex + 1];
+
+            correction = std::max(
+                correction,
+                (state - states[sliceIndex + 1]).lpNorm<Eigen::Infinity>() /
+                    std::max(1.0, state.lpNorm<Eigen::Infinity>())
+            );
+
+            states[sliceIndex + 1] = std::move(state);
+            coarseStates[sliceIndex + 1] = coarseState;
+        }
+
+        statistics_.iterationCount = iterationIndex + 1;
+        statistics_.correction = correction;
+
+        if ((correction <= tolerance_) || (statistics_.iterationCount == sliceCount_))
+        {
+            statistics_.isConverged = true;
+            break;
+        }
+    }
+
+    statistics_.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startInstant).count();
+    statistics_.speedup = statistics_.serialFineTime / statistics_.wallTime;
+
+    return {states[sliceCount_], anEndTime};
+}
+
+NumericalSolver::Solution Parareal::integrateDuration(
+    const NumericalSolver::StateVector& anInitialStateVector,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    return this->integrateTime(anInitialStateVector, 0.0, aDurationInSeconds, aSystemOfEquations);
+}
+
+Parareal Parareal::Undefined()
+{
+    return {NumericalSolver::Undefined(), NumericalSolver::Undefined(), 0, Real::Undefined(), 0};
+}
+
+}  // namespace solver
+}  // namespace mathematics
+}  // namespace ostk
@@ -0,0 +1,166 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Utility/ThreadPool.hpp>
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace utility
+{
+
+ThreadPool::ThreadPool(const Size& aThreadCount)
+    : threadCount_(aThreadCount),
+      workers_(),
+      mutex_(),
+      startCondition_(),
+      endCondition_(),
+      task_(nullptr),
+      taskCount_(0),
+      nextTaskIndex_(0),
+      exceptions_(),
+      batchIndex_(0),
+      runningWorkerCount_(0),
+      isStopping_(false)
+{
+    if (threadCount_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    workers_.reserve(threadCount_ - 1);
+
+    for (Size threadIndex = 1; threadIndex < threadCount_; ++threadIndex)
+    {
+        workers_.emplace_back(&ThreadPool::work, this, threadIndex);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        isStopping_ = true;
+    }
+
+    startCondition_.notify_all();
+
+    for (std::thread& aWorker : workers_)
+    {
+        aWorker.join();
+    }
+}
+
+Size ThreadPool::getThreadCount() const
+{
+    return threadCount_;
+}
+
+void ThreadPool::run(const Size& aTaskCount, const ThreadPool::Task& aTask)
+{
+    if (aTaskCount == 0)
+    {
+        return;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+
+        task_ = &aTask;
+        taskCount_ = aTaskCount;
+        nextTaskIndex_ = 0;
+        exceptions_.assign(aTaskCount, nullptr);
+        runningWorkerCount_ = workers_.size();
+        ++batchIndex_;
+    }
+
+    startCondition_.notify_all();
+
+    this->runTasks(0);  // The calling thread takes part in the work
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        endCondition_.wait(
+            lock,
+            [this]() -> bool
+            {
+                return runningWorkerCount_ == 0;
+            }
+        );
+
+        task_ = nullptr;
+    }
+
+    for (const std::exception_ptr& anException : exceptions_)
+    {
+        if (anException != nullptr)
+        {
+            std::rethrow_exception(anException);
+        }
+    }
+}
+
+Size ThreadPool::DefaultThreadCount()
+{
+    return std::max(Size(1), Size(std::thread::hardware_concurrency()));
+}
+
+void ThreadPool::work(const Size aThreadIndex)
+{
+    Size batchIndex = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            startCondition_.wait(
+                lock,
+                [this, batchIndex]() -> bool
+                {
+                    return isStopping_ || (batchIndex_ != batchIndex);
+                }
+            );
+
+            if (isStopping_)
+            {
+                return;
+            }
+
+            batchIndex = batchIndex_;
+        }
+
+        this->runTasks(aThreadIndex);
+
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            --runningWorkerCount_;
+        }
+
+        endCondition_.notify_one();
+    }
+}
+
+void ThreadPool::runTasks(const Size aThreadIndex)
+{
+    for (Size taskIndex = nextTaskIndex_++; taskIndex < taskCount_; taskIndex = nextTaskIndex_++)
+    {
+        try
+        {
+            (*task_)(taskIndex, aThreadIndex);
+        }
+        catch (...)
+        {
+            exceptions_[taskIndex] = std::current_exception();
+        }
+    }
+}
+
+}  // namespace utility
+}  // namespace mathematics
+}  // namespace ostk
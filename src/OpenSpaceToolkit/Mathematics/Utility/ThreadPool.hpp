@@ -0,0 +1,96 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Mathematics_Utility_ThreadPool__
+#define __OpenSpaceToolkit_Mathematics_Utility_ThreadPool__
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+// Internal to the library (not installed)
+
+namespace ostk
+{
+namespace mathematics
+{
+namespace utility
+{
+
+using ostk::core::type::Size;
+
+/// @brief Pool of threads running batches of independent tasks
+///
+/// The worker threads are started at construction and kept waiting between batches, until destruction. The tasks of
+/// a batch are pulled from a shared counter by the worker threads and the calling thread, which takes part in the
+/// work.
+class ThreadPool
+{
+   public:
+    /// @brief A task, called as (task index, thread index), the calling thread having index 0
+    typedef std::function<void(const Size& aTaskIndex, const Size& aThreadIndex)> Task;
+
+    /// @brief Constructor
+    ///
+    /// @param aThreadCount A number of threads, the calling thread included
+    explicit ThreadPool(const Size& aThreadCount);
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// @brief Destructor, joining the worker threads
+    ~ThreadPool();
+
+    /// @brief Get the number of threads, the calling thread included
+    ///
+    /// @return Number of threads
+    Size getThreadCount() const;
+
+    /// @brief Run a batch of tasks, and wait for all of them to complete
+    ///
+    /// If tasks fail, the exception of the first failing task (in task order) is rethrown once all tasks have run, so
+    /// that errors are reported deterministically whatever the number of threads.
+    ///
+    /// @param aTaskCount A number of tasks
+    /// @param aTask A task, called once per task index
+    ///
+    /// @warning Batches must not be run concurrently on the same pool
+    void run(const Size& aTaskCount, const Task& aTask);
+
+    /// @brief Get the default number of threads, that of the hardware (at least one)
+    ///
+    /// @return Number of threads
+    static Size DefaultThreadCount();
+
+   private:
+    Size threadCount_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable startCondition_;
+    std::condition_variable endCondition_;
+
+    const Task* task_;
+    Size taskCount_;
+    std::atomic<Size> nextTaskIndex_;
+    std::vector<std::exception_ptr> exceptions_;
+    Size batchIndex_;
+    Size runningWorkerCount_;
+    bool isStopping_;
+
+    void work(const Size aThreadIndex);
+
+    void runTasks(const Size aThreadIndex);
+};
+
+}  // namespace utility
+}  // namespace mathematics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,266 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/ChebyshevSeries.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::ChebyshevSeries;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+class OpenSpaceToolkit_Mathematics_ChebyshevSeries : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        // On [0, 2] (u = x - 1): y0 = 1 + 2 T1 + 3 T2 = -2 + 2 u + 6 u^2, and y1 = T3 = 4 u^3 - 3 u
+        // On [2, 3] (u = 2 x - 5): y0 = 1 - T1, and y1 = T0
+
+        breakpoints_ = VectorXd(3);
+        breakpoints_ << 0.0, 2.0, 3.0;
+
+        MatrixXd coefficients0(4, 2);
+        coefficients0 << 1.0, 0.0, 2.0, 0.0, 3.0, 0.0, 0.0, 1.0;
+
+        MatrixXd coefficients1(2, 2);
+        coefficients1 << 1.0, 1.0, -1.0, 0.0;
+
+        coefficients_ = {coefficients0, coefficients1};
+
+        x_ = VectorXd::LinSpaced(2001, 0.0, 10.0);
+
+        y_ = MatrixXd(x_.size(), 2);
+        y_.col(0) = x_.array().sin();
+        y_.col(1) = (0.3 * x_.array()).exp();
+    }
+
+    VectorXd breakpoints_;
+    Array<MatrixXd> coefficients_ = Array<MatrixXd>::Empty();
+
+    VectorXd x_;
+    MatrixXd y_;
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_ChebyshevSeries, Constructor)
+{
+    {
+        EXPECT_NO_THROW(ChebyshevSeries(breakpoints_, coefficients_));
+    }
+
+    {
+        EXPECT_THROW(ChebyshevSeries(breakpoints_.head(2), coefficients_), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            ChebyshevSeries(breakpoints_.head(1), Array<MatrixXd>::Empty()), ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        VectorXd breakpoints = breakpoints_;
+        breakpoints(1) = breakpoints(2);
+
+        EXPECT_THROW(ChebyshevSeries(breakpoints, coefficients_), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        Array<MatrixXd> coefficients = coefficients_;
+        coefficients[1] = MatrixXd::Ones(2, 3);
+
+        EXPECT_THROW(ChebyshevSeries(breakpoints_, coefficients), ostk::core::error::runtime::Wrong);
+
+        coefficients[1] = MatrixXd(0, 2);
+
+        EXPECT_THROW(ChebyshevSeries(breakpoints_, coefficients), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_ChebyshevSeries, Getters)
+{
+    const ChebyshevSeries chebyshevSeries = {breakpoints_, coefficients_};
+
+    EXPECT_EQ(2, chebyshevSeries.getSegmentCount());
+    EXPECT_EQ(2, chebyshevSeries.getComponentCount());
+    EXPECT_EQ(breakpoints_, chebyshevSeries.getBreakpoints());
+
+    ASSERT_EQ(2, chebyshevSeries.getCoefficients().getSize());
+    EXPECT_EQ(coefficients_[0], chebyshevSeries.getCoefficients()[0]);
+    EXPECT_EQ(coefficients_[1], chebyshevSeries.getCoefficients()[1]);
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_ChebyshevSeries, Evaluate)
+{
+    const ChebyshevSeries chebyshevSeries = {breakpoints_, coefficients_};
+
+    const auto expectedValue = [](const double& x) -> VectorXd
+    {
+        VectorXd value(2);
+
+        if (x < 2.0)
+        {
+            const double u = x - 1.0;
+            value << -2.0 + 2.0 * u + 6.0 * u * u, 4.0 * u * u * u - 3.0 * u;
+        }
+        else
+        {
+            const double u = 2.0 * x - 5.0;
+            value << 1.0 - u, 1.0;
+        }
+
+        return value;
+    };
+
+    const VectorXd queryX = VectorXd::LinSpaced(31, 0.0, 3.0);
+
+    {
+        const MatrixXd values = chebyshevSeries.evaluate(queryX);
+
+        ASSERT_EQ(queryX.size(), values.rows());
+        ASSERT_EQ(2, values.cols());
+
+        for (Eigen::Index i = 0; i < queryX.size(); ++i)
+        {
+            EXPECT_TRUE(values.row(i).transpose().isApprox(expectedValue(queryX(i)), 1e-14));
+            EXPECT_EQ(VectorXd(values.row(i).transpose()), chebyshevSeries.evaluate(queryX(i)));
+        }
+    }
+
+    {
+        EXPECT_THROW(chebyshevSeries.evaluate(-0.1), ostk::core::error::RuntimeError);
+        EXPECT_THROW(chebyshevSeries.evaluate(3.1), ostk::core::error::RuntimeError);
+        EXPECT_THROW(chebyshevSeries.evaluate(std::nan("")), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_ChebyshevSeries, EvaluateDerivative)
+{
+    const ChebyshevSeries chebyshevSeries = {breakpoints_, coefficients_};
+
+    const VectorXd queryX = VectorXd::LinSpaced(21, 0.0, 1.99);
+
+    {
+        EXPECT_EQ(chebyshevSeries.evaluate(queryX), chebyshevSeries.evaluateDerivative(queryX, 0));
+    }
+
+    for (Eigen::Index i = 0; i < queryX.size(); ++i)
+    {
+        const double u = queryX(i) - 1.0;
+
+        const VectorXd derivative = chebyshevSeries.evaluateDerivative(queryX(i));
+        const VectorXd secondDerivative = chebyshevSeries.evaluateDerivative(queryX(i), 2);
+        const VectorXd thirdDerivative = chebyshevSeries.evaluateDerivative(queryX(i), 3);
+        const VectorXd fourthDerivative = chebyshevSeries.evaluateDerivative(queryX(i), 4);
+
+        EXPECT_NEAR(2.0 + 12.0 * u, derivative(0), 1e-13);
+        EXPECT_NEAR(12.0 * u * u - 3.0, derivative(1), 1e-13);
+        EXPECT_NEAR(12.0, secondDerivative(0), 1e-13);
+        EXPECT_NEAR(24.0 * u, secondDerivative(1), 1e-13);
+        EXPECT_NEAR(0.0, thirdDerivative(0), 1e-13);
+        EXPECT_NEAR(24.0, thirdDerivative(1), 1e-13);
+        EXPECT_EQ(VectorXd::Zero(2), fourthDerivative);
+    }
+
+    // Derivatives are scaled by the length of the segment
+
+    {
+        VectorXd expectedDerivative(2);
+        expectedDerivative << -2.0, 0.0;
+
+        EXPECT_TRUE(chebyshevSeries.evaluateDerivative(2.5).isApprox(expectedDerivative, 1e-15));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_ChebyshevSeries, Fit)
+{
+    // Polynomials of the degree of the series are reproduced
+
+    {
+        MatrixXd y(x_.size(), 1);
+        y.col(0) = (1.0 + x_.array() * (0.5 + x_.array() * (-0.2 + 0.03 * x_.array()))).matrix();
+
+        const ChebyshevSeries chebyshevSeries = ChebyshevSeries::Fit(x_, y, 3, 3);
+
+        EXPECT_EQ(3, chebyshevSeries.getSegmentCount());
+        EXPECT_EQ(1, chebyshevSeries.getComponentCount());
+        EXPECT_EQ(0.0, chebyshevSeries.getBreakpoints()(0));
+        EXPECT_EQ(10.0, chebyshevSeries.getBreakpoints()(3));
+
+        EXPECT_LT((chebyshevSeries.evaluate(x_) - y).cwiseAbs().maxCoeff(), 1e-12);
+    }
+
+    // Smooth functions, with derivatives
+
+    {
+        const ChebyshevSeries chebyshevSeries = ChebyshevSeries::Fit(x_, y_, 14, 4);
+
+        EXPECT_EQ(4, chebyshevSeries.getSegmentCount());
+        EXPECT_EQ(2, chebyshevSeries.getComponentCount());
+
+        const VectorXd queryX = VectorXd::LinSpaced(777, 0.0, 10.0);
+
+        MatrixXd expectedDerivatives(queryX.size(), 2);
+        expectedDerivatives.col(0) = queryX.array().cos();
+        expectedDerivatives.col(1) = 0.3 * (0.3 * queryX.array()).exp();
+
+        EXPECT_LT((chebyshevSeries.evaluate(x_) - y_).cwiseAbs().maxCoeff(), 1e-10);
+        EXPECT_LT((chebyshevSeries.evaluateDerivative(queryX) - expectedDerivatives).cwiseAbs().maxCoeff(), 1e-8);
+    }
+
+    {
+        EXPECT_THROW(ChebyshevSeries::Fit(x_, y_.topRows(10), 3), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(ChebyshevSeries::Fit(x_.head(1), y_.topRows(1), 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(ChebyshevSeries::Fit(x_.reverse(), y_, 3), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(ChebyshevSeries::Fit(x_, y_, 3, 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(ChebyshevSeries::Fit(x_, y_, 3, 1000), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_ChebyshevSeries, FitAdaptive)
+{
+    for (const double tolerance : {1e-3, 1e-6, 1e-9})
+    {
+        const ChebyshevSeries chebyshevSeries = ChebyshevSeries::FitAdaptive(x_, y_, 8, tolerance);
+
+        EXPECT_LE((chebyshevSeries.evaluate(x_) - y_).cwiseAbs().maxCoeff(), tolerance);
+
+        const VectorXd breakpoints = chebyshevSeries.getBreakpoints();
+
+        EXPECT_EQ(x_(0), breakpoints(0));
+        EXPECT_EQ(x_(x_.size() - 1), breakpoints(breakpoints.size() - 1));
+
+        // Far fewer coefficients than samples
+
+        EXPECT_LT(9 * chebyshevSeries.getSegmentCount(), Size(x_.size() / 10));
+    }
+
+    // Tighter tolerances need more segments
+
+    {
+        EXPECT_LT(
+            ChebyshevSeries::FitAdaptive(x_, y_, 8, 1e-3).getSegmentCount(),
+            ChebyshevSeries::FitAdaptive(x_, y_, 8, 1e-9).getSegmentCount()
+        );
+    }
+
+    // Segments are not split below the number of samples needed by the degree
+
+    {
+        const ChebyshevSeries chebyshevSeries = ChebyshevSeries::FitAdaptive(x_.head(16), y_.topRows(16), 8, 1e-30);
+
+        EXPECT_EQ(1, chebyshevSeries.getSegmentCount());
+    }
+
+    {
+        EXPECT_THROW(ChebyshevSeries::FitAdaptive(x_, y_, 8, Real::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(ChebyshevSeries::FitAdaptive(x_, y_, 8, 0.0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(ChebyshevSeries::FitAdaptive(x_.head(5), y_.topRows(5), 8, 1e-3), ostk::core::error::RuntimeError);
+    }
+}
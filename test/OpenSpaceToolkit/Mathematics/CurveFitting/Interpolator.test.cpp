@@ -2,8 +2,10 @@
 
 #include <gmock/gmock.h>
 
+#include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -12,8 +14,10 @@
 
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 class MockInterpolator : public Interpolator
@@ -24,8 +28,14 @@ class MockInterpolator : public Interpolator
     {
     }
 
+    using Interpolator::evaluate;
+
     MOCK_METHOD(VectorXd, evaluate, (const VectorXd&), (const, override));
     MOCK_METHOD(double, evaluate, (const double&), (const, override));
+
+    using Interpolator::evaluateDerivative;
+
+    MOCK_METHOD(double, evaluateDerivative, (const double&, const Size&), (const, override));
 };
 
 class OpenSpaceToolkit_Mathematics_Interpolator : public ::testing::Test
@@ -45,6 +55,170 @@ TEST_F(OpenSpaceToolkit_Mathematics_Interpolator, GetInterpolationType)
     EXPECT_EQ(defaulttype_, defaultInterpolator_.getInterpolationType());
 }
 
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator, EvaluateDerivative)
+{
+    const MockInterpolator mockInterpolator(defaulttype_);
+
+    EXPECT_CALL(mockInterpolator, evaluateDerivative(1.0, Size(2))).WillOnce(::testing::Return(4.0));
+    EXPECT_CALL(mockInterpolator, evaluateDerivative(2.0, Size(2))).WillOnce(::testing::Return(5.0));
+
+    VectorXd x(2);
+    x << 1.0, 2.0;
+
+    VectorXd expectedDerivatives(2);
+    expectedDerivatives << 4.0, 5.0;
+
+    EXPECT_EQ(expectedDerivatives, mockInterpolator.evaluateDerivative(x, 2));
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator, EvaluateWithDerivatives)
+{
+    const ::testing::NiceMock<MockInterpolator> mockInterpolator(defaulttype_);
+
+    ON_CALL(mockInterpolator, evaluate(::testing::An<const double&>()))
+        .WillByDefault(
+            [](const double& aQueryValue) -> double
+            {
+                return aQueryValue * aQueryValue;
+            }
+        );
+    ON_CALL(mockInterpolator, evaluateDerivative(::testing::An<const double&>(), ::testing::_))
+        .WillByDefault(
+            [](const double& aQueryValue, const Size& anOrder) -> double
+            {
+                return (anOrder == 1) ? 2.0 * aQueryValue : 2.0;
+            }
+        );
+
+    {
+        VectorXd expectedValueAndDerivatives(3);
+        expectedValueAndDerivatives << 9.0, 6.0, 2.0;
+
+        EXPECT_EQ(expectedValueAndDerivatives, mockInterpolator.evaluateWithDerivatives(3.0, 2));
+    }
+
+    {
+        VectorXd x(2);
+        x << 1.0, 3.0;
+
+        MatrixXd expectedValuesAndDerivatives(2, 2);
+        expectedValuesAndDerivatives << 1.0, 2.0, 9.0, 6.0;
+
+        EXPECT_EQ(expectedValuesAndDerivatives, mockInterpolator.evaluateWithDerivatives(x, 1));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator, EvaluateBuffer)
+{
+    const ::testing::NiceMock<MockInterpolator> mockInterpolator(defaulttype_);
+
+    ON_CALL(mockInterpolator, evaluate(::testing::An<const double&>()))
+        .WillByDefault(
+            [](const double& aQueryValue) -> double
+            {
+                return 2.0 * aQueryValue;
+            }
+        );
+
+    VectorXd x(3);
+    x << 1.0, 2.0, 3.0;
+
+    {
+        VectorXd y(3);
+
+        mockInterpolator.evaluate(x, y);
+
+        EXPECT_EQ(VectorXd(2.0 * x), y);
+    }
+
+    {
+        VectorXd y(2);
+
+        EXPECT_THROW(mockInterpolator.evaluate(x, y), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator, EvaluateParallel)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 5.0, 6.0, 9.0, 15.0;
+
+    const Size queryCount = 2 * Interpolator::ParallelEvaluationThreshold + 123;
+
+    // Unsorted x values, in and out of the range of the interpolators
+
+    VectorXd queryX = VectorXd::LinSpaced(queryCount, -1.0, 6.0);
+    std::swap(queryX(10), queryX(queryCount - 10));
+
+    for (const auto type :
+         {Interpolator::Type::BarycentricRational,
+          Interpolator::Type::CubicSpline,
+          Interpolator::Type::Lagrange,
+          Interpolator::Type::Linear,
+          Interpolator::Type::NonUniformCubicSpline,
+          Interpolator::Type::Streaming})
+    {
+        const Shared<const Interpolator> interpolatorSPtr = Interpolator::GenerateInterpolator(type, x, y);
+
+        const VectorXd expectedY = interpolatorSPtr->evaluate(queryX);
+
+        for (const Size threadCount : {0, 1, 2, 4})
+        {
+            EXPECT_EQ(expectedY, interpolatorSPtr->evaluateParallel(queryX, threadCount));
+
+            VectorXd values(queryCount);
+            interpolatorSPtr->evaluateParallel(queryX, values, threadCount);
+
+            EXPECT_EQ(expectedY, values);
+        }
+
+        {
+            VectorXd values = VectorXd::Zero(queryCount + 2);
+            interpolatorSPtr->evaluateParallel(queryX, values.segment(1, queryCount), 4);
+
+            EXPECT_EQ(expectedY, values.segment(1, queryCount));
+            EXPECT_EQ(0.0, values(0));
+            EXPECT_EQ(0.0, values(queryCount + 1));
+        }
+
+        {
+            EXPECT_EQ(
+                interpolatorSPtr->evaluate(queryX.head(100)), interpolatorSPtr->evaluateParallel(queryX.head(100), 4)
+            );
+        }
+
+        {
+            VectorXd values(queryCount - 1);
+
+            EXPECT_THROW(interpolatorSPtr->evaluateParallel(queryX, values), ostk::core::error::runtime::Wrong);
+        }
+    }
+
+    // Failures in worker threads are rethrown
+
+    {
+        const ::testing::NiceMock<MockInterpolator> mockInterpolator(defaulttype_);
+
+        ON_CALL(mockInterpolator, evaluate(::testing::An<const double&>()))
+            .WillByDefault(
+                [](const double& aQueryValue) -> double
+                {
+                    if (aQueryValue > 5.0)
+                    {
+                        throw ostk::core::error::RuntimeError("Out of range.");
+                    }
+
+                    return aQueryValue;
+                }
+            );
+
+        EXPECT_THROW(mockInterpolator.evaluateParallel(queryX, 4), ostk::core::error::RuntimeError);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Mathematics_Interpolator, GenerateInterpolator)
 {
     VectorXd x(6);
@@ -67,10 +241,41 @@ TEST_F(OpenSpaceToolkit_Mathematics_Interpolator, GenerateInterpolator)
         EXPECT_EQ(Interpolator::Type::CubicSpline, interpolatorSPtr->getInterpolationType());
     }
 
+    {
+        const Shared<const Interpolator> interpolatorSPtr =
+            Interpolator::GenerateInterpolator(Interpolator::Type::Lagrange, x, y);
+        EXPECT_TRUE(interpolatorSPtr != nullptr);
+        EXPECT_EQ(Interpolator::Type::Lagrange, interpolatorSPtr->getInterpolationType());
+    }
+
     {
         const Shared<const Interpolator> interpolatorSPtr =
             Interpolator::GenerateInterpolator(Interpolator::Type::Linear, x, y);
         EXPECT_TRUE(interpolatorSPtr != nullptr);
         EXPECT_EQ(Interpolator::Type::Linear, interpolatorSPtr->getInterpolationType());
     }
+
+    {
+        const Shared<const Interpolator> interpolatorSPtr =
+            Interpolator::GenerateInterpolator(Interpolator::Type::NonUniformCubicSpline, x, y);
+        EXPECT_TRUE(interpolatorSPtr != nullptr);
+        EXPECT_EQ(Interpolator::Type::NonUniformCubicSpline, interpolatorSPtr->getInterpolationType());
+    }
+
+    {
+        const Shared<const Interpolator> interpolatorSPtr =
+            Interpolator::GenerateInterpolator(Interpolator::Type::Streaming, x, y);
+        EXPECT_TRUE(interpolatorSPtr != nullptr);
+        EXPECT_EQ(Interpolator::Type::Streaming, interpolatorSPtr->getInterpolationType());
+    }
+
+    {
+        EXPECT_THROW(
+            Interpolator::GenerateInterpolator(Interpolator::Type::Hermite, x, y), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Interpolator::GenerateInterpolator(Interpolator::Type::LagrangeHermite, x, y),
+            ostk::core::error::runtime::Wrong
+        );
+    }
 }
@@ -2,6 +2,7 @@
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
@@ -83,3 +84,29 @@ TEST(OpenSpaceToolkit_Mathematics_Interpolator_BarycentricRational, Evaluate)
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_BarycentricRational, EvaluateDerivative)
+{
+    const VectorXd x = VectorXd::LinSpaced(50, 0.0, 2.0 * M_PI);
+    const VectorXd y = x.array().sin().matrix();
+
+    const BarycentricRational interpolator(x, y);
+
+    const VectorXd queryX = VectorXd::LinSpaced(37, 0.1, 6.1);
+
+    {
+        EXPECT_EQ(interpolator.evaluate(queryX), interpolator.evaluateDerivative(queryX, 0));
+        EXPECT_TRUE(interpolator.evaluateDerivative(queryX).isApprox(queryX.array().cos().matrix(), 1e-4));
+    }
+
+    {
+        const MatrixXd valuesAndDerivatives = interpolator.evaluateWithDerivatives(queryX, 1);
+
+        EXPECT_EQ(interpolator.evaluate(queryX), valuesAndDerivatives.col(0));
+        EXPECT_EQ(interpolator.evaluateDerivative(queryX), valuesAndDerivatives.col(1));
+    }
+
+    {
+        EXPECT_THROW(interpolator.evaluateDerivative(1.0, 2), ostk::core::error::runtime::Wrong);
+    }
+}
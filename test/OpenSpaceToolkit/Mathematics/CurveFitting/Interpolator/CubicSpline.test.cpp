@@ -2,6 +2,7 @@
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
@@ -93,3 +94,31 @@ TEST(OpenSpaceToolkit_Mathematics_Interpolator_CubicSpline, Evaluate)
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_CubicSpline, EvaluateDerivative)
+{
+    const VectorXd x = VectorXd::LinSpaced(200, 0.0, 2.0 * M_PI);
+    const VectorXd y = x.array().sin().matrix();
+
+    const CubicSpline interpolator(x, y);
+
+    const VectorXd queryX = VectorXd::LinSpaced(37, 0.1, 6.1);
+
+    {
+        EXPECT_EQ(interpolator.evaluate(queryX), interpolator.evaluateDerivative(queryX, 0));
+        EXPECT_TRUE(interpolator.evaluateDerivative(queryX).isApprox(queryX.array().cos().matrix(), 1e-4));
+        EXPECT_TRUE(interpolator.evaluateDerivative(queryX, 2).isApprox(-queryX.array().sin().matrix(), 1e-3));
+    }
+
+    {
+        const VectorXd valueAndDerivatives = interpolator.evaluateWithDerivatives(1.0, 2);
+
+        EXPECT_EQ(interpolator.evaluate(1.0), valueAndDerivatives(0));
+        EXPECT_EQ(interpolator.evaluateDerivative(1.0, 1), valueAndDerivatives(1));
+        EXPECT_EQ(interpolator.evaluateDerivative(1.0, 2), valueAndDerivatives(2));
+    }
+
+    {
+        EXPECT_THROW(interpolator.evaluateDerivative(1.0, 3), ostk::core::error::runtime::Wrong);
+    }
+}
@@ -0,0 +1,177 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Hermite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::curvefitting::interpolator::Hermite;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+class OpenSpaceToolkit_Mathematics_Interpolator_Hermite : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        x_ = VectorXd(7);
+        x_ << 0.0, 0.2, 0.5, 1.1, 1.3, 2.2, 3.0;
+
+        // Quintic polynomial and its derivatives
+
+        y_ = polynomial(x_);
+        dydx_ = (0.5 + x_.array() * (-0.6 + x_.array() * (0.9 + x_.array() * (-0.4 + 0.25 * x_.array())))).matrix();
+        d2ydx2_ = (-0.6 + x_.array() * (1.8 + x_.array() * (-1.2 + x_.array()))).matrix();
+    }
+
+    static VectorXd polynomial(const VectorXd& anXVector)
+    {
+        const auto x = anXVector.array();
+
+        return (1.0 + x * (0.5 + x * (-0.3 + x * (0.3 + x * (-0.1 + 0.05 * x))))).matrix();
+    }
+
+    VectorXd x_;
+    VectorXd y_;
+    VectorXd dydx_;
+    VectorXd d2ydx2_;
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Hermite(x_, y_, dydx_));
+        EXPECT_NO_THROW(Hermite(x_, y_, dydx_, d2ydx2_));
+        EXPECT_NO_THROW(Hermite(x_.head(2), y_.head(2), dydx_.head(2)));
+    }
+
+    {
+        EXPECT_THROW(Hermite(x_, y_.head(5), dydx_), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(Hermite(x_, y_, dydx_.head(5)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(Hermite(x_, y_, dydx_, d2ydx2_.head(5)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(Hermite(x_.head(1), y_.head(1), dydx_.head(1)), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        VectorXd x = x_;
+        x(3) = x(2);
+
+        EXPECT_THROW(Hermite(x, y_, dydx_), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, Getters)
+{
+    EXPECT_EQ(Interpolator::Type::Hermite, Hermite(x_, y_, dydx_).getInterpolationType());
+
+    EXPECT_EQ(Size(3), Hermite(x_, y_, dydx_).getDegree());
+    EXPECT_EQ(Size(5), Hermite(x_, y_, dydx_, d2ydx2_).getDegree());
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, Evaluate)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 3.5);
+
+    // Exact at the x values
+
+    {
+        const Hermite hermite = {x_, y_, dydx_};
+
+        EXPECT_TRUE(hermite.evaluate(x_).isApprox(y_, 1e-14));
+
+        for (Eigen::Index i = 0; i < queryX.size(); ++i)
+        {
+            EXPECT_EQ(hermite.evaluate(queryX)(i), hermite.evaluate(queryX(i)));
+        }
+    }
+
+    {
+        const Hermite hermite = {x_, y_, dydx_, d2ydx2_};
+
+        EXPECT_TRUE(hermite.evaluate(x_).isApprox(y_, 1e-14));
+    }
+
+    // Quintic polynomials are reproduced by the quintic interpolator, including in extrapolation
+
+    {
+        const Hermite hermite = {x_, y_, dydx_, d2ydx2_};
+
+        EXPECT_TRUE(hermite.evaluate(queryX).isApprox(polynomial(queryX), 1e-12));
+    }
+
+    // Cubic polynomials are reproduced by the cubic interpolator
+
+    {
+        const VectorXd y = (1.0 - 2.0 * x_.array() + 0.5 * x_.array().cube()).matrix();
+        const VectorXd dydx = (-2.0 + 1.5 * x_.array().square()).matrix();
+
+        const Hermite hermite = {x_, y, dydx};
+
+        const VectorXd reference = (1.0 - 2.0 * queryX.array() + 0.5 * queryX.array().cube()).matrix();
+
+        EXPECT_TRUE(hermite.evaluate(queryX).isApprox(reference, 1e-12));
+    }
+
+    // Circular motion sampled with large steps: the quintic interpolator is much more accurate than the cubic one
+
+    {
+        const VectorXd x = VectorXd::LinSpaced(13, 0.0, 2.0 * M_PI);
+
+        const VectorXd y = x.array().cos().matrix();
+        const VectorXd dydx = -x.array().sin().matrix();
+        const VectorXd d2ydx2 = -y;
+
+        const VectorXd query = VectorXd::LinSpaced(1000, 0.0, 2.0 * M_PI);
+        const VectorXd reference = query.array().cos().matrix();
+
+        const double cubicError = (Hermite(x, y, dydx).evaluate(query) - reference).cwiseAbs().maxCoeff();
+        const double quinticError = (Hermite(x, y, dydx, d2ydx2).evaluate(query) - reference).cwiseAbs().maxCoeff();
+
+        EXPECT_LT(cubicError, 2e-3);
+        EXPECT_LT(quinticError, 5e-6);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Hermite, EvaluateDerivative)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 3.5);
+
+    // Derivatives of the reproduced quintic polynomial
+
+    {
+        const Hermite hermite = {x_, y_, dydx_, d2ydx2_};
+
+        const MatrixXd valuesAndDerivatives = hermite.evaluateWithDerivatives(queryX, 6);
+
+        const auto x = queryX.array();
+
+        EXPECT_TRUE(valuesAndDerivatives.col(0).isApprox(polynomial(queryX), 1e-12));
+        const VectorXd expectedDerivatives = (0.5 + x * (-0.6 + x * (0.9 + x * (-0.4 + 0.25 * x)))).matrix();
+
+        EXPECT_TRUE(valuesAndDerivatives.col(1).isApprox(expectedDerivatives, 1e-12));
+        EXPECT_TRUE(valuesAndDerivatives.col(2).isApprox((-0.6 + x * (1.8 + x * (-1.2 + x))).matrix(), 1e-12));
+        EXPECT_TRUE(valuesAndDerivatives.col(3).isApprox((1.8 + x * (-2.4 + 3.0 * x)).matrix(), 1e-11));
+        EXPECT_TRUE(valuesAndDerivatives.col(4).isApprox((-2.4 + 6.0 * x).matrix(), 1e-10));
+        EXPECT_TRUE(valuesAndDerivatives.col(5).isApprox(VectorXd::Constant(queryX.size(), 6.0), 1e-10));
+        EXPECT_EQ(VectorXd::Zero(queryX.size()), valuesAndDerivatives.col(6));
+
+        for (Eigen::Index order = 0; order < 7; ++order)
+        {
+            EXPECT_TRUE(valuesAndDerivatives.col(order).isApprox(hermite.evaluateDerivative(queryX, order), 1e-15));
+        }
+    }
+
+    // Derivatives matched at the x values
+
+    {
+        const Hermite hermite = {x_, y_, dydx_};
+
+        EXPECT_TRUE(hermite.evaluateDerivative(x_).isApprox(dydx_, 1e-12));
+    }
+}
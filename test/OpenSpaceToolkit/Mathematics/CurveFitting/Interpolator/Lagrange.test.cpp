@@ -0,0 +1,174 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Lagrange.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::curvefitting::interpolator::Lagrange;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+class OpenSpaceToolkit_Mathematics_Interpolator_Lagrange : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        x_ = VectorXd(12);
+        x_ << 0.0, 0.2, 0.5, 1.1, 1.3, 2.2, 3.0, 3.4, 4.0, 4.1, 4.7, 5.5;
+
+        y_ = x_.array().sin().matrix();
+    }
+
+    VectorXd x_;
+    VectorXd y_;
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Lagrange, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Lagrange(x_, y_));
+        EXPECT_NO_THROW(Lagrange(x_, y_, 2));
+        EXPECT_NO_THROW(Lagrange(x_, y_, 12));
+    }
+
+    {
+        EXPECT_THROW(Lagrange(x_, y_.head(5)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(Lagrange(x_, y_, 1), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(Lagrange(x_, y_, 13), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        VectorXd x = x_;
+        x(3) = x(2);
+
+        EXPECT_THROW(Lagrange(x, y_), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Lagrange, Getters)
+{
+    EXPECT_EQ(Interpolator::Type::Lagrange, Lagrange(x_, y_).getInterpolationType());
+
+    EXPECT_EQ(Size(8), Lagrange(x_, y_).getPointCount());
+    EXPECT_EQ(Size(11), Lagrange(x_, y_, 11).getPointCount());
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Lagrange, Evaluate)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 6.0);
+
+    // Exact at the x values, and same values whether evaluated one by one or as a vector (with cached weights)
+
+    for (const Size pointCount : {2, 3, 4, 8, 11, 12})
+    {
+        const Lagrange lagrange = {x_, y_, pointCount};
+
+        EXPECT_EQ(y_, lagrange.evaluate(x_));
+
+        const VectorXd values = lagrange.evaluate(queryX);
+
+        for (Eigen::Index i = 0; i < queryX.size(); ++i)
+        {
+            EXPECT_EQ(values(i), lagrange.evaluate(queryX(i)));
+        }
+
+        VectorXd bufferValues(queryX.size());
+        lagrange.evaluate(queryX, bufferValues);
+
+        EXPECT_EQ(values, bufferValues);
+    }
+
+    {
+        VectorXd values(3);
+
+        EXPECT_THROW(Lagrange(x_, y_).evaluate(x_, values), ostk::core::error::runtime::Wrong);
+    }
+
+    // Two points: linear interpolation
+
+    {
+        const Lagrange lagrange = {x_, y_, 2};
+
+        EXPECT_NEAR(0.5 * (y_(3) + y_(4)), lagrange.evaluate(1.2), 1e-15);
+    }
+
+    // Polynomials of degree m - 1 are reproduced with windows of m points, including in extrapolation
+
+    {
+        const auto polynomial = [](const VectorXd& anXVector) -> VectorXd
+        {
+            const auto x = anXVector.array();
+
+            return (1.0 + x * (0.5 + x * (-0.3 + x * (0.2 + x * (-0.1 + x * (0.02 + x * (-0.01 + 0.002 * x)))))))
+                .matrix();
+        };
+
+        const Lagrange lagrange = {x_, polynomial(x_), 8};
+
+        EXPECT_TRUE(lagrange.evaluate(queryX).isApprox(polynomial(queryX), 1e-12));
+    }
+
+    // Accuracy of a local window on a long, finely sampled series
+
+    {
+        const VectorXd x = VectorXd::LinSpaced(100000, 0.0, 1000.0);
+        const VectorXd y = x.array().sin().matrix();
+
+        const Lagrange lagrange = {x, y, 8};
+
+        const VectorXd query = VectorXd::LinSpaced(1001, 0.005, 999.995);
+        const VectorXd reference = query.array().sin().matrix();
+
+        EXPECT_LT((lagrange.evaluate(query) - reference).cwiseAbs().maxCoeff(), 1e-12);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Lagrange, EvaluateDerivative)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 6.0);
+
+    // Derivatives of a reproduced polynomial, including at the x values
+
+    {
+        const auto x = x_.array();
+
+        const VectorXd y = (1.0 + x * (0.5 + x * (-0.3 + x * 0.02))).matrix();
+
+        const Lagrange lagrange = {x_, y, 4};
+
+        for (const VectorXd& query : {queryX, x_})
+        {
+            const auto q = query.array();
+
+            const MatrixXd valuesAndDerivatives = lagrange.evaluateWithDerivatives(query, 4);
+
+            EXPECT_TRUE(valuesAndDerivatives.col(0).isApprox(lagrange.evaluate(query), 1e-12));
+            EXPECT_TRUE(valuesAndDerivatives.col(1).isApprox((0.5 + q * (-0.6 + q * 0.06)).matrix(), 1e-12));
+            EXPECT_TRUE(valuesAndDerivatives.col(2).isApprox((-0.6 + q * 0.12).matrix(), 1e-11));
+            EXPECT_TRUE(valuesAndDerivatives.col(3).isApprox(VectorXd::Constant(query.size(), 0.12), 1e-10));
+            EXPECT_EQ(VectorXd::Zero(query.size()), valuesAndDerivatives.col(4));
+
+            EXPECT_TRUE(lagrange.evaluateDerivative(query).isApprox(valuesAndDerivatives.col(1), 1e-15));
+        }
+    }
+
+    // Derivative of a smooth function
+
+    {
+        const VectorXd x = VectorXd::LinSpaced(1001, 0.0, 10.0);
+        const VectorXd y = x.array().sin().matrix();
+
+        const Lagrange lagrange = {x, y};
+
+        const VectorXd query = VectorXd::LinSpaced(99, 0.005, 9.995);
+
+        EXPECT_LT((lagrange.evaluateDerivative(query) - query.array().cos().matrix()).cwiseAbs().maxCoeff(), 1e-10);
+    }
+}
@@ -0,0 +1,168 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Hermite.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/LagrangeHermite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::curvefitting::interpolator::Hermite;
+using ostk::mathematics::curvefitting::interpolator::LagrangeHermite;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+class OpenSpaceToolkit_Mathematics_Interpolator_LagrangeHermite : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        x_ = VectorXd(9);
+        x_ << 0.0, 0.2, 0.5, 1.1, 1.3, 2.2, 3.0, 3.4, 4.0;
+
+        y_ = (x_.array().sin() + 0.1 * x_.array().square()).matrix();
+        dydx_ = (x_.array().cos() + 0.2 * x_.array()).matrix();
+    }
+
+    VectorXd x_;
+    VectorXd y_;
+    VectorXd dydx_;
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_LagrangeHermite, Constructor)
+{
+    {
+        EXPECT_NO_THROW(LagrangeHermite(x_, y_, dydx_));
+        EXPECT_NO_THROW(LagrangeHermite(x_, y_, dydx_, 2));
+        EXPECT_NO_THROW(LagrangeHermite(x_, y_, dydx_, 9));
+    }
+
+    {
+        EXPECT_THROW(LagrangeHermite(x_, y_.head(5), dydx_), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(LagrangeHermite(x_, y_, dydx_.head(5)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(LagrangeHermite(x_, y_, dydx_, 1), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(LagrangeHermite(x_, y_, dydx_, 10), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        VectorXd x = x_;
+        x(3) = x(2);
+
+        EXPECT_THROW(LagrangeHermite(x, y_, dydx_), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_LagrangeHermite, Getters)
+{
+    EXPECT_EQ(Interpolator::Type::LagrangeHermite, LagrangeHermite(x_, y_, dydx_).getInterpolationType());
+
+    EXPECT_EQ(Size(4), LagrangeHermite(x_, y_, dydx_).getPointCount());
+    EXPECT_EQ(Size(6), LagrangeHermite(x_, y_, dydx_, 6).getPointCount());
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_LagrangeHermite, Evaluate)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 4.5);
+
+    // Exact at the x values
+
+    for (const Size pointCount : {2, 3, 4, 5, 9})
+    {
+        const LagrangeHermite lagrangeHermite = {x_, y_, dydx_, pointCount};
+
+        EXPECT_TRUE(lagrangeHermite.evaluate(x_).isApprox(y_, 1e-14));
+
+        for (Eigen::Index i = 0; i < queryX.size(); ++i)
+        {
+            EXPECT_EQ(lagrangeHermite.evaluate(queryX)(i), lagrangeHermite.evaluate(queryX(i)));
+        }
+    }
+
+    // Two points: same as the piecewise cubic Hermite interpolator
+
+    {
+        const VectorXd values = LagrangeHermite(x_, y_, dydx_, 2).evaluate(queryX);
+        const VectorXd referenceValues = Hermite(x_, y_, dydx_).evaluate(queryX);
+
+        EXPECT_TRUE(values.isApprox(referenceValues, 1e-12));
+    }
+
+    // Polynomials of degree 2m - 1 are reproduced with windows of m points
+
+    {
+        const auto polynomial = [](const VectorXd& anXVector) -> VectorXd
+        {
+            const auto x = anXVector.array();
+
+            return (1.0 + x * (0.5 + x * (-0.3 + x * (0.2 + x * (-0.1 + x * (0.02 + x * (-0.01 + 0.002 * x)))))))
+                .matrix();
+        };
+
+        const auto polynomialDerivative = [](const VectorXd& anXVector) -> VectorXd
+        {
+            const auto x = anXVector.array();
+
+            return (0.5 + x * (-0.6 + x * (0.6 + x * (-0.4 + x * (0.1 + x * (-0.06 + 0.014 * x)))))).matrix();
+        };
+
+        const LagrangeHermite lagrangeHermite = {x_, polynomial(x_), polynomialDerivative(x_), 4};
+
+        EXPECT_TRUE(lagrangeHermite.evaluate(queryX).isApprox(polynomial(queryX), 1e-12));
+    }
+
+    // Higher orders are more accurate on smooth functions
+
+    {
+        const VectorXd query = VectorXd::LinSpaced(1000, 0.0, 4.0);
+        const VectorXd reference = (query.array().sin() + 0.1 * query.array().square()).matrix();
+
+        const double error2 = (LagrangeHermite(x_, y_, dydx_, 2).evaluate(query) - reference).cwiseAbs().maxCoeff();
+        const double error4 = (LagrangeHermite(x_, y_, dydx_, 4).evaluate(query) - reference).cwiseAbs().maxCoeff();
+
+        EXPECT_LT(error4, error2);
+        EXPECT_LT(error4, 1e-5);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_LagrangeHermite, EvaluateDerivative)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 4.5);
+
+    // Derivatives matched at the x values
+
+    for (const Size pointCount : {2, 4, 9})
+    {
+        const LagrangeHermite lagrangeHermite = {x_, y_, dydx_, pointCount};
+
+        EXPECT_TRUE(lagrangeHermite.evaluateDerivative(x_).isApprox(dydx_, 1e-12));
+    }
+
+    {
+        const LagrangeHermite lagrangeHermite = {x_, y_, dydx_};
+
+        EXPECT_TRUE(lagrangeHermite.evaluateDerivative(queryX, 0).isApprox(lagrangeHermite.evaluate(queryX), 1e-12));
+    }
+
+    // Same derivatives as the piecewise cubic Hermite interpolator with two points
+
+    {
+        const MatrixXd valuesAndDerivatives = LagrangeHermite(x_, y_, dydx_, 2).evaluateWithDerivatives(queryX, 3);
+        const MatrixXd referenceValuesAndDerivatives = Hermite(x_, y_, dydx_).evaluateWithDerivatives(queryX, 3);
+
+        EXPECT_TRUE(valuesAndDerivatives.isApprox(referenceValuesAndDerivatives, 1e-10));
+    }
+
+    // Derivative of a smooth function
+
+    {
+        const VectorXd query = VectorXd::LinSpaced(1000, 0.0, 4.0);
+        const VectorXd reference = (query.array().cos() + 0.2 * query.array()).matrix();
+
+        EXPECT_LT((LagrangeHermite(x_, y_, dydx_).evaluateDerivative(query) - reference).cwiseAbs().maxCoeff(), 1e-4);
+    }
+}
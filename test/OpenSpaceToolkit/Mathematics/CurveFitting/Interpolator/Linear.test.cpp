@@ -2,6 +2,7 @@
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
@@ -83,3 +84,122 @@ TEST(OpenSpaceToolkit_Mathematics_Interpolator_Linear, Evaluate)
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Linear, EvaluateSorted)
+{
+    VectorXd x(6);
+    x << 0.0, 1.0, 2.0, 4.0, 5.0, 6.0;
+
+    VectorXd y(6);
+    y << 0.0, 3.0, 6.0, 9.0, 17.0, 5.0;
+
+    const Linear interpolator = Linear(x, y);
+
+    VectorXd queryX(10);
+    queryX << -1.0, 0.0, 0.5, 1.0, 3.0, 3.0, 4.5, 5.9, 6.0, 7.0;
+
+    VectorXd expectedY(10);
+    expectedY << 0.0, 0.0, 1.5, 3.0, 7.5, 7.5, 13.0, 6.2, 5.0, 5.0;
+
+    {
+        VectorXd values = VectorXd::Zero(queryX.size());
+
+        interpolator.evaluateSorted(queryX, values);
+
+        EXPECT_TRUE(values.isApprox(expectedY, 1e-14)) << values.transpose();
+    }
+
+    {
+        VectorXd values = VectorXd::Zero(queryX.size());
+
+        interpolator.evaluate(queryX, values);
+
+        EXPECT_TRUE(values.isApprox(expectedY, 1e-14)) << values.transpose();
+        EXPECT_TRUE(interpolator.evaluate(queryX).isApprox(expectedY, 1e-14));
+    }
+
+    // Sparse and dense sorted queries over a long x grid, at and between the x values
+
+    {
+        const VectorXd longX = VectorXd::LinSpaced(10001, 0.0, 100.0);
+        const Linear longInterpolator = Linear(longX, longX.array().sin().matrix());
+
+        for (const Eigen::Index queryCount : {1, 2, 7, 1000, 30001})
+        {
+            const VectorXd longQueryX = VectorXd::LinSpaced(queryCount, -1.0, 101.0);
+
+            VectorXd values = VectorXd::Zero(queryCount);
+
+            longInterpolator.evaluateSorted(longQueryX, values);
+
+            for (Eigen::Index i = 0; i < queryCount; ++i)
+            {
+                EXPECT_EQ(longInterpolator.evaluate(longQueryX(i)), values(i));
+            }
+        }
+
+        {
+            const VectorXd longQueryX = longX.segment(17, 5000);
+
+            VectorXd values = VectorXd::Zero(longQueryX.size());
+
+            longInterpolator.evaluateSorted(longQueryX, values);
+
+            for (Eigen::Index i = 0; i < longQueryX.size(); ++i)
+            {
+                EXPECT_EQ(longInterpolator.evaluate(longQueryX(i)), values(i));
+            }
+
+            EXPECT_TRUE(values.isApprox(longQueryX.array().sin().matrix(), 1e-12));
+        }
+    }
+
+    // Unsorted queries fall back to a search per query value
+
+    {
+        const VectorXd reversedQueryX = queryX.reverse();
+
+        VectorXd values = VectorXd::Zero(queryX.size());
+
+        interpolator.evaluate(reversedQueryX, values);
+
+        EXPECT_TRUE(values.isApprox(expectedY.reverse(), 1e-14)) << values.transpose();
+    }
+
+    {
+        VectorXd values = VectorXd::Zero(3);
+
+        EXPECT_THROW(interpolator.evaluate(queryX, values), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(interpolator.evaluateSorted(queryX, values), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Interpolator_Linear, EvaluateDerivative)
+{
+    VectorXd x(4);
+    x << 0.0, 1.0, 3.0, 4.0;
+
+    VectorXd y(4);
+    y << 1.0, 3.0, 2.0, 2.0;
+
+    const Linear interpolator(x, y);
+
+    {
+        VectorXd queryX(6);
+        queryX << -1.0, 0.5, 1.0, 2.0, 3.5, 5.0;
+
+        VectorXd expectedDerivatives(6);
+        expectedDerivatives << 0.0, 2.0, 2.0, -0.5, 0.0, 0.0;
+
+        EXPECT_EQ(expectedDerivatives, interpolator.evaluateDerivative(queryX));
+        EXPECT_EQ(interpolator.evaluate(queryX), interpolator.evaluateDerivative(queryX, 0));
+        EXPECT_EQ(VectorXd::Zero(6), interpolator.evaluateDerivative(queryX, 2));
+    }
+
+    {
+        VectorXd expectedValueAndDerivatives(3);
+        expectedValueAndDerivatives << 2.5, -0.5, 0.0;
+
+        EXPECT_EQ(expectedValueAndDerivatives, interpolator.evaluateWithDerivatives(2.0, 2));
+    }
+}
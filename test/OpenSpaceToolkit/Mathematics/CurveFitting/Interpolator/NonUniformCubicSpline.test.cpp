@@ -0,0 +1,251 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/NonUniformCubicSpline.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::curvefitting::interpolator::NonUniformCubicSpline;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+class OpenSpaceToolkit_Mathematics_Interpolator_NonUniformCubicSpline : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        x_ = VectorXd(8);
+        x_ << 0.0, 0.1, 0.35, 0.5, 1.2, 1.3, 2.1, 3.0;
+
+        // Cubic polynomial, reproduced exactly by the clamped and not-a-knot splines
+
+        y_ = cubic(x_);
+    }
+
+    static VectorXd cubic(const VectorXd& anXVector)
+    {
+        return (2.0 - 1.5 * anXVector.array() + 0.7 * anXVector.array().square() - 0.3 * anXVector.array().cube())
+            .matrix();
+    }
+
+    static double cubicDerivative(const double& anXValue)
+    {
+        return -1.5 + 1.4 * anXValue - 0.9 * anXValue * anXValue;
+    }
+
+    VectorXd x_;
+    VectorXd y_;
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_NonUniformCubicSpline, Constructor)
+{
+    {
+        EXPECT_NO_THROW(NonUniformCubicSpline(x_, y_));
+        EXPECT_NO_THROW(NonUniformCubicSpline(x_, y_, NonUniformCubicSpline::BoundaryCondition::Natural));
+        EXPECT_NO_THROW(NonUniformCubicSpline(x_, y_, NonUniformCubicSpline::BoundaryCondition::Clamped));
+        EXPECT_NO_THROW(NonUniformCubicSpline(x_, y_, 1.0, -1.0));
+    }
+
+    {
+        EXPECT_NO_THROW(NonUniformCubicSpline(x_.head(2), y_.head(2), NonUniformCubicSpline::BoundaryCondition::Natural)
+        );
+        EXPECT_NO_THROW(NonUniformCubicSpline(x_.head(4), y_.head(4)));
+    }
+
+    {
+        EXPECT_THROW(NonUniformCubicSpline(x_, y_.head(5)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            NonUniformCubicSpline(x_.head(1), y_.head(1), NonUniformCubicSpline::BoundaryCondition::Natural),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(NonUniformCubicSpline(x_.head(3), y_.head(3)), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        VectorXd x = x_;
+        x(4) = x(3);
+
+        EXPECT_THROW(NonUniformCubicSpline(x, y_), ostk::core::error::runtime::Wrong);
+
+        x(4) = x(2);
+
+        EXPECT_THROW(NonUniformCubicSpline(x, y_), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        EXPECT_THROW(NonUniformCubicSpline(x_, y_, Real::Undefined(), 0.0), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(NonUniformCubicSpline(x_, y_, 0.0, Real::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_NonUniformCubicSpline, Getters)
+{
+    EXPECT_EQ(Interpolator::Type::NonUniformCubicSpline, NonUniformCubicSpline(x_, y_).getInterpolationType());
+
+    EXPECT_EQ(NonUniformCubicSpline::BoundaryCondition::NotAKnot, NonUniformCubicSpline(x_, y_).getBoundaryCondition());
+    EXPECT_EQ(
+        NonUniformCubicSpline::BoundaryCondition::Natural,
+        NonUniformCubicSpline(x_, y_, NonUniformCubicSpline::BoundaryCondition::Natural).getBoundaryCondition()
+    );
+    EXPECT_EQ(
+        NonUniformCubicSpline::BoundaryCondition::Clamped,
+        NonUniformCubicSpline(x_, y_, 1.0, 2.0).getBoundaryCondition()
+    );
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_NonUniformCubicSpline, StringFromBoundaryCondition)
+{
+    EXPECT_EQ(
+        "Natural", NonUniformCubicSpline::StringFromBoundaryCondition(NonUniformCubicSpline::BoundaryCondition::Natural)
+    );
+    EXPECT_EQ(
+        "Clamped", NonUniformCubicSpline::StringFromBoundaryCondition(NonUniformCubicSpline::BoundaryCondition::Clamped)
+    );
+    EXPECT_EQ(
+        "NotAKnot",
+        NonUniformCubicSpline::StringFromBoundaryCondition(NonUniformCubicSpline::BoundaryCondition::NotAKnot)
+    );
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_NonUniformCubicSpline, Evaluate)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 3.5);
+
+    // Exact at the x values
+
+    for (const auto boundaryCondition :
+         {NonUniformCubicSpline::BoundaryCondition::Natural,
+          NonUniformCubicSpline::BoundaryCondition::Clamped,
+          NonUniformCubicSpline::BoundaryCondition::NotAKnot})
+    {
+        const NonUniformCubicSpline spline = {x_, y_, boundaryCondition};
+
+        EXPECT_TRUE(spline.evaluate(x_).isApprox(y_, 1e-14));
+
+        for (Eigen::Index i = 0; i < queryX.size(); ++i)
+        {
+            EXPECT_EQ(spline.evaluate(queryX)(i), spline.evaluate(queryX(i)));
+        }
+    }
+
+    // Cubic polynomials are reproduced, including in extrapolation
+
+    {
+        const NonUniformCubicSpline spline = {x_, y_};
+
+        EXPECT_TRUE(spline.evaluate(queryX).isApprox(cubic(queryX), 1e-12));
+    }
+
+    {
+        const NonUniformCubicSpline spline = {x_, y_, cubicDerivative(x_(0)), cubicDerivative(x_(x_.size() - 1))};
+
+        EXPECT_TRUE(spline.evaluate(queryX).isApprox(cubic(queryX), 1e-12));
+    }
+
+    // Natural splines are linear at the ends: the second differences vanish
+
+    {
+        const NonUniformCubicSpline spline = {x_, y_, NonUniformCubicSpline::BoundaryCondition::Natural};
+
+        const double h = 1e-4;
+
+        for (const double xEnd : {x_(0), x_(x_.size() - 1)})
+        {
+            const double secondDerivative =
+                (spline.evaluate(xEnd + h) - 2.0 * spline.evaluate(xEnd) + spline.evaluate(xEnd - h)) / (h * h);
+
+            EXPECT_NEAR(0.0, secondDerivative, 1e-6);
+        }
+    }
+
+    // Two points: a straight line
+
+    {
+        const NonUniformCubicSpline spline = {
+            x_.head(2), y_.head(2), NonUniformCubicSpline::BoundaryCondition::Natural
+        };
+
+        const double slope = (y_(1) - y_(0)) / (x_(1) - x_(0));
+
+        EXPECT_NEAR(y_(0) + slope * 0.05, spline.evaluate(0.05), 1e-14);
+    }
+
+    // Smooth function sampled with strongly varying steps
+
+    {
+        VectorXd x(40);
+
+        for (Eigen::Index i = 0; i < x.size(); ++i)
+        {
+            const double u = double(i) / double(x.size() - 1);
+            x(i) = 2.0 * M_PI * u * u;
+        }
+
+        const VectorXd y = x.array().sin().matrix();
+
+        const NonUniformCubicSpline spline = {x, y};
+
+        const VectorXd query = VectorXd::LinSpaced(1000, 0.0, 2.0 * M_PI);
+        const VectorXd reference = query.array().sin().matrix();
+
+        EXPECT_LT((spline.evaluate(query) - reference).cwiseAbs().maxCoeff(), 1e-4);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_NonUniformCubicSpline, EvaluateDerivative)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 3.5);
+
+    const NonUniformCubicSpline spline = {x_, y_};
+
+    // Derivatives of the reproduced cubic polynomial
+
+    {
+        EXPECT_EQ(spline.evaluate(queryX), spline.evaluateDerivative(queryX, 0));
+
+        for (Eigen::Index i = 0; i < queryX.size(); ++i)
+        {
+            const double x = queryX(i);
+
+            EXPECT_NEAR(cubicDerivative(x), spline.evaluateDerivative(x), 1e-12);
+            EXPECT_NEAR(1.4 - 1.8 * x, spline.evaluateDerivative(x, 2), 1e-12);
+            EXPECT_NEAR(-1.8, spline.evaluateDerivative(x, 3), 1e-12);
+            EXPECT_EQ(0.0, spline.evaluateDerivative(x, 4));
+        }
+    }
+
+    {
+        const MatrixXd valuesAndDerivatives = spline.evaluateWithDerivatives(queryX, 3);
+
+        ASSERT_EQ(4, valuesAndDerivatives.cols());
+
+        for (Eigen::Index order = 0; order < 4; ++order)
+        {
+            EXPECT_TRUE(valuesAndDerivatives.col(order).isApprox(spline.evaluateDerivative(queryX, order), 1e-15));
+        }
+
+        EXPECT_TRUE(valuesAndDerivatives.col(0).isApprox(spline.evaluate(queryX), 1e-15));
+    }
+
+    // Clamped end derivatives, and vanishing natural end second derivatives
+
+    {
+        const NonUniformCubicSpline clampedSpline = {x_, y_, 1.0, -2.0};
+
+        EXPECT_NEAR(1.0, clampedSpline.evaluateDerivative(x_(0)), 1e-12);
+        EXPECT_NEAR(-2.0, clampedSpline.evaluateDerivative(x_(x_.size() - 1)), 1e-12);
+    }
+
+    {
+        const NonUniformCubicSpline naturalSpline = {x_, y_, NonUniformCubicSpline::BoundaryCondition::Natural};
+
+        EXPECT_NEAR(0.0, naturalSpline.evaluateDerivative(x_(0), 2), 1e-12);
+        EXPECT_NEAR(0.0, naturalSpline.evaluateDerivative(x_(x_.size() - 1), 2), 1e-12);
+    }
+}
@@ -0,0 +1,247 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator/Streaming.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::curvefitting::interpolator::Streaming;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+class OpenSpaceToolkit_Mathematics_Interpolator_Streaming : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        x_ = VectorXd(8);
+        x_ << 0.0, 0.1, 0.35, 0.5, 1.2, 1.3, 2.1, 3.0;
+
+        // Quadratic polynomial, reproduced exactly
+
+        y_ = quadratic(x_);
+    }
+
+    static VectorXd quadratic(const VectorXd& anXVector)
+    {
+        return (2.0 - 1.5 * anXVector.array() + 0.7 * anXVector.array().square()).matrix();
+    }
+
+    VectorXd x_;
+    VectorXd y_;
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Streaming, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Streaming());
+        EXPECT_NO_THROW(Streaming(100));
+        EXPECT_NO_THROW(Streaming(x_, y_));
+        EXPECT_NO_THROW(Streaming(x_, y_, 4));
+        EXPECT_NO_THROW(Streaming(x_.head(1), y_.head(1)));
+    }
+
+    {
+        EXPECT_THROW(Streaming(1), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(Streaming(x_, y_.head(5)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(Streaming(x_.reverse(), y_), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Streaming, Getters)
+{
+    {
+        const Streaming streaming = {x_, y_};
+
+        EXPECT_EQ(Interpolator::Type::Streaming, streaming.getInterpolationType());
+        EXPECT_TRUE(streaming.isDefined());
+        EXPECT_EQ(x_.size(), streaming.getSize());
+        EXPECT_EQ(0, streaming.getCapacity());
+        EXPECT_EQ(x_, streaming.getXVector());
+        EXPECT_EQ(y_, streaming.getYVector());
+    }
+
+    {
+        const Streaming streaming = {x_, y_, 3};
+
+        EXPECT_EQ(3, streaming.getSize());
+        EXPECT_EQ(3, streaming.getCapacity());
+        EXPECT_EQ(VectorXd(x_.tail(3)), streaming.getXVector());
+        EXPECT_EQ(VectorXd(y_.tail(3)), streaming.getYVector());
+    }
+
+    {
+        EXPECT_FALSE(Streaming().isDefined());
+        EXPECT_FALSE(Streaming(x_.head(1), y_.head(1)).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Streaming, Append)
+{
+    // Appending one sample at a time gives the same interpolator as building it at once
+
+    {
+        const VectorXd y = x_.array().sin().matrix();
+        const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 3.5);
+
+        const Streaming reference = {x_, y};
+
+        Streaming streaming;
+
+        for (Eigen::Index i = 0; i < x_.size(); ++i)
+        {
+            streaming.append(x_(i), y(i));
+        }
+
+        EXPECT_EQ(reference.evaluate(queryX), streaming.evaluate(queryX));
+    }
+
+    // With a capacity, the interpolator is the same as one built from the retained samples only
+
+    {
+        const VectorXd y = x_.array().sin().matrix();
+        const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 3.5);
+
+        for (const Size capacity : {2, 3, 4, 5})
+        {
+            Streaming streaming(capacity);
+
+            for (Eigen::Index i = 0; i < x_.size(); ++i)
+            {
+                streaming.append(x_(i), y(i));
+
+                const Eigen::Index retainedCount = std::min(Eigen::Index(capacity), i + 1);
+
+                ASSERT_EQ(Size(retainedCount), streaming.getSize());
+
+                if (retainedCount >= 2)
+                {
+                    const Eigen::Index startIndex = i + 1 - retainedCount;
+
+                    const Streaming reference = {
+                        x_.segment(startIndex, retainedCount), y.segment(startIndex, retainedCount)
+                    };
+
+                    EXPECT_EQ(reference.evaluate(queryX), streaming.evaluate(queryX));
+                }
+            }
+        }
+    }
+
+    {
+        Streaming streaming = {x_, y_};
+
+        EXPECT_THROW(streaming.append(x_(x_.size() - 1), 0.0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(streaming.append(0.0, 0.0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(streaming.append(std::nan(""), 0.0), ostk::core::error::runtime::Wrong);
+
+        EXPECT_EQ(x_.size(), streaming.getSize());
+
+        streaming.clear();
+
+        EXPECT_EQ(0, streaming.getSize());
+        EXPECT_NO_THROW(streaming.append(0.0, 0.0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Streaming, Evaluate)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 3.5);
+
+    // Exact at the x values
+
+    {
+        const VectorXd y = x_.array().exp().matrix();
+
+        const Streaming streaming = {x_, y};
+
+        EXPECT_TRUE(streaming.evaluate(x_).isApprox(y, 1e-14));
+
+        for (Eigen::Index i = 0; i < queryX.size(); ++i)
+        {
+            EXPECT_EQ(streaming.evaluate(queryX)(i), streaming.evaluate(queryX(i)));
+        }
+    }
+
+    // Quadratic polynomials are reproduced, including in extrapolation
+
+    {
+        const Streaming streaming = {x_, y_};
+
+        EXPECT_TRUE(streaming.evaluate(queryX).isApprox(quadratic(queryX), 1e-12));
+    }
+
+    // Two points: a straight line
+
+    {
+        const Streaming streaming = {x_.head(2), y_.head(2)};
+
+        const double slope = (y_(1) - y_(0)) / (x_(1) - x_(0));
+
+        EXPECT_NEAR(y_(0) + slope * 0.05, streaming.evaluate(0.05), 1e-14);
+    }
+
+    // Smooth function sampled with strongly varying steps
+
+    {
+        VectorXd x(200);
+
+        for (Eigen::Index i = 0; i < x.size(); ++i)
+        {
+            const double u = double(i) / double(x.size() - 1);
+            x(i) = 2.0 * M_PI * u * u;
+        }
+
+        const Streaming streaming = {x, x.array().sin().matrix()};
+
+        const VectorXd query = VectorXd::LinSpaced(1000, 0.0, 2.0 * M_PI);
+        const VectorXd reference = query.array().sin().matrix();
+
+        EXPECT_LT((streaming.evaluate(query) - reference).cwiseAbs().maxCoeff(), 5e-5);
+    }
+
+    {
+        EXPECT_THROW(Streaming().evaluate(0.0), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Streaming(x_.head(1), y_.head(1)).evaluate(0.0), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Interpolator_Streaming, EvaluateDerivative)
+{
+    const VectorXd queryX = VectorXd::LinSpaced(301, -0.5, 3.5);
+
+    const Streaming streaming = {x_, y_};
+
+    // Derivatives of the reproduced quadratic polynomial
+
+    {
+        EXPECT_EQ(streaming.evaluate(queryX), streaming.evaluateDerivative(queryX, 0));
+
+        for (Eigen::Index i = 0; i < queryX.size(); ++i)
+        {
+            const double x = queryX(i);
+
+            EXPECT_NEAR(-1.5 + 1.4 * x, streaming.evaluateDerivative(x), 1e-12);
+            EXPECT_NEAR(1.4, streaming.evaluateDerivative(x, 2), 1e-10);
+            EXPECT_NEAR(0.0, streaming.evaluateDerivative(x, 3), 1e-8);
+            EXPECT_EQ(0.0, streaming.evaluateDerivative(x, 4));
+        }
+    }
+
+    {
+        const MatrixXd valuesAndDerivatives = streaming.evaluateWithDerivatives(queryX, 2);
+
+        ASSERT_EQ(3, valuesAndDerivatives.cols());
+
+        for (Eigen::Index order = 0; order < 3; ++order)
+        {
+            EXPECT_TRUE(valuesAndDerivatives.col(order).isApprox(streaming.evaluateDerivative(queryX, order), 1e-15));
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/VectorInterpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::curvefitting::VectorInterpolator;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+class OpenSpaceToolkit_Mathematics_VectorInterpolator : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        x_ = VectorXd::LinSpaced(41, 0.0, 10.0);
+        y_ = MatrixXd(x_.size(), 3);
+
+        y_.col(0) = x_.array().sin();
+        y_.col(1) = x_.array().cos();
+        y_.col(2) = 0.1 * x_.array().square();
+
+        queryX_ = VectorXd::LinSpaced(97, -0.5, 10.5);
+    }
+
+    VectorXd x_;
+    MatrixXd y_;
+    VectorXd queryX_;
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_VectorInterpolator, Constructor)
+{
+    {
+        EXPECT_NO_THROW(VectorInterpolator(Interpolator::Type::Linear, x_, y_));
+        EXPECT_NO_THROW(VectorInterpolator(Interpolator::Type::CubicSpline, x_, y_));
+        EXPECT_NO_THROW(VectorInterpolator(Interpolator::Type::BarycentricRational, x_, y_));
+    }
+
+    {
+        EXPECT_THROW(
+            VectorInterpolator(Interpolator::Type::Linear, x_.head(10), y_), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            VectorInterpolator(Interpolator::Type::Linear, x_.head(1), y_.topRows(1)),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            VectorInterpolator(Interpolator::Type::CubicSpline, x_.head(4), y_.topRows(4)),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        VectorXd x = x_;
+        x(3) += 0.1;
+
+        EXPECT_THROW(VectorInterpolator(Interpolator::Type::CubicSpline, x, y_), ostk::core::error::runtime::Wrong);
+        EXPECT_NO_THROW(VectorInterpolator(Interpolator::Type::BarycentricRational, x, y_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_VectorInterpolator, Getters)
+{
+    const VectorInterpolator vectorInterpolator = {Interpolator::Type::CubicSpline, x_, y_};
+
+    EXPECT_EQ(Interpolator::Type::CubicSpline, vectorInterpolator.getInterpolationType());
+    EXPECT_EQ(Size(3), vectorInterpolator.getComponentCount());
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_VectorInterpolator, Evaluate)
+{
+    // Same values as the scalar interpolator of each component
+
+    for (const auto type :
+         {Interpolator::Type::Linear, Interpolator::Type::CubicSpline, Interpolator::Type::BarycentricRational})
+    {
+        const VectorInterpolator vectorInterpolator = {type, x_, y_};
+
+        const MatrixXd values = vectorInterpolator.evaluate(queryX_);
+
+        ASSERT_EQ(queryX_.size(), values.rows());
+        ASSERT_EQ(y_.cols(), values.cols());
+
+        for (Eigen::Index j = 0; j < y_.cols(); ++j)
+        {
+            const VectorXd referenceValues =
+                Interpolator::GenerateInterpolator(type, x_, y_.col(j))->evaluate(queryX_);
+
+            EXPECT_TRUE(values.col(j).isApprox(referenceValues, 1e-12))
+                << (values.col(j) - referenceValues).cwiseAbs().maxCoeff();
+        }
+
+        for (Eigen::Index i = 0; i < queryX_.size(); ++i)
+        {
+            EXPECT_EQ(values.row(i).transpose(), vectorInterpolator.evaluate(queryX_(i)));
+        }
+    }
+
+    // Exact at the samples
+
+    {
+        const VectorInterpolator vectorInterpolator = {Interpolator::Type::BarycentricRational, x_, y_};
+
+        EXPECT_EQ(y_, vectorInterpolator.evaluate(x_));
+    }
+
+    {
+        const VectorInterpolator vectorInterpolator = {Interpolator::Type::Linear, x_, y_};
+
+        EXPECT_TRUE(y_.isApprox(vectorInterpolator.evaluate(x_), 1e-15));
+    }
+}
@@ -0,0 +1,186 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/DenseTrajectory.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+using ostk::mathematics::solver::DenseTrajectory;
+
+class OpenSpaceToolkit_Mathematics_Solver_DenseTrajectory : public ::testing::Test
+{
+    void SetUp() override
+    {
+        stepTimes_.resize(3);
+        stepTimes_ << 0.0, 1.0, 3.0;
+
+        nodeStates_ = this->sampleNodeStates(stepTimes_);
+    }
+
+   protected:
+    VectorXd stepTimes_;
+    MatrixXd nodeStates_;
+
+    // Degree 5 polynomial state, which a dense trajectory represents exactly
+    static VectorXd getState(const double &aTime)
+    {
+        VectorXd state(2);
+        state << 1.0 + aTime - 0.5 * std::pow(aTime, 3) + 0.1 * std::pow(aTime, 5), 2.0 - aTime * aTime;
+        return state;
+    }
+
+    static MatrixXd sampleNodeStates(const VectorXd &aStepTimes)
+    {
+        const Size stepCount = aStepTimes.size() - 1;
+
+        MatrixXd nodeStates(2, DenseTrajectory::NodeIntervalsPerStep * stepCount + 1);
+
+        for (Size i = 0; i < stepCount; ++i)
+        {
+            for (Size k = 0; k <= DenseTrajectory::NodeIntervalsPerStep; ++k)
+            {
+                const double time = aStepTimes(i) + (aStepTimes(i + 1) - aStepTimes(i)) * double(k) /
+                                                        DenseTrajectory::NodeIntervalsPerStep;
+
+                nodeStates.col(DenseTrajectory::NodeIntervalsPerStep * i + k) = getState(time);
+            }
+        }
+
+        return nodeStates;
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_DenseTrajectory, Constructor)
+{
+    {
+        EXPECT_NO_THROW(DenseTrajectory(stepTimes_, nodeStates_));
+    }
+
+    {
+        VectorXd nonMonotonicStepTimes(3);
+        nonMonotonicStepTimes << 0.0, 1.0, 1.0;
+
+        EXPECT_THROW(DenseTrajectory(nonMonotonicStepTimes, nodeStates_), ostk::core::error::RuntimeError);
+    }
+
+    {
+        EXPECT_THROW(DenseTrajectory(stepTimes_, nodeStates_.leftCols(5)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(DenseTrajectory(stepTimes_.head(1), nodeStates_.leftCols(1)), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_DenseTrajectory, EqualToOperator)
+{
+    const DenseTrajectory denseTrajectory = {stepTimes_, nodeStates_};
+
+    {
+        EXPECT_TRUE(denseTrajectory == denseTrajectory);
+        EXPECT_FALSE(denseTrajectory != denseTrajectory);
+    }
+
+    {
+        const DenseTrajectory anotherDenseTrajectory = {stepTimes_.head(2), nodeStates_.leftCols(6)};
+
+        EXPECT_FALSE(denseTrajectory == anotherDenseTrajectory);
+        EXPECT_TRUE(denseTrajectory != anotherDenseTrajectory);
+    }
+
+    {
+        EXPECT_FALSE(denseTrajectory == DenseTrajectory::Undefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_DenseTrajectory, Print)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        const DenseTrajectory denseTrajectory = {stepTimes_, nodeStates_};
+
+        EXPECT_NO_THROW(denseTrajectory.print(std::cout, true));
+        EXPECT_NO_THROW(denseTrajectory.print(std::cout, false));
+        EXPECT_NO_THROW(std::cout << DenseTrajectory::Undefined() << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_DenseTrajectory, Getters)
+{
+    const DenseTrajectory denseTrajectory = {stepTimes_, nodeStates_};
+
+    {
+        EXPECT_EQ(stepTimes_, denseTrajectory.accessStepTimes());
+        EXPECT_EQ(nodeStates_, denseTrajectory.accessNodeStates());
+        EXPECT_EQ(2, denseTrajectory.getStepCount());
+        EXPECT_EQ(2, denseTrajectory.getStateDimension());
+        EXPECT_EQ(0.0, denseTrajectory.getStartTime());
+        EXPECT_EQ(3.0, denseTrajectory.getEndTime());
+    }
+
+    {
+        EXPECT_THROW(DenseTrajectory::Undefined().accessStepTimes(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(DenseTrajectory::Undefined().accessNodeStates(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(DenseTrajectory::Undefined().getStepCount(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(DenseTrajectory::Undefined().getStartTime(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_DenseTrajectory, Evaluate)
+{
+    {
+        const DenseTrajectory denseTrajectory = {stepTimes_, nodeStates_};
+
+        for (const double time : {0.0, 0.123, 0.5, 1.0, 1.7, 2.999, 3.0})
+        {
+            EXPECT_TRUE(denseTrajectory.evaluate(time).isApprox(getState(time), 1e-12));
+        }
+
+        const VectorXd times = VectorXd::LinSpaced(31, 0.0, 3.0);
+        const MatrixXd states = denseTrajectory.evaluate(times);
+
+        EXPECT_EQ(2, states.rows());
+        EXPECT_EQ(31, states.cols());
+
+        for (Eigen::Index i = 0; i < times.size(); ++i)
+        {
+            EXPECT_TRUE(states.col(i).isApprox(getState(times(i)), 1e-12));
+        }
+
+        EXPECT_THROW(denseTrajectory.evaluate(-0.1), ostk::core::error::RuntimeError);
+        EXPECT_THROW(denseTrajectory.evaluate(3.1), ostk::core::error::RuntimeError);
+        EXPECT_THROW(denseTrajectory.evaluate(Real::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        VectorXd backwardStepTimes(4);
+        backwardStepTimes << 0.0, -0.5, -1.0, -2.5;
+
+        const DenseTrajectory denseTrajectory = {backwardStepTimes, sampleNodeStates(backwardStepTimes)};
+
+        for (const double time : {0.0, -0.2, -0.5, -0.75, -2.0, -2.5})
+        {
+            EXPECT_TRUE(denseTrajectory.evaluate(time).isApprox(getState(time), 1e-12));
+        }
+    }
+
+    {
+        EXPECT_THROW(DenseTrajectory::Undefined().evaluate(0.0), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_DenseTrajectory, Undefined)
+{
+    {
+        EXPECT_NO_THROW(DenseTrajectory::Undefined());
+        EXPECT_FALSE(DenseTrajectory::Undefined().isDefined());
+    }
+}
@@ -0,0 +1,147 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/EventCondition.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::String;
+
+using ostk::mathematics::object::VectorXd;
+using ostk::mathematics::solver::EventCondition;
+
+class OpenSpaceToolkit_Mathematics_Solver_EventCondition : public ::testing::Test
+{
+   protected:
+    const EventCondition::Evaluator evaluator_ = [](const VectorXd &x, const double t) -> double
+    {
+        return x[0] - t;
+    };
+
+    const EventCondition eventCondition_ = {"Crossing", EventCondition::Criterion::PositiveCrossing, evaluator_};
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_EventCondition, Constructor)
+{
+    {
+        EXPECT_NO_THROW(EventCondition("Crossing", EventCondition::Criterion::AnyCrossing, evaluator_));
+        EXPECT_NO_THROW(EventCondition("Crossing", EventCondition::Criterion::AnyCrossing, evaluator_, false));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_EventCondition, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << eventCondition_ << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_EventCondition, Print)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(eventCondition_.print(std::cout, true));
+        EXPECT_NO_THROW(eventCondition_.print(std::cout, false));
+        EXPECT_NO_THROW(EventCondition::Undefined().print(std::cout, true));
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_EventCondition, IsDefined)
+{
+    {
+        EXPECT_TRUE(eventCondition_.isDefined());
+        EXPECT_FALSE(EventCondition("", EventCondition::Criterion::AnyCrossing, evaluator_).isDefined());
+        EXPECT_FALSE(EventCondition("Crossing", EventCondition::Criterion::AnyCrossing, nullptr).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_EventCondition, Getters)
+{
+    {
+        EXPECT_EQ("Crossing", eventCondition_.getName());
+        EXPECT_EQ(EventCondition::Criterion::PositiveCrossing, eventCondition_.getCriterion());
+        EXPECT_TRUE(eventCondition_.isTerminal());
+        EXPECT_FALSE(
+            EventCondition("Crossing", EventCondition::Criterion::AnyCrossing, evaluator_, false).isTerminal()
+        );
+    }
+
+    {
+        EXPECT_THROW(EventCondition::Undefined().getName(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_EventCondition, Evaluate)
+{
+    {
+        VectorXd stateVector(2);
+        stateVector << 3.0, 1.0;
+
+        EXPECT_EQ(1.0, eventCondition_.evaluate(stateVector, 2.0));
+    }
+
+    {
+        EXPECT_THROW(
+            EventCondition::Undefined().evaluate(VectorXd::Zero(2), 0.0), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_EventCondition, IsSatisfied)
+{
+    {
+        const EventCondition eventCondition = {"Crossing", EventCondition::Criterion::PositiveCrossing, evaluator_};
+
+        EXPECT_TRUE(eventCondition.isSatisfied(-1.0, 1.0));
+        EXPECT_TRUE(eventCondition.isSatisfied(-1.0, 0.0));
+        EXPECT_FALSE(eventCondition.isSatisfied(0.0, 1.0));
+        EXPECT_FALSE(eventCondition.isSatisfied(1.0, -1.0));
+        EXPECT_FALSE(eventCondition.isSatisfied(1.0, 2.0));
+    }
+
+    {
+        const EventCondition eventCondition = {"Crossing", EventCondition::Criterion::NegativeCrossing, evaluator_};
+
+        EXPECT_TRUE(eventCondition.isSatisfied(1.0, -1.0));
+        EXPECT_TRUE(eventCondition.isSatisfied(1.0, 0.0));
+        EXPECT_FALSE(eventCondition.isSatisfied(0.0, -1.0));
+        EXPECT_FALSE(eventCondition.isSatisfied(-1.0, 1.0));
+        EXPECT_FALSE(eventCondition.isSatisfied(-1.0, -2.0));
+    }
+
+    {
+        const EventCondition eventCondition = {"Crossing", EventCondition::Criterion::AnyCrossing, evaluator_};
+
+        EXPECT_TRUE(eventCondition.isSatisfied(1.0, -1.0));
+        EXPECT_TRUE(eventCondition.isSatisfied(-1.0, 1.0));
+        EXPECT_FALSE(eventCondition.isSatisfied(0.0, 1.0));
+        EXPECT_FALSE(eventCondition.isSatisfied(1.0, 2.0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_EventCondition, StringFromCriterion)
+{
+    {
+        EXPECT_EQ("PositiveCrossing", EventCondition::StringFromCriterion(EventCondition::Criterion::PositiveCrossing));
+        EXPECT_EQ("NegativeCrossing", EventCondition::StringFromCriterion(EventCondition::Criterion::NegativeCrossing));
+        EXPECT_EQ("AnyCrossing", EventCondition::StringFromCriterion(EventCondition::Criterion::AnyCrossing));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_EventCondition, Undefined)
+{
+    {
+        EXPECT_NO_THROW(EventCondition::Undefined());
+        EXPECT_FALSE(EventCondition::Undefined().isDefined());
+    }
+}
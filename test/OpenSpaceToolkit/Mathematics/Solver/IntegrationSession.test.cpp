@@ -0,0 +1,216 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/IntegrationSession.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::VectorXd;
+using ostk::mathematics::solver::IntegrationSession;
+using ostk::mathematics::solver::NumericalSolver;
+
+class OpenSpaceToolkit_Mathematics_Solver_IntegrationSession : public ::testing::Test
+{
+   protected:
+    const NumericalSolver numericalSolver_ = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        1e-3,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations_ =
+        [](const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double) -> void
+    {
+        dxdt[0] = x[1];
+        dxdt[1] = -x[0];
+    };
+
+    static VectorXd getStateVector(const double &aTime)
+    {
+        VectorXd stateVector(2);
+        stateVector << std::sin(aTime), std::cos(aTime);
+        return stateVector;
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_IntegrationSession, Constructor)
+{
+    {
+        EXPECT_NO_THROW(IntegrationSession(numericalSolver_, getStateVector(0.0), 0.0, systemOfEquations_));
+    }
+
+    {
+        const NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::Rosenbrock4,
+            1e-3,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        EXPECT_THROW(
+            IntegrationSession(numericalSolver, getStateVector(0.0), 0.0, systemOfEquations_),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_IntegrationSession, Print)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        const IntegrationSession integrationSession = {
+            numericalSolver_, getStateVector(0.0), 0.0, systemOfEquations_
+        };
+
+        EXPECT_NO_THROW(integrationSession.print(std::cout, true));
+        EXPECT_NO_THROW(integrationSession.print(std::cout, false));
+        EXPECT_NO_THROW(std::cout << IntegrationSession::Undefined() << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_IntegrationSession, Getters)
+{
+    {
+        const IntegrationSession integrationSession = {
+            numericalSolver_, getStateVector(1.0), 1.0, systemOfEquations_
+        };
+
+        EXPECT_EQ(getStateVector(1.0), integrationSession.accessStateVector());
+        EXPECT_EQ(1.0, integrationSession.getTime());
+        EXPECT_EQ(1.0, integrationSession.getSolution().second);
+        EXPECT_EQ(1e-3, integrationSession.getTimeStep());
+        EXPECT_EQ(0, integrationSession.getStatistics().acceptedStepCount);
+    }
+
+    {
+        EXPECT_THROW(IntegrationSession::Undefined().accessStateVector(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(IntegrationSession::Undefined().getTime(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(IntegrationSession::Undefined().getTimeStep(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(IntegrationSession::Undefined().getStatistics(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_IntegrationSession, Advance)
+{
+    for (const auto stepperType :
+         {NumericalSolver::StepperType::RungeKutta4,
+          NumericalSolver::StepperType::RungeKuttaCashKarp54,
+          NumericalSolver::StepperType::RungeKuttaFehlberg78,
+          NumericalSolver::StepperType::RungeKuttaDopri5})
+    {
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            stepperType,
+            1e-3,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        // Successive hops cost less than as many fresh integrations, each growing the step size from its initial
+        // guess, and about as much as a single integration
+
+        IntegrationSession integrationSession = {numericalSolver, getStateVector(0.0), 0.0, systemOfEquations_};
+
+        Size freshCallCount = 0;
+
+        for (Size hopIndex = 1; hopIndex <= 20; ++hopIndex)
+        {
+            const double hopTime = 0.5 * double(hopIndex);
+
+            const IntegrationSession::Solution solution = integrationSession.advanceTo(hopTime);
+
+            EXPECT_EQ(hopTime, solution.second);
+            EXPECT_GT(2e-8, (solution.first - getStateVector(hopTime)).norm());
+
+            numericalSolver.integrateTime(getStateVector(hopTime - 0.5), hopTime - 0.5, hopTime, systemOfEquations_);
+            freshCallCount += numericalSolver.getStatistics().systemOfEquationsCallCount;
+        }
+
+        numericalSolver.integrateDuration(getStateVector(0.0), 10.0, systemOfEquations_);
+
+        const NumericalSolver::Statistics statistics = integrationSession.getStatistics();
+
+        EXPECT_GT(
+            (3 * numericalSolver.getStatistics().systemOfEquationsCallCount) / 2, statistics.systemOfEquationsCallCount
+        );
+        EXPECT_TRUE(statistics.wallTime.isDefined());
+
+        if (stepperType != NumericalSolver::StepperType::RungeKutta4)
+        {
+            EXPECT_GT(freshCallCount, statistics.systemOfEquationsCallCount);
+            EXPECT_LT(1e-2, integrationSession.getTimeStep());
+        }
+
+        // Backward, and by a duration
+
+        {
+            const IntegrationSession::Solution solution = integrationSession.advanceBy(-12.5);
+
+            EXPECT_EQ(-2.5, solution.second);
+            EXPECT_GT(5e-8, (solution.first - getStateVector(-2.5)).norm());
+        }
+
+        {
+            const IntegrationSession::Solution solution = integrationSession.advanceBy(0.0);
+
+            EXPECT_EQ(-2.5, solution.second);
+        }
+    }
+
+    {
+        IntegrationSession integrationSession = {numericalSolver_, getStateVector(0.0), 0.0, systemOfEquations_};
+
+        EXPECT_THROW(integrationSession.advanceTo(Real::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(integrationSession.advanceBy(Real::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(IntegrationSession::Undefined().advanceTo(1.0), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_IntegrationSession, Reset)
+{
+    {
+        IntegrationSession integrationSession = {numericalSolver_, getStateVector(0.0), 0.0, systemOfEquations_};
+
+        integrationSession.advanceTo(5.0);
+
+        const Real adaptedTimeStep = integrationSession.getTimeStep();
+
+        // Impulsive change of the state, onto another phase of the oscillator
+
+        integrationSession.reset(getStateVector(2.0), 5.0);
+
+        EXPECT_EQ(adaptedTimeStep, integrationSession.getTimeStep());
+        EXPECT_EQ(0, integrationSession.getStatistics().systemOfEquationsCallCount);
+
+        const IntegrationSession::Solution solution = integrationSession.advanceTo(6.0);
+
+        EXPECT_GT(2e-8, (solution.first - getStateVector(3.0)).norm());
+    }
+
+    {
+        EXPECT_THROW(
+            IntegrationSession::Undefined().reset(getStateVector(0.0), 0.0), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_IntegrationSession, Undefined)
+{
+    {
+        EXPECT_NO_THROW(IntegrationSession::Undefined());
+        EXPECT_FALSE(IntegrationSession::Undefined().isDefined());
+    }
+}
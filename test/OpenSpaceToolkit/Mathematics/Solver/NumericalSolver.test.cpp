@@ -2,9 +2,11 @@
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -17,10 +19,14 @@ using ostk::core::container::Tuple;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
+using ostk::mathematics::solver::DenseTrajectory;
+using ostk::mathematics::solver::EventCondition;
 using ostk::mathematics::solver::NumericalSolver;
 
 // Simple duration based condition
@@ -70,6 +76,13 @@ class OpenSpaceToolkit_Mathematics_Solver_NumericalSolver : public ::testing::Te
         dxdt[1] = -x[0];
     };
 
+    const NumericalSolver::EnsembleSystemOfEquationsWrapper ensembleSystemOfEquations_ =
+        [](const NumericalSolver::EnsembleState &x, NumericalSolver::EnsembleState &dxdt, const double) -> void
+    {
+        dxdt.row(0) = x.row(1);
+        dxdt.row(1) = -x.row(0);
+    };
+
     void validatePropagatedStates(
         const Array<Real> &aTimeArray, const Array<NumericalSolver::Solution> &aSolutionArray, const double &aTolerance
     )
@@ -83,6 +96,46 @@ class OpenSpaceToolkit_Mathematics_Solver_NumericalSolver : public ::testing::Te
         }
     }
 
+    // Uncoupled harmonic oscillators, the last component of odd-sized states being constant
+
+    template <int N>
+    static void validateFixedSizeOscillators(NumericalSolver &aNumericalSolver)
+    {
+        const NumericalSolver::FixedSystemOfEquationsWrapper<N> fixedSystemOfEquations =
+            [](const NumericalSolver::FixedStateVector<N> &x, NumericalSolver::FixedStateVector<N> &dxdt, const double)
+            -> void
+        {
+            dxdt.setZero();
+
+            for (int i = 0; i + 1 < N; i += 2)
+            {
+                dxdt[i] = x[i + 1];
+                dxdt[i + 1] = -x[i];
+            }
+        };
+
+        NumericalSolver::FixedStateVector<N> fixedStateVector;
+
+        for (int i = 0; i < N; ++i)
+        {
+            fixedStateVector[i] = (i % 2 == 0) ? 0.0 : 1.0;
+        }
+
+        const NumericalSolver::FixedStateVector<N> propagatedStateVector =
+            aNumericalSolver.integrateDuration(fixedStateVector, 10.0, fixedSystemOfEquations).first;
+
+        for (int i = 0; i + 1 < N; i += 2)
+        {
+            EXPECT_GT(2e-8, std::abs(propagatedStateVector[i] - std::sin(10.0)));
+            EXPECT_GT(2e-8, std::abs(propagatedStateVector[i + 1] - std::cos(10.0)));
+        }
+
+        if (N % 2 == 1)
+        {
+            EXPECT_EQ(fixedStateVector[N - 1], propagatedStateVector[N - 1]);
+        }
+    }
+
     NumericalSolver::StateVector getStateVector(const double &aTime)
     {
         VectorXd stateVector(2);
@@ -348,6 +401,117 @@ TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, GetObservedStates)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, ObservationDecimation)
+{
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::LogConstant,
+        NumericalSolver::StepperType::RungeKutta4,
+        1e-2,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    {
+        EXPECT_EQ(1, numericalSolver.getObservationStepInterval());
+        EXPECT_FALSE(numericalSolver.getObservationMinimumTimeSeparation().isDefined());
+    }
+
+    testing::internal::CaptureStdout();
+
+    const NumericalSolver::StateVector referenceStateVector =
+        numericalSolver.integrateDuration(defaultStateVector_, defaultDuration_, systemOfEquations_).first;
+    const Array<NumericalSolver::Solution> referenceSolutions = numericalSolver.getObservedStateVectors();
+
+    ASSERT_EQ(1001, referenceSolutions.size());
+
+    // Every k-th step
+
+    {
+        numericalSolver.setObservationDecimation(10);
+
+        const NumericalSolver::StateVector stateVector =
+            numericalSolver.integrateDuration(defaultStateVector_, defaultDuration_, systemOfEquations_).first;
+
+        EXPECT_EQ(referenceStateVector, stateVector);
+        EXPECT_EQ(10, numericalSolver.getObservationStepInterval());
+
+        const Array<NumericalSolver::Solution> solutions = numericalSolver.getObservedStateVectors();
+
+        ASSERT_EQ(101, solutions.size());
+
+        for (Size i = 0; i < solutions.size(); ++i)
+        {
+            EXPECT_EQ(referenceSolutions[10 * i].second, solutions[i].second);
+            EXPECT_EQ(referenceSolutions[10 * i].first, solutions[i].first);
+        }
+    }
+
+    // Minimum time separation
+
+    {
+        numericalSolver.setObservationDecimation(1, 0.5 - 1e-9);
+
+        numericalSolver.integrateDuration(defaultStateVector_, defaultDuration_, systemOfEquations_);
+
+        const Array<NumericalSolver::Solution> solutions = numericalSolver.getObservedStateVectors();
+
+        ASSERT_EQ(21, solutions.size());
+
+        for (Size i = 0; i < solutions.size(); ++i)
+        {
+            EXPECT_NEAR(0.5 * double(i), solutions[i].second, 1e-9);
+        }
+    }
+
+    // Streaming to a sink, which leaves the buffer empty
+
+    {
+        numericalSolver.setObservationDecimation(100);
+
+        Array<double> streamedTimes = Array<double>::Empty();
+
+        numericalSolver.setStateObserver(
+            [&streamedTimes](const NumericalSolver::StateVector &x, const double t) -> void
+            {
+                EXPECT_EQ(2, x.size());
+                streamedTimes.add(t);
+            }
+        );
+
+        const NumericalSolver::StateVector stateVector =
+            numericalSolver.integrateDuration(defaultStateVector_, defaultDuration_, systemOfEquations_).first;
+
+        EXPECT_EQ(referenceStateVector, stateVector);
+        EXPECT_TRUE(numericalSolver.getObservedStateVectors().isEmpty());
+
+        ASSERT_EQ(11, streamedTimes.size());
+        EXPECT_NEAR(10.0, streamedTimes.accessLast(), 1e-9);
+
+        // Time array integration results do not depend on the observation
+
+        const Array<Real> timeArray = {1.0, 2.0, 3.0};
+
+        const Array<NumericalSolver::Solution> solutions =
+            numericalSolver.integrateTime(defaultStateVector_, defaultStartTime_, timeArray, systemOfEquations_);
+
+        EXPECT_EQ(3, solutions.size());
+        EXPECT_EQ(3.0, solutions.accessLast().second);
+
+        numericalSolver.setStateObserver(nullptr);
+
+        numericalSolver.integrateDuration(defaultStateVector_, defaultDuration_, systemOfEquations_);
+
+        EXPECT_EQ(11, numericalSolver.getObservedStateVectors().size());
+    }
+
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+
+    {
+        EXPECT_THROW(numericalSolver.setObservationDecimation(0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(numericalSolver.setObservationDecimation(1, -1.0), ostk::core::error::runtime::Wrong);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, StringFromType)
 {
     {
@@ -363,6 +527,21 @@ TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, StringFromType)
         EXPECT_TRUE(
             NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::RungeKuttaDopri5) == "RungeKuttaDopri5"
         );
+        EXPECT_TRUE(
+            NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::Rosenbrock4) == "Rosenbrock4"
+        );
+        EXPECT_TRUE(
+            NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::BackwardDifferentiationFormula) ==
+            "BackwardDifferentiationFormula"
+        );
+        EXPECT_TRUE(
+            NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::VelocityVerlet) == "VelocityVerlet"
+        );
+        EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::Yoshida4) == "Yoshida4");
+        EXPECT_TRUE(
+            NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::AdamsBashforthMoulton8) ==
+            "AdamsBashforthMoulton8"
+        );
     }
 
     {
@@ -370,6 +549,16 @@ TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, StringFromType)
         EXPECT_TRUE(NumericalSolver::StringFromLogType(NumericalSolver::LogType::LogConstant) == "LogConstant");
         EXPECT_TRUE(NumericalSolver::StringFromLogType(NumericalSolver::LogType::LogAdaptive) == "LogAdaptive");
     }
+
+    {
+        EXPECT_TRUE(
+            NumericalSolver::StringFromEnsembleStepControl(NumericalSolver::EnsembleStepControl::Shared) == "Shared"
+        );
+        EXPECT_TRUE(
+            NumericalSolver::StringFromEnsembleStepControl(NumericalSolver::EnsembleStepControl::PerMember) ==
+            "PerMember"
+        );
+    }
 }
 
 TEST_P(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_Parametrized, integrateDuration)
@@ -592,6 +781,1240 @@ TEST_P(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_Parametrized, Integra
     }
 }
 
+TEST_P(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_Parametrized, IntegrateTime_Matrix)
+{
+    const auto parameters = GetParam();
+
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        std::get<0>(parameters),
+        1e-3,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    for (const double direction : {1.0, -1.0})
+    {
+        const VectorXd timeVector = direction * VectorXd::LinSpaced(10, 1.0, 10.0);
+
+        const MatrixXd stateMatrix =
+            numericalSolver.integrateTime(defaultStateVector_, defaultStartTime_, timeVector, systemOfEquations_);
+
+        EXPECT_EQ(2, stateMatrix.rows());
+        EXPECT_EQ(10, stateMatrix.cols());
+
+        for (Eigen::Index i = 0; i < timeVector.size(); ++i)
+        {
+            EXPECT_GT(2e-8, (stateMatrix.col(i) - getStateVector(timeVector(i))).norm());
+        }
+
+        // Same states as the time array integration
+
+        const Array<NumericalSolver::Solution> solutions = numericalSolver.integrateTime(
+            defaultStateVector_,
+            defaultStartTime_,
+            Array<Real>(timeVector.begin(), timeVector.end()),
+            systemOfEquations_
+        );
+
+        for (Eigen::Index i = 0; i < timeVector.size(); ++i)
+        {
+            EXPECT_EQ(solutions[i].first, stateMatrix.col(i));
+        }
+    }
+
+    {
+        const VectorXd timeVector = VectorXd::LinSpaced(4, 1.0, 4.0);
+
+        // Caller provided storage, such as a block of a larger matrix
+
+        MatrixXd states = MatrixXd::Zero(2, 6);
+
+        numericalSolver.integrateTime(
+            defaultStateVector_, defaultStartTime_, timeVector, systemOfEquations_, states.middleCols(1, 4)
+        );
+
+        EXPECT_EQ(VectorXd::Zero(2), states.col(0));
+        EXPECT_EQ(VectorXd::Zero(2), states.col(5));
+        EXPECT_GT(2e-8, (states.col(4) - getStateVector(4.0)).norm());
+
+        EXPECT_THROW(
+            numericalSolver.integrateTime(
+                defaultStateVector_, defaultStartTime_, timeVector, systemOfEquations_, states.leftCols(3)
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        const MatrixXd stateMatrix = numericalSolver.integrateTime(
+            defaultStateVector_, defaultStartTime_, VectorXd::Constant(1, defaultStartTime_), systemOfEquations_
+        );
+
+        EXPECT_EQ(defaultStateVector_, stateMatrix.col(0));
+    }
+
+    {
+        EXPECT_THROW(
+            numericalSolver.integrateTime(defaultStateVector_, defaultStartTime_, VectorXd(), systemOfEquations_),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_P(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_Parametrized, IntegrateTime_EventConditions)
+{
+    const auto parameters = GetParam();
+
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        std::get<0>(parameters),
+        1e-3,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const EventCondition::Evaluator positionEvaluator = [](const VectorXd &x, const double) -> double
+    {
+        return x[0];
+    };
+
+    // Non-terminal conditions, the crossing at the start time being ignored
+
+    {
+        const EventCondition zeroCrossing = {
+            "Zero crossing", EventCondition::Criterion::AnyCrossing, positionEvaluator, false
+        };
+
+        for (const double endTime : {10.0, -10.0})
+        {
+            const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+                defaultStateVector_, defaultStartTime_, endTime, systemOfEquations_, {zeroCrossing}
+            );
+
+            EXPECT_FALSE(conditionSolution.conditionIsSatisfied);
+            EXPECT_EQ(endTime, conditionSolution.solution.second);
+            EXPECT_TRUE(conditionSolution.solution.first.isApprox(getStateVector(endTime), 1e-8));
+
+            ASSERT_EQ(3, conditionSolution.eventSolutions.size());
+
+            for (Size i = 0; i < conditionSolution.eventSolutions.size(); ++i)
+            {
+                const NumericalSolver::EventSolution &eventSolution = conditionSolution.eventSolutions[i];
+                const double expectedTime = (endTime > 0.0 ? 1.0 : -1.0) * M_PI * double(i + 1);
+
+                EXPECT_EQ(0, eventSolution.first);
+                EXPECT_NEAR(expectedTime, eventSolution.second.second, 1e-8);
+                EXPECT_NEAR(0.0, eventSolution.second.first[0], 1e-8);
+                EXPECT_NEAR(std::cos(expectedTime), eventSolution.second.first[1], 1e-8);
+            }
+        }
+    }
+
+    // Terminal condition, stopping the integration
+
+    {
+        const EventCondition apex = {
+            "Apex",
+            EventCondition::Criterion::NegativeCrossing,
+            [](const VectorXd &x, const double) -> double
+            {
+                return x[1];
+            },
+            false
+        };
+
+        const EventCondition threshold = {
+            "Threshold",
+            EventCondition::Criterion::NegativeCrossing,
+            [](const VectorXd &x, const double) -> double
+            {
+                return x[0] + 0.5;
+            }
+        };
+
+        const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateDuration(
+            defaultStateVector_, defaultDuration_, systemOfEquations_, {threshold, apex}
+        );
+
+        const double thresholdTime = 7.0 * M_PI / 6.0;
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+        EXPECT_NEAR(thresholdTime, conditionSolution.solution.second, 1e-8);
+        EXPECT_TRUE(conditionSolution.solution.first.isApprox(getStateVector(thresholdTime), 1e-8));
+
+        ASSERT_EQ(2, conditionSolution.eventSolutions.size());
+        EXPECT_EQ(1, conditionSolution.eventSolutions[0].first);
+        EXPECT_NEAR(M_PI / 2.0, conditionSolution.eventSolutions[0].second.second, 1e-8);
+        EXPECT_EQ(0, conditionSolution.eventSolutions[1].first);
+        EXPECT_EQ(conditionSolution.solution.second, conditionSolution.eventSolutions[1].second.second);
+
+        EXPECT_EQ(conditionSolution.solution.second, numericalSolver.getObservedStateVectors().accessLast().second);
+    }
+
+    {
+        const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateDuration(
+            defaultStateVector_, 0.0, systemOfEquations_, Array<EventCondition>::Empty()
+        );
+
+        EXPECT_FALSE(conditionSolution.conditionIsSatisfied);
+        EXPECT_EQ(defaultStateVector_, conditionSolution.solution.first);
+        EXPECT_TRUE(conditionSolution.eventSolutions.isEmpty());
+    }
+
+    {
+        EXPECT_THROW(
+            numericalSolver.integrateDuration(
+                defaultStateVector_, defaultDuration_, systemOfEquations_, {EventCondition::Undefined()}
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_P(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_Parametrized, IntegrateDuration_FixedSize)
+{
+    const auto parameters = GetParam();
+
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        std::get<0>(parameters),
+        1e-3,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    // Keplerian two-body problem, the fixed-size path must reproduce the dynamic one
+
+    {
+        const NumericalSolver::FixedSystemOfEquationsWrapper<6> fixedSystemOfEquations =
+            [](const NumericalSolver::FixedStateVector<6> &x, NumericalSolver::FixedStateVector<6> &dxdt, const double)
+            -> void
+        {
+            dxdt.head<3>() = x.tail<3>();
+            dxdt.tail<3>() = -x.head<3>() / std::pow(x.head<3>().norm(), 3);
+        };
+
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+            [](const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double) -> void
+        {
+            dxdt.head(3) = x.tail(3);
+            dxdt.tail(3) = -x.head(3) / std::pow(x.head(3).norm(), 3);
+        };
+
+        NumericalSolver::FixedStateVector<6> fixedStateVector;
+        fixedStateVector << 1.0, 0.0, 0.0, 0.0, 1.1, 0.1;
+
+        const NumericalSolver::StateVector stateVector = fixedStateVector;
+
+        for (const Real &duration : {Real(10.0), Real(-10.0)})
+        {
+            const NumericalSolver::FixedSolution<6> fixedSolution =
+                numericalSolver.integrateDuration(fixedStateVector, duration, fixedSystemOfEquations);
+
+            const NumericalSolver::Solution solution =
+                numericalSolver.integrateDuration(stateVector, duration, systemOfEquations);
+
+            EXPECT_TRUE(fixedSolution.first.isApprox(solution.first, 1e-12));
+            EXPECT_EQ(solution.second, fixedSolution.second);
+        }
+
+        const NumericalSolver::FixedSolution<6> fixedSolution =
+            numericalSolver.integrateTime(fixedStateVector, 5.0, 15.0, fixedSystemOfEquations);
+
+        EXPECT_TRUE(fixedSolution.first.isApprox(
+            numericalSolver.integrateDuration(fixedStateVector, 10.0, fixedSystemOfEquations).first, 1e-15
+        ));
+
+        EXPECT_EQ(
+            fixedStateVector, numericalSolver.integrateDuration(fixedStateVector, 0.0, fixedSystemOfEquations).first
+        );
+        EXPECT_TRUE(numericalSolver.getObservedStateVectors().isEmpty());
+    }
+
+    // Uncoupled harmonic oscillators of other supported sizes
+
+    {
+        validateFixedSizeOscillators<7>(numericalSolver);
+        validateFixedSizeOscillators<13>(numericalSolver);
+        validateFixedSizeOscillators<42>(numericalSolver);
+    }
+}
+
+TEST_P(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_Parametrized, IntegrateDuration_Parallel)
+{
+    const auto parameters = GetParam();
+
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        std::get<0>(parameters),
+        1e-3,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    Array<NumericalSolver::StateVector> stateVectors;
+    Array<double> phases;
+
+    for (Size i = 0; i < 16; ++i)
+    {
+        phases.add(0.1 * i);
+        stateVectors.add(getStateVector(phases.accessLast()));
+    }
+
+    {
+        const Array<NumericalSolver::Solution> referenceSolutions =
+            numericalSolver.integrateDuration(stateVectors, defaultDuration_, systemOfEquations_, 1);
+
+        ASSERT_EQ(stateVectors.size(), referenceSolutions.size());
+
+        for (Size i = 0; i < stateVectors.size(); ++i)
+        {
+            EXPECT_GT(2e-8, std::abs(referenceSolutions[i].first[0] - std::sin(phases[i] + defaultDuration_)));
+            EXPECT_GT(2e-8, std::abs(referenceSolutions[i].first[1] - std::cos(phases[i] + defaultDuration_)));
+            EXPECT_DOUBLE_EQ(defaultDuration_, referenceSolutions[i].second);
+        }
+
+        // Results are bitwise identical whatever the thread count
+
+        for (const Size threadCount : Array<Size> {0, 2, 3, 32})
+        {
+            const Array<NumericalSolver::Solution> solutions =
+                numericalSolver.integrateDuration(stateVectors, defaultDuration_, systemOfEquations_, threadCount);
+
+            ASSERT_EQ(referenceSolutions.size(), solutions.size());
+
+            for (Size i = 0; i < solutions.size(); ++i)
+            {
+                EXPECT_EQ(referenceSolutions[i].first, solutions[i].first);
+            }
+        }
+    }
+
+    {
+        const Array<NumericalSolver::Solution> solutions =
+            numericalSolver.integrateTime(stateVectors, defaultStartTime_, -defaultDuration_, systemOfEquations_);
+
+        ASSERT_EQ(stateVectors.size(), solutions.size());
+
+        for (Size i = 0; i < stateVectors.size(); ++i)
+        {
+            EXPECT_GT(2e-8, std::abs(solutions[i].first[0] - std::sin(phases[i] - defaultDuration_)));
+            EXPECT_DOUBLE_EQ(-defaultDuration_, solutions[i].second);
+        }
+    }
+
+    // Trajectories are not logged, and are integrated as when logging
+
+    {
+        NumericalSolver loggingNumericalSolver = {
+            NumericalSolver::LogType::LogConstant,
+            std::get<0>(parameters),
+            1e-2,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        testing::internal::CaptureStdout();
+
+        const Array<NumericalSolver::Solution> solutions =
+            loggingNumericalSolver.integrateDuration(stateVectors, defaultDuration_, systemOfEquations_, 4);
+
+        EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+
+        ASSERT_EQ(stateVectors.size(), solutions.size());
+
+        testing::internal::CaptureStdout();
+
+        for (Size i = 0; i < stateVectors.size(); ++i)
+        {
+            EXPECT_EQ(
+                loggingNumericalSolver.integrateDuration(stateVectors[i], defaultDuration_, systemOfEquations_).first,
+                solutions[i].first
+            );
+        }
+
+        testing::internal::GetCapturedStdout();
+    }
+
+    {
+        const Array<NumericalSolver::StateVector> noStateVectors = {};
+
+        EXPECT_TRUE(numericalSolver.integrateDuration(noStateVectors, defaultDuration_, systemOfEquations_).isEmpty());
+    }
+
+    {
+        const NumericalSolver::SystemOfEquationsWrapper throwingSystemOfEquations =
+            [](const NumericalSolver::StateVector &, NumericalSolver::StateVector &, const double) -> void
+        {
+            throw ostk::core::error::RuntimeError("Dynamics failure");
+        };
+
+        EXPECT_THROW(
+            numericalSolver.integrateDuration(stateVectors, defaultDuration_, throwingSystemOfEquations, 4),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            NumericalSolver::Undefined().integrateDuration(stateVectors, defaultDuration_, systemOfEquations_),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_P(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_Parametrized, Statistics)
+{
+    const auto parameters = GetParam();
+
+    const NumericalSolver::StepperType stepperType = std::get<0>(parameters);
+    const bool isFixedStep = stepperType == NumericalSolver::StepperType::RungeKutta4;
+
+    // Calls to the system of equations per step trial (plus the first derivative of the FSAL Dopri5 stepper)
+    const Size callCountPerTrial = (stepperType == NumericalSolver::StepperType::RungeKutta4)            ? 4
+                                 : (stepperType == NumericalSolver::StepperType::RungeKuttaFehlberg78) ? 13
+                                                                                                        : 6;
+    const Size initialCallCount = (stepperType == NumericalSolver::StepperType::RungeKuttaDopri5) ? 1 : 0;
+
+    // A too large initial time step guess, so that adaptive steppers reject steps
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        stepperType,
+        isFixedStep ? 1.0 / 128.0 : 1.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    Size callCount = 0;
+
+    const NumericalSolver::SystemOfEquationsWrapper countedSystemOfEquations =
+        [this, &callCount](const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double t)
+        -> void
+    {
+        ++callCount;
+        systemOfEquations_(x, dxdt, t);
+    };
+
+    Size acceptedTraceCount = 0;
+    Size rejectedTraceCount = 0;
+
+    numericalSolver.setStepTraceHook(
+        [&acceptedTraceCount, &rejectedTraceCount](const double, const double, const bool isAccepted) -> void
+        {
+            isAccepted ? ++acceptedTraceCount : ++rejectedTraceCount;
+        }
+    );
+
+    {
+        numericalSolver.integrateDuration(defaultStateVector_, defaultDuration_, countedSystemOfEquations);
+
+        const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+        EXPECT_EQ(callCount, statistics.systemOfEquationsCallCount);
+        EXPECT_EQ(numericalSolver.getObservedStateVectors().size() - 1, statistics.acceptedStepCount);
+        EXPECT_EQ(acceptedTraceCount, statistics.acceptedStepCount);
+        EXPECT_EQ(rejectedTraceCount, statistics.rejectedStepCount);
+        EXPECT_EQ(
+            initialCallCount + callCountPerTrial * (statistics.acceptedStepCount + statistics.rejectedStepCount),
+            statistics.systemOfEquationsCallCount
+        );
+
+        EXPECT_LE(statistics.minimumStepSize, statistics.meanStepSize);
+        EXPECT_LE(statistics.meanStepSize, statistics.maximumStepSize);
+        EXPECT_NEAR(defaultDuration_, statistics.meanStepSize * double(statistics.acceptedStepCount), 1e-9);
+
+        EXPECT_TRUE(statistics.wallTime.isDefined());
+        EXPECT_LE(0.0, statistics.wallTime);
+
+        if (isFixedStep)
+        {
+            EXPECT_EQ(1280, statistics.acceptedStepCount);
+            EXPECT_EQ(0, statistics.rejectedStepCount);
+            EXPECT_EQ(1.0 / 128.0, statistics.minimumStepSize);
+            EXPECT_EQ(1.0 / 128.0, statistics.maximumStepSize);
+        }
+        else
+        {
+            EXPECT_LT(0, statistics.rejectedStepCount);
+            EXPECT_GT(1.0, statistics.minimumStepSize);
+        }
+    }
+
+    // Statistics are reset by each integration
+
+    {
+        callCount = 0;
+
+        numericalSolver.integrateTime(
+            defaultStateVector_, defaultStartTime_, Array<Real> {1.0, 2.0, 5.0}, countedSystemOfEquations
+        );
+
+        const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+        EXPECT_EQ(callCount, statistics.systemOfEquationsCallCount);
+        EXPECT_LT(0, statistics.acceptedStepCount);
+        EXPECT_NEAR(5.0, statistics.meanStepSize * double(statistics.acceptedStepCount), 1e-9);
+    }
+
+    // Event conditions: the calls locating crossings (none with the Dopri5 continuous extension) are counted, but are
+    // not steps
+
+    {
+        callCount = 0;
+        acceptedTraceCount = 0;
+
+        const EventCondition eventCondition = {
+            "Increasing through 0.5",
+            EventCondition::Criterion::PositiveCrossing,
+            [](const VectorXd &x, const double) -> double
+            {
+                return x[0] - 0.5;
+            },
+        };
+
+        numericalSolver.integrateDuration(
+            defaultStateVector_, defaultDuration_, countedSystemOfEquations, {eventCondition}
+        );
+
+        const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+        EXPECT_EQ(callCount, statistics.systemOfEquationsCallCount);
+        EXPECT_EQ(acceptedTraceCount, statistics.acceptedStepCount);
+        EXPECT_LE(
+            initialCallCount + callCountPerTrial * (statistics.acceptedStepCount + statistics.rejectedStepCount),
+            statistics.systemOfEquationsCallCount
+        );
+    }
+
+    // Dense output, rejected trials being deduced from the calls to the system of equations
+
+    if (stepperType == NumericalSolver::StepperType::RungeKuttaDopri5)
+    {
+        callCount = 0;
+        acceptedTraceCount = 0;
+        rejectedTraceCount = 0;
+
+        const DenseTrajectory denseTrajectory =
+            numericalSolver.integrateDenseDuration(defaultStateVector_, defaultDuration_, countedSystemOfEquations);
+
+        const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+        EXPECT_EQ(callCount, statistics.systemOfEquationsCallCount);
+        EXPECT_EQ(denseTrajectory.getStepCount(), statistics.acceptedStepCount);
+        EXPECT_EQ(acceptedTraceCount, statistics.acceptedStepCount);
+        EXPECT_EQ(rejectedTraceCount, statistics.rejectedStepCount);
+        EXPECT_LT(0, statistics.rejectedStepCount);
+        EXPECT_NEAR(defaultDuration_, statistics.meanStepSize * double(statistics.acceptedStepCount), 1e-9);
+    }
+
+    // Parallel batch integration sums the statistics of all trajectories, without calling the trace hook
+
+    {
+        numericalSolver.integrateDuration(defaultStateVector_, defaultDuration_, systemOfEquations_);
+
+        const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+        acceptedTraceCount = 0;
+        rejectedTraceCount = 0;
+
+        numericalSolver.integrateDuration(
+            Array<NumericalSolver::StateVector>(3, defaultStateVector_), defaultDuration_, systemOfEquations_, 2
+        );
+
+        const NumericalSolver::Statistics batchStatistics = numericalSolver.getStatistics();
+
+        EXPECT_EQ(3 * statistics.systemOfEquationsCallCount, batchStatistics.systemOfEquationsCallCount);
+        EXPECT_EQ(3 * statistics.acceptedStepCount, batchStatistics.acceptedStepCount);
+        EXPECT_EQ(3 * statistics.rejectedStepCount, batchStatistics.rejectedStepCount);
+        EXPECT_EQ(statistics.minimumStepSize, batchStatistics.minimumStepSize);
+        EXPECT_EQ(statistics.maximumStepSize, batchStatistics.maximumStepSize);
+        EXPECT_NEAR(statistics.meanStepSize, batchStatistics.meanStepSize, 1e-12);
+
+        EXPECT_EQ(0, acceptedTraceCount + rejectedTraceCount);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, IntegrateDuration_Keplerian)
+{
+    // Circular Keplerian orbit of unit radius and gravitational parameter, position (cos(t), sin(t), 0), integrated
+    // over about 100 orbits. Duration and time steps are powers of two, so that fixed steps land exactly on the end.
+
+    Size systemOfEquationsCallCount = 0;
+
+    const NumericalSolver::SystemOfEquationsWrapper keplerianSystemOfEquations =
+        [&systemOfEquationsCallCount](
+            const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double
+        ) -> void
+    {
+        ++systemOfEquationsCallCount;
+
+        const double radius = x.head<3>().norm();
+
+        dxdt.head<3>() = x.tail<3>();
+        dxdt.tail<3>() = -x.head<3>() / (radius * radius * radius);
+    };
+
+    const auto getPositionError = [](const NumericalSolver::StateVector &x, const double aTime) -> double
+    {
+        return (x.head<3>() - Eigen::Vector3d(std::cos(aTime), std::sin(aTime), 0.0)).norm();
+    };
+
+    const auto getEnergyError = [](const NumericalSolver::StateVector &x) -> double
+    {
+        return std::abs(0.5 * x.tail<3>().squaredNorm() - 1.0 / x.head<3>().norm() + 0.5);
+    };
+
+    NumericalSolver::StateVector initialStateVector(6);
+    initialStateVector << 1.0, 0.0, 0.0, 0.0, 1.0, 0.0;
+
+    const double duration = 640.0;
+
+    const auto integrate = [&](const NumericalSolver::StepperType &aStepperType,
+                               const double aTimeStep,
+                               const double aTolerance) -> NumericalSolver::StateVector
+    {
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog, aStepperType, aTimeStep, aTolerance, aTolerance
+        };
+
+        systemOfEquationsCallCount = 0;
+
+        return numericalSolver.integrateDuration(initialStateVector, duration, keplerianSystemOfEquations).first;
+    };
+
+    const NumericalSolver::StateVector referenceStateVector =
+        integrate(NumericalSolver::StepperType::RungeKuttaFehlberg78, 1.0, 1.0e-10);
+    const Size referenceCallCount = systemOfEquationsCallCount;
+
+    EXPECT_GT(1e-5, getPositionError(referenceStateVector, duration));
+
+    // Adams-Bashforth-Moulton: more accurate than RKF78, with half the system of equations calls
+
+    {
+        const NumericalSolver::StateVector stateVector =
+            integrate(NumericalSolver::StepperType::AdamsBashforthMoulton8, 1.0 / 16.0, 1.0e-10);
+
+        EXPECT_GT(getPositionError(referenceStateVector, duration), getPositionError(stateVector, duration));
+        EXPECT_GT(referenceCallCount * 6 / 10, systemOfEquationsCallCount);
+    }
+
+    // Symplectic steppers: one system of equations call per Verlet step, and no energy drift
+
+    {
+        const NumericalSolver::StateVector stateVector =
+            integrate(NumericalSolver::StepperType::VelocityVerlet, 1.0 / 256.0, 1.0e-10);
+
+        EXPECT_EQ(640 * 256 + 1, systemOfEquationsCallCount);
+        EXPECT_GT(1e-2, getPositionError(stateVector, duration));
+        EXPECT_GT(1e-10, getEnergyError(stateVector));
+    }
+
+    {
+        const NumericalSolver::StateVector stateVector =
+            integrate(NumericalSolver::StepperType::Yoshida4, 1.0 / 32.0, 1.0e-10);
+
+        EXPECT_EQ(640 * 32 * 3 + 1, systemOfEquationsCallCount);
+        EXPECT_GT(1e-3, getPositionError(stateVector, duration));
+        EXPECT_GT(1e-3 * getEnergyError(referenceStateVector), getEnergyError(stateVector));
+    }
+
+    // Time arrays and event conditions
+
+    for (const auto stepperType :
+         {NumericalSolver::StepperType::VelocityVerlet,
+          NumericalSolver::StepperType::Yoshida4,
+          NumericalSolver::StepperType::AdamsBashforthMoulton8})
+    {
+        NumericalSolver numericalSolver = {NumericalSolver::LogType::NoLog, stepperType, 1.0 / 512.0, 1e-10, 1e-10};
+
+        const Array<Real> timeArray = {0.3, 1.0, 2.5, 10.3};
+
+        const Array<NumericalSolver::Solution> solutions =
+            numericalSolver.integrateTime(initialStateVector, 0.0, timeArray, keplerianSystemOfEquations);
+
+        ASSERT_EQ(timeArray.size(), solutions.size());
+
+        for (Size i = 0; i < solutions.size(); ++i)
+        {
+            EXPECT_EQ(timeArray[i], solutions[i].second);
+            EXPECT_GT(1e-4, getPositionError(solutions[i].first, timeArray[i]));
+        }
+
+        const EventCondition eventCondition = {
+            "Descending node",
+            EventCondition::Criterion::NegativeCrossing,
+            [](const VectorXd &x, const double) -> double
+            {
+                return x[1];
+            },
+        };
+
+        const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+            initialStateVector, 0.0, 10.0, keplerianSystemOfEquations, {eventCondition}
+        );
+
+        EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+        EXPECT_NEAR(M_PI, conditionSolution.solution.second, 1e-5);
+    }
+
+    // Durations which are not a multiple of the time step end with a partial step, as time arrays do
+
+    for (const auto stepperType :
+         {NumericalSolver::StepperType::VelocityVerlet,
+          NumericalSolver::StepperType::Yoshida4,
+          NumericalSolver::StepperType::AdamsBashforthMoulton8})
+    {
+        NumericalSolver numericalSolver = {NumericalSolver::LogType::NoLog, stepperType, 1.0 / 512.0, 1e-10, 1e-10};
+
+        for (const double aDuration : {10.3, 1.0e-3, -2.7})
+        {
+            const NumericalSolver::Solution solution =
+                numericalSolver.integrateDuration(initialStateVector, aDuration, keplerianSystemOfEquations);
+
+            EXPECT_EQ(aDuration, solution.second);
+            EXPECT_GT(1e-4, getPositionError(solution.first, aDuration));
+
+            const Array<NumericalSolver::Solution> timeSolutions = numericalSolver.integrateTime(
+                initialStateVector, 0.0, Array<Real>({aDuration}), keplerianSystemOfEquations
+            );
+
+            EXPECT_GT(1e-8, (solution.first - timeSolutions.accessFirst().first).norm());
+        }
+    }
+
+    // Symplectic steppers require positions and velocities of the same dimension
+
+    {
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::Yoshida4, 1e-2, 1e-10, 1e-10
+        };
+
+        EXPECT_THROW(
+            numericalSolver.integrateDuration(NumericalSolver::StateVector::Ones(3), 1.0, systemOfEquations_),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, IntegrateDense)
+{
+    Size systemOfEquationsCallCount = 0;
+
+    const NumericalSolver::SystemOfEquationsWrapper countingSystemOfEquations =
+        [this, &systemOfEquationsCallCount](
+            const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double t
+        ) -> void
+    {
+        ++systemOfEquationsCallCount;
+        systemOfEquations_(x, dxdt, t);
+    };
+
+    {
+        const DenseTrajectory denseTrajectory =
+            defaultRKD5_.integrateDenseTime(defaultStateVector_, defaultStartTime_, 100.0, countingSystemOfEquations);
+
+        EXPECT_TRUE(denseTrajectory.isDefined());
+        EXPECT_DOUBLE_EQ(defaultStartTime_, denseTrajectory.getStartTime());
+        EXPECT_DOUBLE_EQ(100.0, denseTrajectory.getEndTime());
+        EXPECT_EQ(denseTrajectory.getStepCount() + 1, defaultRKD5_.getObservedStateVectors().size());
+
+        // Querying the trajectory requires no further system of equations call
+
+        const Size callCountAfterIntegration = systemOfEquationsCallCount;
+
+        const VectorXd times = VectorXd::LinSpaced(10000, defaultStartTime_, 100.0);
+        const MatrixXd states = denseTrajectory.evaluate(times);
+
+        EXPECT_EQ(callCountAfterIntegration, systemOfEquationsCallCount);
+
+        for (Eigen::Index i = 0; i < times.size(); ++i)
+        {
+            EXPECT_GT(1e-8, std::abs(states(0, i) - std::sin(times(i))));
+            EXPECT_GT(1e-8, std::abs(states(1, i) - std::cos(times(i))));
+        }
+
+        // The trajectory can be rebuilt from its data
+
+        const DenseTrajectory rebuiltDenseTrajectory = {
+            denseTrajectory.accessStepTimes(), denseTrajectory.accessNodeStates()
+        };
+
+        EXPECT_EQ(denseTrajectory, rebuiltDenseTrajectory);
+        EXPECT_EQ(denseTrajectory.evaluate(42.0), rebuiltDenseTrajectory.evaluate(42.0));
+    }
+
+    {
+        const DenseTrajectory denseTrajectory =
+            defaultRKD5_.integrateDenseDuration(defaultStateVector_, -defaultDuration_, systemOfEquations_);
+
+        EXPECT_DOUBLE_EQ(0.0, denseTrajectory.getStartTime());
+        EXPECT_DOUBLE_EQ(-defaultDuration_, denseTrajectory.getEndTime());
+
+        for (const double time : {-0.3, -5.0, -defaultDuration_})
+        {
+            EXPECT_GT(1e-8, std::abs(denseTrajectory.evaluate(time)(0) - std::sin(time)));
+        }
+    }
+
+    {
+        EXPECT_THROW(
+            defaultRKD5_.integrateDenseTime(defaultStateVector_, 1.0, 1.0, systemOfEquations_),
+            ostk::core::error::RuntimeError
+        );
+
+        EXPECT_THROW(
+            defaultRK54_.integrateDenseDuration(defaultStateVector_, defaultDuration_, systemOfEquations_),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            NumericalSolver::Undefined().integrateDenseTime(defaultStateVector_, 0.0, 1.0, systemOfEquations_),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            defaultRKD5_.integrateDenseTime(defaultStateVector_, Real::Undefined(), 1.0, systemOfEquations_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            defaultRKD5_.integrateDenseTime(defaultStateVector_, 0.0, Real::Undefined(), systemOfEquations_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            defaultRKD5_.integrateDenseDuration(defaultStateVector_, Real::Undefined(), systemOfEquations_),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, IntegrateImplicit)
+{
+    // Stiff linear system, with eigenvalues -1 and -1000: y1 = 2 exp(-t) - exp(-1000 t), y2 = exp(-1000 t) - exp(-t)
+
+    MatrixXd systemMatrix(2, 2);
+    systemMatrix << 998.0, 1998.0, -999.0, -1999.0;
+
+    Size systemOfEquationsCallCount = 0;
+
+    const NumericalSolver::SystemOfEquationsWrapper stiffSystemOfEquations =
+        [&systemMatrix, &systemOfEquationsCallCount](
+            const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double
+        ) -> void
+    {
+        ++systemOfEquationsCallCount;
+        dxdt = systemMatrix * x;
+    };
+
+    const NumericalSolver::JacobianWrapper stiffJacobian =
+        [&systemMatrix](
+            const NumericalSolver::StateVector &, MatrixXd &dfdx, NumericalSolver::StateVector &dfdt, const double
+        ) -> void
+    {
+        dfdx = systemMatrix;
+        dfdt.setZero();
+    };
+
+    const auto getStiffStateVector = [](const double aTime) -> VectorXd
+    {
+        VectorXd stateVector(2);
+        stateVector << 2.0 * std::exp(-aTime) - std::exp(-1000.0 * aTime),
+            std::exp(-1000.0 * aTime) - std::exp(-aTime);
+        return stateVector;
+    };
+
+    const NumericalSolver::StateVector initialStateVector = getStiffStateVector(0.0);
+
+    Size explicitCallCount = 0;
+
+    {
+        systemOfEquationsCallCount = 0;
+
+        defaultRK54_.integrateDuration(initialStateVector, 10.0, stiffSystemOfEquations);
+
+        explicitCallCount = systemOfEquationsCallCount;
+    }
+
+    for (const auto stepperType :
+         {NumericalSolver::StepperType::Rosenbrock4, NumericalSolver::StepperType::BackwardDifferentiationFormula})
+    {
+        for (const bool hasJacobian : {true, false})
+        {
+            NumericalSolver numericalSolver = {
+                NumericalSolver::LogType::NoLog,
+                stepperType,
+                1e-4,
+                1.0e-10,
+                1.0e-10,
+            };
+
+            if (hasJacobian)
+            {
+                numericalSolver.setJacobian(stiffJacobian);
+            }
+
+            // Integrate duration, far fewer system of equations calls than an explicit stepper
+
+            {
+                systemOfEquationsCallCount = 0;
+
+                const NumericalSolver::Solution solution =
+                    numericalSolver.integrateDuration(initialStateVector, 10.0, stiffSystemOfEquations);
+
+                EXPECT_EQ(10.0, solution.second);
+                EXPECT_GT(1e-8, (solution.first - getStiffStateVector(10.0)).norm());
+                EXPECT_GT(explicitCallCount, systemOfEquationsCallCount);
+
+                const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+                EXPECT_EQ(systemOfEquationsCallCount, statistics.systemOfEquationsCallCount);
+                EXPECT_EQ(numericalSolver.getObservedStateVectors().size() - 1, statistics.acceptedStepCount);
+                EXPECT_NEAR(10.0, statistics.meanStepSize * double(statistics.acceptedStepCount), 1e-9);
+            }
+
+            // Integrate time array
+
+            {
+                const Array<Real> timeArray = {0.001, 0.01, 0.5, 1.0, 3.0};
+
+                const Array<NumericalSolver::Solution> solutions =
+                    numericalSolver.integrateTime(initialStateVector, 0.0, timeArray, stiffSystemOfEquations);
+
+                ASSERT_EQ(timeArray.size(), solutions.size());
+
+                for (Size i = 0; i < solutions.size(); ++i)
+                {
+                    EXPECT_EQ(timeArray[i], solutions[i].second);
+                    EXPECT_GT(1e-7, (solutions[i].first - getStiffStateVector(timeArray[i])).norm());
+                }
+
+            }
+
+            // Event conditions, y1 decreasing through 1 at t = ln(2)
+
+            {
+                const EventCondition eventCondition = {
+                    "Decreasing through 1",
+                    EventCondition::Criterion::NegativeCrossing,
+                    [](const VectorXd &x, const double) -> double
+                    {
+                        return x[0] - 1.0;
+                    },
+                };
+
+                const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+                    initialStateVector, 0.0, 10.0, stiffSystemOfEquations, {eventCondition}
+                );
+
+                EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+                EXPECT_NEAR(std::log(2.0), conditionSolution.solution.second, 1e-7);
+            }
+        }
+
+        // Log constant observes multiples of the time step, log adaptive every step
+
+        {
+            NumericalSolver numericalSolver = {
+                NumericalSolver::LogType::LogConstant,
+                stepperType,
+                0.5,
+                1.0e-10,
+                1.0e-10,
+            };
+
+            testing::internal::CaptureStdout();
+
+            numericalSolver.integrateDuration(initialStateVector, 10.0, stiffSystemOfEquations);
+
+            const Array<NumericalSolver::Solution> observedStateVectors = numericalSolver.getObservedStateVectors();
+
+            ASSERT_EQ(21, observedStateVectors.size());
+
+            for (Size i = 0; i < observedStateVectors.size(); ++i)
+            {
+                EXPECT_NEAR(0.5 * double(i), observedStateVectors[i].second, 1e-12);
+                EXPECT_GT(
+                    1e-7, (observedStateVectors[i].first - getStiffStateVector(observedStateVectors[i].second)).norm()
+                );
+            }
+
+            EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+        }
+
+        {
+            NumericalSolver numericalSolver = {
+                NumericalSolver::LogType::NoLog,
+                stepperType,
+                1e-4,
+                1.0e-10,
+                1.0e-10,
+            };
+
+            numericalSolver.integrateDuration(initialStateVector, 10.0, stiffSystemOfEquations);
+
+            const Array<NumericalSolver::Solution> observedStateVectors = numericalSolver.getObservedStateVectors();
+
+            ASSERT_LT(2, observedStateVectors.size());
+            EXPECT_EQ(0.0, observedStateVectors.accessFirst().second);
+            EXPECT_EQ(10.0, observedStateVectors.accessLast().second);
+        }
+
+        // Not available for ensembles, fixed size states and dense output
+
+        {
+            NumericalSolver numericalSolver = {
+                NumericalSolver::LogType::NoLog,
+                stepperType,
+                1e-4,
+                1.0e-10,
+                1.0e-10,
+            };
+
+            const NumericalSolver::EnsembleSystemOfEquationsWrapper ensembleSystemOfEquations =
+                [&systemMatrix](
+                    const NumericalSolver::EnsembleState &x, NumericalSolver::EnsembleState &dxdt, const double
+                ) -> void
+            {
+                dxdt = systemMatrix * x;
+            };
+
+            EXPECT_THROW(
+                numericalSolver.integrateEnsembleDuration(
+                    NumericalSolver::EnsembleState::Ones(2, 3), 1.0, ensembleSystemOfEquations
+                ),
+                ostk::core::error::RuntimeError
+            );
+
+            EXPECT_THROW(
+                numericalSolver.integrateDenseDuration(initialStateVector, 1.0, stiffSystemOfEquations),
+                ostk::core::error::RuntimeError
+            );
+        }
+    }
+}
+
+TEST_P(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver_Parametrized, IntegrateEnsembleDuration)
+{
+    const auto parameters = GetParam();
+
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        std::get<0>(parameters),
+        1e-3,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const Array<double> phases = {0.0, 0.5, 1.0, 2.0};
+
+    NumericalSolver::EnsembleState ensembleState(2, phases.size());
+
+    for (Size i = 0; i < phases.size(); ++i)
+    {
+        ensembleState.col(i) = getStateVector(phases[i]);
+    }
+
+    const Array<NumericalSolver::EnsembleStepControl> ensembleStepControls = {
+        NumericalSolver::EnsembleStepControl::Shared,
+        NumericalSolver::EnsembleStepControl::PerMember,
+    };
+
+    for (const NumericalSolver::EnsembleStepControl &ensembleStepControl : ensembleStepControls)
+    {
+        for (const Real &duration : Array<Real> {defaultDuration_, -defaultDuration_})
+        {
+            const NumericalSolver::EnsembleSolution ensembleSolution = numericalSolver.integrateEnsembleDuration(
+                ensembleState, duration, ensembleSystemOfEquations_, ensembleStepControl
+            );
+
+            EXPECT_EQ(2, ensembleSolution.first.rows());
+            EXPECT_EQ(Eigen::Index(phases.size()), ensembleSolution.first.cols());
+            EXPECT_DOUBLE_EQ(duration, ensembleSolution.second);
+
+            for (Size i = 0; i < phases.size(); ++i)
+            {
+                // Each member matches both the analytical solution and the single state integration
+
+                const NumericalSolver::StateVector memberStateVector =
+                    numericalSolver.integrateDuration(ensembleState.col(i), duration, systemOfEquations_).first;
+
+                EXPECT_GT(2e-8, std::abs(ensembleSolution.first(0, i) - std::sin(phases[i] + duration)));
+                EXPECT_GT(2e-8, std::abs(ensembleSolution.first(1, i) - std::cos(phases[i] + duration)));
+
+                if (ensembleStepControl == NumericalSolver::EnsembleStepControl::PerMember)
+                {
+                    EXPECT_DOUBLE_EQ(memberStateVector[0], ensembleSolution.first(0, i));
+                    EXPECT_DOUBLE_EQ(memberStateVector[1], ensembleSolution.first(1, i));
+                }
+            }
+        }
+    }
+
+    {
+        const NumericalSolver::EnsembleSolution ensembleSolution =
+            numericalSolver.integrateEnsembleTime(ensembleState, defaultStartTime_, 5.0, ensembleSystemOfEquations_);
+
+        EXPECT_DOUBLE_EQ(5.0, ensembleSolution.second);
+
+        for (Size i = 0; i < phases.size(); ++i)
+        {
+            EXPECT_GT(2e-8, std::abs(ensembleSolution.first(0, i) - std::sin(phases[i] + 5.0)));
+        }
+    }
+
+    {
+        const NumericalSolver::EnsembleSolution ensembleSolution =
+            numericalSolver.integrateEnsembleDuration(ensembleState, 0.0, ensembleSystemOfEquations_);
+
+        EXPECT_TRUE(ensembleSolution.first.isApprox(ensembleState));
+        EXPECT_DOUBLE_EQ(0.0, ensembleSolution.second);
+    }
+
+    {
+        EXPECT_THROW(
+            numericalSolver.integrateEnsembleDuration(
+                NumericalSolver::EnsembleState(2, 0), defaultDuration_, ensembleSystemOfEquations_
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, IntegrateVariational)
+{
+    // Harmonic oscillator, with state transition matrix [cos(t), sin(t); -sin(t), cos(t)]
+
+    const auto getStateTransitionMatrix = [](const double aTime) -> MatrixXd
+    {
+        MatrixXd stateTransitionMatrix(2, 2);
+        stateTransitionMatrix << std::cos(aTime), std::sin(aTime), -std::sin(aTime), std::cos(aTime);
+        return stateTransitionMatrix;
+    };
+
+    const NumericalSolver::JacobianWrapper jacobian =
+        [](const NumericalSolver::StateVector &, MatrixXd &dfdx, NumericalSolver::StateVector &dfdt, const double)
+        -> void
+    {
+        dfdx << 0.0, 1.0, -1.0, 0.0;
+        dfdt.setZero();
+    };
+
+    const NumericalSolver::DualSystemOfEquationsWrapper dualSystemOfEquations =
+        [](const NumericalSolver::DualStateVector &x, NumericalSolver::DualStateVector &dxdt, const double) -> void
+    {
+        dxdt[0] = x[1];
+        dxdt[1] = -x[0];
+    };
+
+    for (const auto stepperType :
+         {NumericalSolver::StepperType::RungeKutta4,
+          NumericalSolver::StepperType::RungeKuttaCashKarp54,
+          NumericalSolver::StepperType::RungeKuttaFehlberg78,
+          NumericalSolver::StepperType::RungeKuttaDopri5})
+    {
+        const double timeStep = (stepperType == NumericalSolver::StepperType::RungeKutta4) ? 1e-3 : 1e-2;
+        const double tolerance = (stepperType == NumericalSolver::StepperType::RungeKutta4) ? 1e-9 : 1e-7;
+
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            stepperType,
+            timeStep,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        // Finite difference, user Jacobian and automatic differentiation
+
+        for (const Size jacobianType : {0, 1, 2})
+        {
+            if (jacobianType == 1)
+            {
+                numericalSolver.setJacobian(jacobian);
+            }
+
+            const NumericalSolver::VariationalSolution variationalSolution =
+                (jacobianType == 2)
+                    ? numericalSolver.integrateVariationalDuration(defaultStateVector_, 5.0, dualSystemOfEquations)
+                    : numericalSolver.integrateVariationalDuration(defaultStateVector_, 5.0, systemOfEquations_);
+
+            EXPECT_EQ(5.0, variationalSolution.time);
+            EXPECT_GT(tolerance, (variationalSolution.state - getStateVector(5.0)).norm());
+            EXPECT_GT(tolerance, (variationalSolution.stateTransitionMatrix - getStateTransitionMatrix(5.0)).norm());
+            EXPECT_LT(0, numericalSolver.getStatistics().systemOfEquationsCallCount);
+        }
+
+        {
+            const NumericalSolver::VariationalSolution variationalSolution = numericalSolver.integrateVariationalTime(
+                getStateVector(1.0), 1.0, -2.0, dualSystemOfEquations
+            );
+
+            EXPECT_EQ(-2.0, variationalSolution.time);
+            EXPECT_GT(tolerance, (variationalSolution.state - getStateVector(-2.0)).norm());
+            EXPECT_GT(tolerance, (variationalSolution.stateTransitionMatrix - getStateTransitionMatrix(-3.0)).norm());
+        }
+
+        {
+            const NumericalSolver::VariationalSolution variationalSolution =
+                numericalSolver.integrateVariationalDuration(defaultStateVector_, 0.0, dualSystemOfEquations);
+
+            EXPECT_EQ(defaultStateVector_, variationalSolution.state);
+            EXPECT_EQ(MatrixXd::Identity(2, 2), variationalSolution.stateTransitionMatrix);
+        }
+
+        // Excluding the state transition matrix from the step size control does not take more steps
+
+        if (stepperType != NumericalSolver::StepperType::RungeKutta4)
+        {
+            numericalSolver.integrateVariationalDuration(defaultStateVector_, 5.0, dualSystemOfEquations, 1.0);
+            const Size weightedStepCount = numericalSolver.getStatistics().acceptedStepCount;
+
+            numericalSolver.integrateVariationalDuration(defaultStateVector_, 5.0, dualSystemOfEquations, 0.0);
+            const Size excludedStepCount = numericalSolver.getStatistics().acceptedStepCount;
+
+            EXPECT_GE(weightedStepCount, excludedStepCount);
+        }
+
+        {
+            EXPECT_THROW(
+                numericalSolver.integrateVariationalDuration(defaultStateVector_, 5.0, systemOfEquations_, -1.0),
+                ostk::core::error::runtime::Wrong
+            );
+            EXPECT_THROW(
+                numericalSolver.integrateVariationalDuration(
+                    defaultStateVector_, 5.0, systemOfEquations_, Real::Undefined()
+                ),
+                ostk::core::error::runtime::Wrong
+            );
+        }
+    }
+
+    {
+        NumericalSolver numericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::Rosenbrock4,
+            1e-2,
+            1.0e-12,
+            1.0e-12,
+        };
+
+        EXPECT_THROW(
+            numericalSolver.integrateVariationalDuration(defaultStateVector_, 5.0, systemOfEquations_),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        NumericalSolver numericalSolver = NumericalSolver::Undefined();
+
+        EXPECT_THROW(
+            numericalSolver.integrateVariationalDuration(defaultStateVector_, 5.0, systemOfEquations_),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolver, Undefined)
 {
     {
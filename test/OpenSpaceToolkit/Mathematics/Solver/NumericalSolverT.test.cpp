@@ -0,0 +1,159 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolverT.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+
+using ostk::mathematics::object::VectorXd;
+using ostk::mathematics::solver::NumericalSolver;
+using ostk::mathematics::solver::NumericalSolverT;
+
+class OpenSpaceToolkit_Mathematics_Solver_NumericalSolverT : public ::testing::Test
+{
+   protected:
+    static void SystemOfEquations(const Eigen::Vector2d &x, Eigen::Vector2d &dxdt, const double)
+    {
+        dxdt[0] = x[1];
+        dxdt[1] = -x[0];
+    }
+
+    static Eigen::Vector2d getStateVector(const double &aTime)
+    {
+        return {std::sin(aTime), std::cos(aTime)};
+    }
+
+    // Compare integrations against those of the runtime configured numerical solver, which forwards to this solver
+    // over [0, duration]
+
+    template <NumericalSolver::StepperType Type>
+    static void testIntegration(const double anAccuracy)
+    {
+        for (const auto logType : {NumericalSolver::LogType::NoLog, NumericalSolver::LogType::LogConstant})
+        {
+            NumericalSolver numericalSolver = {logType, Type, 1e-1, 1.0e-12, 1.0e-12};
+
+            const NumericalSolverT<Type, Eigen::Vector2d> numericalSolverT =
+                NumericalSolverT<Type, Eigen::Vector2d>::FromNumericalSolver(numericalSolver);
+
+            for (const double endTime : {10.0, -10.0})
+            {
+                const auto systemOfEquations = [](const Eigen::Vector2d &x, Eigen::Vector2d &dxdt, const double t)
+                {
+                    SystemOfEquations(x, dxdt, t);
+                };
+
+                const auto solution =
+                    numericalSolverT.integrateTime(getStateVector(1.0), 1.0, endTime, systemOfEquations);
+
+                EXPECT_EQ(endTime, solution.second);
+                EXPECT_GT(anAccuracy, (solution.first - getStateVector(endTime)).norm());
+
+                const auto durationSolution =
+                    numericalSolverT.integrateDuration(getStateVector(1.0), endTime - 1.0, systemOfEquations);
+
+                const NumericalSolver::Solution referenceSolution = numericalSolver.integrateTime(
+                    VectorXd(getStateVector(1.0)),
+                    1.0,
+                    endTime,
+                    [](const VectorXd &x, VectorXd &dxdt, const double) -> void
+                    {
+                        dxdt[0] = x[1];
+                        dxdt[1] = -x[0];
+                    }
+                );
+
+                EXPECT_TRUE(referenceSolution.first.isApprox(VectorXd(durationSolution.first), 1e-14));
+            }
+        }
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolverT, Constructor)
+{
+    {
+        const NumericalSolverT<NumericalSolver::StepperType::RungeKuttaDopri5, Eigen::Vector2d> numericalSolverT = {
+            NumericalSolver::LogType::LogAdaptive, 5.0, 1e-10, 1e-11
+        };
+
+        EXPECT_EQ(NumericalSolver::LogType::LogAdaptive, numericalSolverT.getLogType());
+        EXPECT_EQ(5.0, numericalSolverT.getTimeStep());
+        EXPECT_EQ(1e-10, numericalSolverT.getRelativeTolerance());
+        EXPECT_EQ(1e-11, numericalSolverT.getAbsoluteTolerance());
+    }
+
+    {
+        typedef NumericalSolverT<NumericalSolver::StepperType::RungeKuttaFehlberg78> NumericalSolverRKF78;
+
+        EXPECT_NO_THROW(NumericalSolverRKF78::FromNumericalSolver(NumericalSolver::Default()));
+
+        EXPECT_THROW(
+            NumericalSolverRKF78::FromNumericalSolver(NumericalSolver::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            NumericalSolverRKF78::FromNumericalSolver(
+                {NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKutta4, 1e-1, 1e-12, 1e-12}
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_NumericalSolverT, Integrate)
+{
+    {
+        // The fixed step RK4 truncation error, at a 0.1 s time step, is of the order of 1e-5
+
+        testIntegration<NumericalSolver::StepperType::RungeKutta4>(2e-5);
+        testIntegration<NumericalSolver::StepperType::RungeKuttaCashKarp54>(5e-6);
+        testIntegration<NumericalSolver::StepperType::RungeKuttaFehlberg78>(5e-6);
+        testIntegration<NumericalSolver::StepperType::RungeKuttaDopri5>(5e-6);
+    }
+
+    // Dynamic size state, observed at multiples of the time step
+
+    {
+        const NumericalSolverT<NumericalSolver::StepperType::RungeKuttaCashKarp54> numericalSolverT = {
+            NumericalSolver::LogType::LogConstant, 0.5, 1.0e-12, 1.0e-12
+        };
+
+        VectorXd stateVector = getStateVector(0.0);
+        Array<double> observedTimes = Array<double>::Empty();
+
+        numericalSolverT.integrateState(
+            stateVector,
+            0.0,
+            2.0,
+            [](const VectorXd &x, VectorXd &dxdt, const double) -> void
+            {
+                dxdt[0] = x[1];
+                dxdt[1] = -x[0];
+            },
+            [&observedTimes](const VectorXd &, const double t) -> void
+            {
+                observedTimes.add(t);
+            }
+        );
+
+        EXPECT_EQ(Array<double>({0.0, 0.5, 1.0, 1.5, 2.0}), observedTimes);
+        EXPECT_GT(1e-10, (stateVector - VectorXd(getStateVector(2.0))).norm());
+    }
+
+    {
+        const NumericalSolverT<NumericalSolver::StepperType::RungeKutta4, Eigen::Vector2d> numericalSolverT = {
+            NumericalSolver::LogType::NoLog, 1e-2, 1.0e-12, 1.0e-12
+        };
+
+        const auto solution = numericalSolverT.integrateDuration(getStateVector(0.0), 0.0, &SystemOfEquations);
+
+        EXPECT_EQ(getStateVector(0.0), solution.first);
+        EXPECT_EQ(0.0, solution.second);
+    }
+}
@@ -0,0 +1,246 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Mathematics/Solver/Parareal.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::VectorXd;
+using ostk::mathematics::solver::NumericalSolver;
+using ostk::mathematics::solver::Parareal;
+
+class OpenSpaceToolkit_Mathematics_Solver_Parareal : public ::testing::Test
+{
+   protected:
+    const NumericalSolver coarseSolver_ = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKutta4,
+        0.25,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const NumericalSolver fineSolver_ = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        1e-2,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations_ =
+        [](const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double) -> void
+    {
+        dxdt[0] = x[1];
+        dxdt[1] = -x[0];
+    };
+
+    static VectorXd getStateVector(const double &aTime)
+    {
+        VectorXd stateVector(2);
+        stateVector << std::sin(aTime), std::cos(aTime);
+        return stateVector;
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_Parareal, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Parareal(coarseSolver_, fineSolver_, 8, 1e-10, 8));
+    }
+
+    {
+        EXPECT_THROW(Parareal(coarseSolver_, fineSolver_, 8, -1.0, 8), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_Parareal, Print)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        const Parareal parareal = {coarseSolver_, fineSolver_, 8, 1e-10, 8};
+
+        EXPECT_NO_THROW(parareal.print(std::cout, true));
+        EXPECT_NO_THROW(parareal.print(std::cout, false));
+        EXPECT_NO_THROW(std::cout << Parareal::Undefined() << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_Parareal, Getters)
+{
+    {
+        const Parareal parareal = {coarseSolver_, fineSolver_, 8, 1e-10, 6};
+
+        EXPECT_EQ(8, parareal.getSliceCount());
+        EXPECT_EQ(1e-10, parareal.getTolerance());
+        EXPECT_EQ(6, parareal.getMaximumIterationCount());
+        EXPECT_EQ(0, parareal.getStatistics().iterationCount);
+    }
+
+    {
+        EXPECT_THROW(Parareal::Undefined().getSliceCount(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Parareal::Undefined().getTolerance(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Parareal::Undefined().getMaximumIterationCount(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Parareal::Undefined().getStatistics(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_Parareal, Integrate)
+{
+    {
+        Parareal parareal = {coarseSolver_, fineSolver_, 8, 1e-10, 8};
+
+        const NumericalSolver::Solution solution =
+            parareal.integrateDuration(getStateVector(0.0), 40.0, systemOfEquations_);
+
+        EXPECT_EQ(40.0, solution.second);
+        EXPECT_GT(1e-8, (solution.first - getStateVector(40.0)).norm());
+
+        const Parareal::Statistics statistics = parareal.getStatistics();
+
+        EXPECT_TRUE(statistics.isConverged);
+        EXPECT_LT(0, statistics.iterationCount);
+        EXPECT_GT(8, statistics.iterationCount);
+        EXPECT_GE(1e-10, statistics.correction);
+        EXPECT_TRUE(statistics.wallTime.isDefined());
+        EXPECT_TRUE(statistics.serialFineTime.isDefined());
+        EXPECT_TRUE(statistics.speedup.isDefined());
+    }
+
+    // Results do not depend on the thread count, and reach the sequential fine result after as many iterations as
+    // slices
+
+    {
+        Parareal serialParareal = {coarseSolver_, fineSolver_, 4, 0.0, 4, 1};
+        Parareal parallelParareal = {coarseSolver_, fineSolver_, 4, 0.0, 4, 4};
+
+        const NumericalSolver::Solution serialSolution =
+            serialParareal.integrateTime(getStateVector(1.0), 1.0, -9.0, systemOfEquations_);
+        const NumericalSolver::Solution parallelSolution =
+            parallelParareal.integrateTime(getStateVector(1.0), 1.0, -9.0, systemOfEquations_);
+
+        EXPECT_EQ(serialSolution.first, parallelSolution.first);
+        EXPECT_EQ(-9.0, parallelSolution.second);
+        EXPECT_EQ(4, parallelParareal.getStatistics().iterationCount);
+        EXPECT_TRUE(parallelParareal.getStatistics().isConverged);
+
+        NumericalSolver fineSolver = fineSolver_;
+
+        VectorXd stateVector = getStateVector(1.0);
+
+        for (Size sliceIndex = 0; sliceIndex < 4; ++sliceIndex)
+        {
+            stateVector = fineSolver
+                              .integrateTime(
+                                  stateVector,
+                                  1.0 - 2.5 * double(sliceIndex),
+                                  Array<Real>({1.0 - 2.5 * double(sliceIndex + 1)}),
+                                  systemOfEquations_
+                              )
+                              .accessFirst()
+                              .first;
+        }
+
+        EXPECT_GT(1e-12, (parallelSolution.first - stateVector).norm());
+    }
+
+    // Slices which are not a multiple of the coarse time step (or shorter than it) end with a partial coarse step: with
+    // the coarse solver as fine solver, the coarse prediction is already converged
+
+    for (const auto &[duration, sliceCount] : {std::pair<double, Size> {10.0, 7}, std::pair<double, Size> {1.0, 8}})
+    {
+        Parareal parareal = {coarseSolver_, coarseSolver_, sliceCount, 1e-14, sliceCount};
+
+        const NumericalSolver::Solution solution =
+            parareal.integrateDuration(getStateVector(0.0), duration, systemOfEquations_);
+
+        EXPECT_EQ(duration, solution.second);
+        EXPECT_GT(1e-3, (solution.first - getStateVector(duration)).norm());
+        EXPECT_EQ(1, parareal.getStatistics().iterationCount);
+        EXPECT_TRUE(parareal.getStatistics().isConverged);
+    }
+
+    // Not converged within the maximum iteration count
+
+    {
+        Parareal parareal = {coarseSolver_, fineSolver_, 8, 0.0, 2};
+
+        parareal.integrateDuration(getStateVector(0.0), 40.0, systemOfEquations_);
+
+        EXPECT_EQ(2, parareal.getStatistics().iterationCount);
+        EXPECT_FALSE(parareal.getStatistics().isConverged);
+    }
+
+    {
+        Parareal parareal = {coarseSolver_, fineSolver_, 8, 1e-10, 8};
+
+        const NumericalSolver::Solution solution =
+            parareal.integrateDuration(getStateVector(0.0), 0.0, systemOfEquations_);
+
+        EXPECT_EQ(getStateVector(0.0), solution.first);
+        EXPECT_EQ(0.0, solution.second);
+    }
+
+    {
+        Parareal parareal = Parareal::Undefined();
+
+        EXPECT_THROW(
+            parareal.integrateDuration(getStateVector(0.0), 1.0, systemOfEquations_),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_Parareal, Integrate_TimeDependent)
+{
+    // Rotation at an angular rate equal to the time, solved by (sin(a), cos(a)) with a = a0 + (t^2 - t0^2) / 2: each
+    // slice must be integrated over its own time window
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        [](const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double t) -> void
+    {
+        dxdt[0] = t * x[1];
+        dxdt[1] = -t * x[0];
+    };
+
+    {
+        Parareal parareal = {coarseSolver_, fineSolver_, 4, 1e-12, 4};
+
+        const NumericalSolver::Solution solution =
+            parareal.integrateTime(getStateVector(0.0), 1.0, 5.0, systemOfEquations);
+
+        EXPECT_EQ(5.0, solution.second);
+        EXPECT_GT(1e-8, (solution.first - getStateVector(12.0)).norm());
+        EXPECT_TRUE(parareal.getStatistics().isConverged);
+    }
+
+    {
+        Parareal parareal = {coarseSolver_, fineSolver_, 5, 1e-12, 5};
+
+        const NumericalSolver::Solution solution =
+            parareal.integrateTime(getStateVector(0.0), 3.0, -1.0, systemOfEquations);
+
+        EXPECT_EQ(-1.0, solution.second);
+        EXPECT_GT(1e-8, (solution.first - getStateVector(-4.0)).norm());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Mathematics_Solver_Parareal, Undefined)
+{
+    {
+        EXPECT_NO_THROW(Parareal::Undefined());
+        EXPECT_FALSE(Parareal::Undefined().isDefined());
+    }
+}
@@ -0,0 +1,97 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Utility/ThreadPool.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Size;
+
+using ostk::mathematics::utility::ThreadPool;
+
+TEST(OpenSpaceToolkit_Mathematics_Utility_ThreadPool, Constructor)
+{
+    {
+        EXPECT_NO_THROW(ThreadPool(1));
+        EXPECT_NO_THROW(ThreadPool(4));
+        EXPECT_NO_THROW(ThreadPool(ThreadPool::DefaultThreadCount()));
+    }
+
+    {
+        EXPECT_THROW(ThreadPool(0), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Utility_ThreadPool, GetThreadCount)
+{
+    {
+        EXPECT_EQ(3, ThreadPool(3).getThreadCount());
+        EXPECT_LE(1, ThreadPool::DefaultThreadCount());
+    }
+}
+
+TEST(OpenSpaceToolkit_Mathematics_Utility_ThreadPool, Run)
+{
+    // Each task runs once, on a thread of the pool, and the pool is reused across batches
+
+    for (const Size threadCount : {1, 2, 4})
+    {
+        ThreadPool threadPool(threadCount);
+
+        for (const Size taskCount : {0, 1, 3, 100})
+        {
+            std::vector<Size> runCounts(taskCount, 0);
+            std::atomic<bool> isThreadIndexValid {true};
+
+            threadPool.run(
+                taskCount,
+                [&](const Size& aTaskIndex, const Size& aThreadIndex) -> void
+                {
+                    ++runCounts[aTaskIndex];
+
+                    if (aThreadIndex >= threadCount)
+                    {
+                        isThreadIndexValid = false;
+                    }
+                }
+            );
+
+            EXPECT_EQ(std::vector<Size>(taskCount, 1), runCounts);
+            EXPECT_TRUE(isThreadIndexValid);
+        }
+    }
+
+    // The exception of the first failing task is rethrown, after all tasks have run
+
+    for (const Size threadCount : {1, 4})
+    {
+        ThreadPool threadPool(threadCount);
+
+        std::atomic<Size> runCount {0};
+
+        const auto task = [&runCount](const Size& aTaskIndex, const Size&) -> void
+        {
+            ++runCount;
+
+            if (aTaskIndex == 7)
+            {
+                throw ostk::core::error::runtime::Wrong("Task");
+            }
+
+            if (aTaskIndex == 30)
+            {
+                throw ostk::core::error::runtime::Undefined("Task");
+            }
+        };
+
+        EXPECT_THROW(threadPool.run(50, task), ostk::core::error::runtime::Wrong);
+        EXPECT_EQ(50, runCount);
+
+        EXPECT_NO_THROW(threadPool.run(5, [](const Size&, const Size&) -> void {}));
+    }
+}